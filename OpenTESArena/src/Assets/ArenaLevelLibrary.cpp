@@ -7,6 +7,13 @@
 
 #include "components/debug/Debug.h"
 #include "components/dos/DOSUtils.h"
+#include "components/utilities/JobSystem.h"
+
+ArenaLevelLibrary::CityBlockMifEntry::CityBlockMifEntry()
+{
+	this->isLoaded = false;
+	this->isValid = false;
+}
 
 bool ArenaLevelLibrary::init()
 {
@@ -22,7 +29,6 @@ bool ArenaLevelLibrary::initCityBlockMifs()
 	const int variationsCount = MIFUtils::getCityBlockVariationsCount();
 	const int rotationCount = MIFUtils::getCityBlockRotationCount();
 
-	bool success = true;
 	std::vector<std::string> mifNames;
 
 	// Iterate over all city block codes, variations, and rotations.
@@ -47,25 +53,13 @@ bool ArenaLevelLibrary::initCityBlockMifs()
 		}
 	}
 
-	const int mifCount = static_cast<int>(mifNames.size());
-	this->cityBlockMifs.init(mifCount);
-	for (int i = 0; i < mifCount; i++)
+	this->cityBlockMifEntries.resize(mifNames.size());
+	for (size_t i = 0; i < mifNames.size(); i++)
 	{
-		const std::string &mifName = mifNames[i];
-
-		MIFFile mif;
-		if (mif.init(mifName.c_str()))
-		{
-			this->cityBlockMifs.set(i, std::move(mif));
-		}
-		else
-		{
-			DebugLogError("Could not init .MIF \"" + mifName + "\".");
-			success = false;
-		}
+		this->cityBlockMifEntries[i].mifName = std::move(mifNames[i]);
 	}
 
-	return success;
+	return true;
 }
 
 bool ArenaLevelLibrary::initWildernessChunks()
@@ -89,9 +83,58 @@ bool ArenaLevelLibrary::initWildernessChunks()
 	return true;
 }
 
-Span<const MIFFile> ArenaLevelLibrary::getCityBlockMifs() const
+void ArenaLevelLibrary::loadCityBlockMif(CityBlockMifEntry &entry)
 {
-	return this->cityBlockMifs;
+	if (entry.isLoaded)
+	{
+		return;
+	}
+
+	entry.isValid = entry.mif.init(entry.mifName.c_str());
+	entry.isLoaded = true;
+
+	if (!entry.isValid)
+	{
+		DebugLogError("Could not init .MIF \"" + entry.mifName + "\".");
+	}
+}
+
+const MIFFile *ArenaLevelLibrary::tryGetCityBlockMif(const std::string &mifName)
+{
+	const auto iter = std::find_if(this->cityBlockMifEntries.begin(), this->cityBlockMifEntries.end(),
+		[&mifName](const CityBlockMifEntry &entry)
+	{
+		return entry.mifName == mifName;
+	});
+
+	if (iter == this->cityBlockMifEntries.end())
+	{
+		return nullptr;
+	}
+
+	std::lock_guard<std::mutex> lock(this->cityBlockMifMutex);
+	this->loadCityBlockMif(*iter);
+	return iter->isValid ? &iter->mif : nullptr;
+}
+
+void ArenaLevelLibrary::prefetchCityBlockMifs(JobSystem &jobSystem)
+{
+	if (jobSystem.getThreadCount() == 0)
+	{
+		// Nothing would run the jobs, blocks are loaded on demand instead.
+		return;
+	}
+
+	// One job per block so shutting down doesn't wait for all of them.
+	for (CityBlockMifEntry &entry : this->cityBlockMifEntries)
+	{
+		CityBlockMifEntry *entryPtr = &entry;
+		jobSystem.queueDetachedJob([this, entryPtr]()
+		{
+			std::lock_guard<std::mutex> lock(this->cityBlockMifMutex);
+			this->loadCityBlockMif(*entryPtr);
+		});
+	}
 }
 
 Span<const RMDFile> ArenaLevelLibrary::getWildernessChunks() const
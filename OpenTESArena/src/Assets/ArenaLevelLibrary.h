@@ -1,6 +1,10 @@
 #ifndef ARENA_LEVEL_LIBRARY_H
 #define ARENA_LEVEL_LIBRARY_H
 
+#include <mutex>
+#include <string>
+#include <vector>
+
 #include "MIFFile.h"
 #include "RMDFile.h"
 
@@ -8,18 +12,40 @@
 #include "components/utilities/Singleton.h"
 #include "components/utilities/Span.h"
 
+class JobSystem;
+
 class ArenaLevelLibrary : public Singleton<ArenaLevelLibrary>
 {
 private:
-	Buffer<MIFFile> cityBlockMifs;
+	// City block .MIFs are only registered by name at startup since a session only visits a few cities.
+	struct CityBlockMifEntry
+	{
+		std::string mifName;
+		MIFFile mif;
+		bool isLoaded;
+		bool isValid; // False if loading failed.
+
+		CityBlockMifEntry();
+	};
+
+	std::vector<CityBlockMifEntry> cityBlockMifEntries;
+	std::mutex cityBlockMifMutex; // Held while loading a city block, which prefetching can do on another thread.
 	Buffer<RMDFile> wildernessChunks; // WILD001 to WILD070.
 
 	bool initCityBlockMifs();
 	bool initWildernessChunks();
+
+	// Loads the city block if it isn't loaded yet. Must hold the mutex.
+	void loadCityBlockMif(CityBlockMifEntry &entry);
 public:
 	bool init();
 
-	Span<const MIFFile> getCityBlockMifs() const;
+	// Loads the city block .MIF the first time it's requested. Returns null if it doesn't exist or couldn't be loaded.
+	const MIFFile *tryGetCityBlockMif(const std::string &mifName);
+
+	// Loads the remaining city block .MIFs on the job system's idle threads so the first city doesn't have to.
+	void prefetchCityBlockMifs(JobSystem &jobSystem);
+
 	Span<const RMDFile> getWildernessChunks() const;
 };
 
@@ -0,0 +1,184 @@
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+
+#include "AssetCache.h"
+
+#include "components/debug/Debug.h"
+#include "components/utilities/Directory.h"
+
+namespace
+{
+	// Entry file header: magic, cache version, padding, source hash, and payload byte count.
+	constexpr uint32_t ENTRY_MAGIC = 0x4341544F; // "OTAC"
+	constexpr int ENTRY_HEADER_SIZE = (sizeof(uint32_t) * 3) + (sizeof(uint64_t) * 2);
+}
+
+void AssetCacheWriter::writeBytes(Span<const std::byte> values)
+{
+	this->bytes.insert(this->bytes.end(), values.begin(), values.end());
+}
+
+Span<const std::byte> AssetCacheWriter::getBytes() const
+{
+	return Span<const std::byte>(this->bytes.data(), static_cast<int>(this->bytes.size()));
+}
+
+AssetCacheReader::AssetCacheReader(Span<const std::byte> bytes)
+	: bytes(bytes)
+{
+	this->offset = 0;
+}
+
+bool AssetCacheReader::tryReadBytes(int count, Span<const std::byte> *outValues)
+{
+	if ((count < 0) || ((this->offset + count) > this->bytes.getCount()))
+	{
+		return false;
+	}
+
+	*outValues = Span<const std::byte>(this->bytes.begin() + this->offset, count);
+	this->offset += count;
+	return true;
+}
+
+bool AssetCacheReader::isAtEnd() const
+{
+	return this->offset == this->bytes.getCount();
+}
+
+void AssetCache::init(const std::string &directory)
+{
+	DebugAssert(!directory.empty());
+	if (!Directory::exists(directory.c_str()))
+	{
+		Directory::createRecursively(directory.c_str());
+	}
+
+	this->directory = directory;
+	if ((this->directory.back() != '/') && (this->directory.back() != '\\'))
+	{
+		this->directory += '/';
+	}
+}
+
+bool AssetCache::isEnabled() const
+{
+	return !this->directory.empty();
+}
+
+uint64_t AssetCache::hashBytes(Span<const std::byte> bytes)
+{
+	// 64-bit FNV-1a.
+	uint64_t hash = 0xCBF29CE484222325;
+	for (const std::byte value : bytes)
+	{
+		hash ^= static_cast<uint64_t>(value);
+		hash *= 0x100000001B3;
+	}
+
+	return hash;
+}
+
+std::string AssetCache::makeEntryPath(const char *entryName) const
+{
+	// Asset names are case-insensitive and might include folders.
+	std::string filename(entryName);
+	for (char &c : filename)
+	{
+		if ((c == '/') || (c == '\\') || (c == ':'))
+		{
+			c = '_';
+		}
+		else
+		{
+			c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+		}
+	}
+
+	return this->directory + filename + ".bin";
+}
+
+bool AssetCache::tryMapEntry(const char *entryName, uint64_t sourceHash, MappedFile *outFile, Span<const std::byte> *outPayload) const
+{
+	DebugAssert(this->isEnabled());
+
+	const std::string path = this->makeEntryPath(entryName);
+	std::error_code code;
+	if (!std::filesystem::exists(path, code))
+	{
+		return false;
+	}
+
+	if (!outFile->init(path.c_str()))
+	{
+		return false;
+	}
+
+	AssetCacheReader reader(outFile->getBytes());
+	uint32_t magic, version, padding;
+	uint64_t entrySourceHash, payloadSize;
+	if (!reader.tryRead(&magic) || !reader.tryRead(&version) || !reader.tryRead(&padding) ||
+		!reader.tryRead(&entrySourceHash) || !reader.tryRead(&payloadSize))
+	{
+		return false;
+	}
+
+	if ((magic != ENTRY_MAGIC) || (version != AssetCache::VERSION) || (entrySourceHash != sourceHash))
+	{
+		// Stale, gets replaced once the asset is decoded again.
+		return false;
+	}
+
+	if (!reader.tryReadBytes(static_cast<int>(payloadSize), outPayload) || !reader.isAtEnd())
+	{
+		DebugLogWarningFormat("Asset cache entry \"%s\" is truncated.", path.c_str());
+		return false;
+	}
+
+	return true;
+}
+
+void AssetCache::writeEntry(const char *entryName, uint64_t sourceHash, Span<const std::byte> payload) const
+{
+	DebugAssert(this->isEnabled());
+
+	AssetCacheWriter headerWriter;
+	headerWriter.write<uint32_t>(ENTRY_MAGIC);
+	headerWriter.write<uint32_t>(AssetCache::VERSION);
+	headerWriter.write<uint32_t>(0);
+	headerWriter.write<uint64_t>(sourceHash);
+	headerWriter.write<uint64_t>(static_cast<uint64_t>(payload.getCount()));
+
+	const Span<const std::byte> headerBytes = headerWriter.getBytes();
+	DebugAssert(headerBytes.getCount() == ENTRY_HEADER_SIZE);
+
+	// Write next to the entry first so a crash mid-write never leaves a partial entry behind.
+	const std::string path = this->makeEntryPath(entryName);
+	const std::string tempPath = path + ".tmp";
+	std::ofstream ofs(tempPath, std::ios::binary | std::ios::trunc);
+	if (!ofs.is_open())
+	{
+		DebugLogWarningFormat("Couldn't open asset cache entry \"%s\" for writing.", tempPath.c_str());
+		return;
+	}
+
+	ofs.write(reinterpret_cast<const char*>(headerBytes.begin()), headerBytes.getCount());
+	ofs.write(reinterpret_cast<const char*>(payload.begin()), payload.getCount());
+	ofs.close();
+
+	std::error_code code;
+	if (!ofs.good())
+	{
+		DebugLogWarningFormat("Couldn't write asset cache entry \"%s\".", tempPath.c_str());
+		std::filesystem::remove(tempPath, code);
+		return;
+	}
+
+	std::filesystem::rename(tempPath, path, code);
+	if (code)
+	{
+		DebugLogWarningFormat("Couldn't replace asset cache entry \"%s\" (%s).", path.c_str(), code.message().c_str());
+		std::filesystem::remove(tempPath, code);
+	}
+}
@@ -0,0 +1,88 @@
+#ifndef ASSET_CACHE_H
+#define ASSET_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "components/utilities/MappedFile.h"
+#include "components/utilities/Singleton.h"
+#include "components/utilities/Span.h"
+
+// Appends plain values to an asset cache entry payload.
+class AssetCacheWriter
+{
+private:
+	std::vector<std::byte> bytes;
+public:
+	template<typename T>
+	void write(T value)
+	{
+		const size_t index = this->bytes.size();
+		this->bytes.resize(index + sizeof(T));
+		std::memcpy(this->bytes.data() + index, &value, sizeof(T));
+	}
+
+	void writeBytes(Span<const std::byte> values);
+
+	Span<const std::byte> getBytes() const;
+};
+
+// Reads plain values back from an asset cache entry payload, failing instead of reading past the end.
+class AssetCacheReader
+{
+private:
+	Span<const std::byte> bytes;
+	int offset;
+public:
+	AssetCacheReader(Span<const std::byte> bytes);
+
+	template<typename T>
+	bool tryRead(T *outValue)
+	{
+		if ((this->offset + static_cast<int>(sizeof(T))) > this->bytes.getCount())
+		{
+			return false;
+		}
+
+		std::memcpy(outValue, this->bytes.begin() + this->offset, sizeof(T));
+		this->offset += static_cast<int>(sizeof(T));
+		return true;
+	}
+
+	// Points into the payload without copying.
+	bool tryReadBytes(int count, Span<const std::byte> *outValues);
+
+	bool isAtEnd() const;
+};
+
+// Optional on-disk cache of decoded assets so later launches can skip decoding them. Each entry is one file with a
+// flat payload that is memory-mapped when read. Entries are only used if they were made from the same source bytes
+// by the same cache version, otherwise they get rebuilt. Can be used from several threads at once as long as each
+// entry is only used by one of them.
+class AssetCache : public Singleton<AssetCache>
+{
+private:
+	std::string directory; // Empty if disabled.
+
+	std::string makeEntryPath(const char *entryName) const;
+public:
+	// Bump when any payload layout changes.
+	static constexpr uint32_t VERSION = 1;
+
+	void init(const std::string &directory);
+
+	bool isEnabled() const;
+
+	static uint64_t hashBytes(Span<const std::byte> bytes);
+
+	// Maps the entry and points at its payload. Fails if there's no usable entry.
+	bool tryMapEntry(const char *entryName, uint64_t sourceHash, MappedFile *outFile, Span<const std::byte> *outPayload) const;
+
+	// Replaces the entry. A failed write only costs decoding the asset again next launch.
+	void writeEntry(const char *entryName, uint64_t sourceHash, Span<const std::byte> payload) const;
+};
+
+#endif
@@ -12,8 +12,9 @@
 
 bool CFAFile::init(const char *filename)
 {
-	Buffer<std::byte> src;
-	if (!VFS::Manager::get().read(filename, &src))
+	Buffer<std::byte> srcBuffer;
+	Span<const std::byte> src;
+	if (!VFS::Manager::get().readView(filename, &srcBuffer, &src))
 	{
 		DebugLogError("Could not read \"" + std::string(filename) + "\".");
 		return false;
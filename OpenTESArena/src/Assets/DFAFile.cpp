@@ -11,8 +11,9 @@
 
 bool DFAFile::init(const char *filename)
 {
-	Buffer<std::byte> src;
-	if (!VFS::Manager::get().read(filename, &src))
+	Buffer<std::byte> srcBuffer;
+	Span<const std::byte> src;
+	if (!VFS::Manager::get().readView(filename, &srcBuffer, &src))
 	{
 		DebugLogError("Could not read \"" + std::string(filename) + "\".");
 		return false;
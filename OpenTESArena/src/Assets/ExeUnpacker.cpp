@@ -1,8 +1,10 @@
 #include <algorithm>
 #include <array>
+#include <cstring>
 #include <memory>
 #include <string>
 
+#include "AssetCache.h"
 #include "ExeUnpacker.h"
 
 #include "components/debug/Debug.h"
@@ -272,6 +274,24 @@ bool ExeUnpacker::init(const char *filename)
 		return false;
 	}
 
+	// Unpacking is deterministic so a cached copy made from the same executable can be used instead.
+	const AssetCache &assetCache = AssetCache::getInstance();
+	const std::string cacheEntryName = std::string(filename) + ".UNPACKED";
+	uint64_t srcHash = 0;
+	if (assetCache.isEnabled())
+	{
+		srcHash = AssetCache::hashBytes(src);
+
+		MappedFile entryFile;
+		Span<const std::byte> payload;
+		if (assetCache.tryMapEntry(cacheEntryName.c_str(), srcHash, &entryFile, &payload))
+		{
+			this->exeData.init(payload.getCount());
+			std::memcpy(this->exeData.begin(), payload.begin(), payload.getCount());
+			return true;
+		}
+	}
+
 	const uint8_t *srcPtr = reinterpret_cast<const uint8_t*>(src.begin());
 
 	// Generate the bit trees for "duplication mode". Since the Duplication1 table has 
@@ -497,6 +517,12 @@ bool ExeUnpacker::init(const char *filename)
 		}
 	}
 
+	if (assetCache.isEnabled())
+	{
+		const Span<const std::byte> exeBytes(reinterpret_cast<const std::byte*>(this->exeData.begin()), this->exeData.getCount());
+		assetCache.writeEntry(cacheEntryName.c_str(), srcHash, exeBytes);
+	}
+
 	return true;
 }
 
@@ -81,8 +81,9 @@ bool IMGFile::init(const char *filename)
 		return true;
 	}
 
-	Buffer<std::byte> src;
-	if (!VFS::Manager::get().read(filename, &src))
+	Buffer<std::byte> srcBuffer;
+	Span<const std::byte> src;
+	if (!VFS::Manager::get().readView(filename, &srcBuffer, &src))
 	{
 		DebugLogError("Could not read \"" + std::string(filename) + "\".");
 		return false;
@@ -240,8 +241,9 @@ Palette IMGFile::readPalette(const uint8_t *paletteData)
 
 bool IMGFile::tryExtractPalette(const char *filename, Palette &palette)
 {
-	Buffer<std::byte> src;
-	if (!VFS::Manager::get().read(filename, &src))
+	Buffer<std::byte> srcBuffer;
+	Span<const std::byte> src;
+	if (!VFS::Manager::get().readView(filename, &srcBuffer, &src))
 	{
 		DebugLogError("Could not read \"" + std::string(filename) + "\".");
 		return false;
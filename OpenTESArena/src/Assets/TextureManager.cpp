@@ -1,7 +1,10 @@
+#include <cstring>
+
 #include "SDL.h"
 
 #include "TextureManager.h"
 #include "../Assets/ArenaAssetUtils.h"
+#include "../Assets/AssetCache.h"
 #include "../Assets/CFAFile.h"
 #include "../Assets/CIFFile.h"
 #include "../Assets/COLFile.h"
@@ -23,11 +26,164 @@
 #include "components/utilities/Bytes.h"
 #include "components/utilities/String.h"
 #include "components/utilities/StringView.h"
+#include "components/vfs/manager.hpp"
 
 namespace
 {
 	// Texture filename extensions.
 	constexpr const char *EXTENSION_BMP = "BMP";
+
+	// Asset cache payload: texture count, then width/height/bytes per texel of each texture, then the metadata's
+	// dimensions, offsets, and seconds per frame, then all texels in order.
+	void WriteTextureCachePayload(const Buffer<TextureBuilder> &textures, const TextureFileMetadata &metadata,
+		AssetCacheWriter &writer)
+	{
+		writer.write<int32_t>(textures.getCount());
+		for (const TextureBuilder &texture : textures)
+		{
+			writer.write<int32_t>(texture.width);
+			writer.write<int32_t>(texture.height);
+			writer.write<int32_t>(texture.bytesPerTexel);
+		}
+
+		const int metadataTextureCount = metadata.getTextureCount();
+		writer.write<int32_t>(metadataTextureCount);
+		for (int i = 0; i < metadataTextureCount; i++)
+		{
+			writer.write<int32_t>(metadata.getWidth(i));
+			writer.write<int32_t>(metadata.getHeight(i));
+		}
+
+		writer.write<uint8_t>(metadata.hasOffsets() ? 1 : 0);
+		if (metadata.hasOffsets())
+		{
+			for (int i = 0; i < metadataTextureCount; i++)
+			{
+				const Int2 &offset = metadata.getOffset(i);
+				writer.write<int32_t>(offset.x);
+				writer.write<int32_t>(offset.y);
+			}
+		}
+
+		writer.write<uint8_t>(metadata.isMovie() ? 1 : 0);
+		if (metadata.isMovie())
+		{
+			writer.write<double>(metadata.getSecondsPerFrame());
+		}
+
+		for (const TextureBuilder &texture : textures)
+		{
+			writer.writeBytes(texture.bytes);
+		}
+	}
+
+	bool TryReadTextureCachePayload(Span<const std::byte> payload, const char *filename, Buffer<TextureBuilder> *outTextures,
+		TextureFileMetadata *outMetadata)
+	{
+		AssetCacheReader reader(payload);
+		int32_t textureCount;
+		if (!reader.tryRead(&textureCount) || (textureCount < 0))
+		{
+			return false;
+		}
+
+		Buffer<TextureBuilder> textures(textureCount);
+		for (TextureBuilder &texture : textures)
+		{
+			int32_t width, height, bytesPerTexel;
+			if (!reader.tryRead(&width) || !reader.tryRead(&height) || !reader.tryRead(&bytesPerTexel) ||
+				(width < 0) || (height < 0) || (bytesPerTexel <= 0))
+			{
+				return false;
+			}
+
+			texture.width = width;
+			texture.height = height;
+			texture.bytesPerTexel = bytesPerTexel;
+		}
+
+		int32_t metadataTextureCount;
+		if (!reader.tryRead(&metadataTextureCount) || (metadataTextureCount < 0))
+		{
+			return false;
+		}
+
+		Buffer<Int2> dimensions(metadataTextureCount);
+		for (Int2 &dimension : dimensions)
+		{
+			if (!reader.tryRead(&dimension.x) || !reader.tryRead(&dimension.y))
+			{
+				return false;
+			}
+		}
+
+		uint8_t hasOffsets;
+		if (!reader.tryRead(&hasOffsets))
+		{
+			return false;
+		}
+
+		Buffer<Int2> offsets;
+		if (hasOffsets != 0)
+		{
+			offsets.init(metadataTextureCount);
+			for (Int2 &offset : offsets)
+			{
+				if (!reader.tryRead(&offset.x) || !reader.tryRead(&offset.y))
+				{
+					return false;
+				}
+			}
+		}
+
+		uint8_t isMovie;
+		double secondsPerFrame = 0.0;
+		if (!reader.tryRead(&isMovie) || ((isMovie != 0) && !reader.tryRead(&secondsPerFrame)))
+		{
+			return false;
+		}
+
+		// Texels are copied out since the mapping goes away after this.
+		for (TextureBuilder &texture : textures)
+		{
+			Span<const std::byte> texels;
+			if (!reader.tryReadBytes(texture.width * texture.height * texture.bytesPerTexel, &texels))
+			{
+				return false;
+			}
+
+			texture.bytes.init(texels.getCount());
+			std::memcpy(texture.bytes.begin(), texels.begin(), texels.getCount());
+		}
+
+		if (!reader.isAtEnd())
+		{
+			return false;
+		}
+
+		if (outTextures != nullptr)
+		{
+			*outTextures = std::move(textures);
+		}
+
+		if (outMetadata != nullptr)
+		{
+			if (hasOffsets != 0)
+			{
+				outMetadata->init(std::string(filename), std::move(dimensions), std::move(offsets));
+			}
+			else if (isMovie != 0)
+			{
+				outMetadata->init(std::string(filename), std::move(dimensions), secondsPerFrame);
+			}
+			else
+			{
+				outMetadata->init(std::string(filename), std::move(dimensions));
+			}
+		}
+
+		return true;
+	}
 }
 
 bool TextureManager::matchesExtension(const char *filename, const char *extension)
@@ -87,7 +243,7 @@ bool TextureManager::tryLoadPalettes(const char *filename, Buffer<Palette> *outP
 	return true;
 }
 
-bool TextureManager::tryLoadTextureData(const char *filename, Buffer<TextureBuilder> *outTextures, TextureFileMetadata *outMetadata)
+bool TextureManager::tryDecodeTextureData(const char *filename, Buffer<TextureBuilder> *outTextures, TextureFileMetadata *outMetadata)
 {
 	// Need at least one non-null out parameter.
 	DebugAssert((outTextures != nullptr) || (outMetadata != nullptr));
@@ -396,6 +552,61 @@ bool TextureManager::tryLoadTextureData(const char *filename, Buffer<TextureBuil
 	return true;
 }
 
+bool TextureManager::tryLoadTextureData(const char *filename, Buffer<TextureBuilder> *outTextures, TextureFileMetadata *outMetadata)
+{
+	const AssetCache &assetCache = AssetCache::getInstance();
+	if (!assetCache.isEnabled() || TextureManager::matchesExtension(filename, EXTENSION_BMP))
+	{
+		return TextureManager::tryDecodeTextureData(filename, outTextures, outMetadata);
+	}
+
+	VFS::Manager &vfs = VFS::Manager::get();
+	Buffer<std::byte> srcBuffer;
+	Span<const std::byte> src;
+	if (!vfs.exists(filename) || !vfs.readView(filename, &srcBuffer, &src))
+	{
+		return TextureManager::tryDecodeTextureData(filename, outTextures, outMetadata);
+	}
+
+	const uint64_t sourceHash = AssetCache::hashBytes(src);
+	const std::string entryName = std::string(filename) + ".TEX";
+
+	MappedFile entryFile;
+	Span<const std::byte> payload;
+	if (assetCache.tryMapEntry(entryName.c_str(), sourceHash, &entryFile, &payload) &&
+		TryReadTextureCachePayload(payload, filename, outTextures, outMetadata))
+	{
+		return true;
+	}
+
+	// Decode everything so the entry can serve both texture and metadata requests.
+	Buffer<TextureBuilder> textures;
+	TextureFileMetadata metadata;
+	if (!TextureManager::tryDecodeTextureData(filename, &textures, &metadata))
+	{
+		return false;
+	}
+
+	// Can't replace a file that's still mapped on some platforms.
+	entryFile.clear();
+
+	AssetCacheWriter writer;
+	WriteTextureCachePayload(textures, metadata, writer);
+	assetCache.writeEntry(entryName.c_str(), sourceHash, writer.getBytes());
+
+	if (outTextures != nullptr)
+	{
+		*outTextures = std::move(textures);
+	}
+
+	if (outMetadata != nullptr)
+	{
+		*outMetadata = std::move(metadata);
+	}
+
+	return true;
+}
+
 std::optional<PaletteIdGroup> TextureManager::tryGetPaletteIDs(const char *filename)
 {
 	if (String::isNullOrEmpty(filename))
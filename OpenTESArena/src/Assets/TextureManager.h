@@ -36,6 +36,10 @@ private:
 
 	// Helper functions for loading texture files.
 	static bool tryLoadPalettes(const char *filename, Buffer<Palette> *outPalettes);
+	static bool tryDecodeTextureData(const char *filename, Buffer<TextureBuilder> *outTextures,
+		TextureFileMetadata *outMetadata);
+
+	// Same as decoding but goes through the asset cache when it's enabled.
 	static bool tryLoadTextureData(const char *filename, Buffer<TextureBuilder> *outTextures,
 		TextureFileMetadata *outMetadata);
 public:
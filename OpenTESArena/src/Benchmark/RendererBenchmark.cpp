@@ -0,0 +1,1091 @@
+// Headless benchmark for the software renderer. Renders deterministic procedural scenes along a scripted camera
+// path into an offscreen buffer (no window, no SDL renderer, no game data) and prints per-frame statistics as JSON.
+//
+// Usage: otesa_renderer_benchmark [--scene all|city|dungeon|wilderness] [--chunk-distance N] [--frames N]
+//   [--warmup N] [--width N] [--height N] [--threads MODE] [--seed N] [--output PATH]
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "../Math/MathUtils.h"
+#include "../Math/Matrix4.h"
+#include "../Math/Random.h"
+#include "../Math/Vector3.h"
+#include "../Rendering/RenderBackend.h"
+#include "../Rendering/RenderBuffer.h"
+#include "../Rendering/RenderCamera.h"
+#include "../Rendering/RenderCommand.h"
+#include "../Rendering/RenderDrawCall.h"
+#include "../Rendering/RenderFrameSettings.h"
+#include "../Rendering/RenderInitSettings.h"
+#include "../Rendering/RenderMaterialUtils.h"
+#include "../Rendering/RenderTextureUtils.h"
+#include "../Rendering/RendererUtils.h"
+#include "../Rendering/SoftwareRasterizerKernels.h"
+#include "../Rendering/SoftwareRenderer.h"
+#include "../Utilities/Color.h"
+#include "../World/ChunkUtils.h"
+#include "../World/Coord.h"
+#include "../World/MeshUtils.h"
+
+#include "components/debug/Debug.h"
+#include "components/utilities/Buffer2D.h"
+#include "components/utilities/Span.h"
+
+namespace
+{
+	enum class BenchmarkSceneType
+	{
+		City,
+		Dungeon,
+		Wilderness
+	};
+
+	constexpr BenchmarkSceneType BENCHMARK_SCENE_TYPES[] = { BenchmarkSceneType::City, BenchmarkSceneType::Dungeon, BenchmarkSceneType::Wilderness };
+
+	constexpr const char *BENCHMARK_SCENE_NAMES[] = { "city", "dungeon", "wilderness" };
+	static_assert(std::size(BENCHMARK_SCENE_NAMES) == std::size(BENCHMARK_SCENE_TYPES));
+
+	const char *GetSceneName(BenchmarkSceneType type)
+	{
+		const int index = static_cast<int>(type);
+		DebugAssertIndex(BENCHMARK_SCENE_NAMES, index);
+		return BENCHMARK_SCENE_NAMES[index];
+	}
+
+	struct BenchmarkArgs
+	{
+		std::vector<BenchmarkSceneType> sceneTypes;
+		int chunkDistance;
+		int frameCount;
+		int warmupFrameCount;
+		int width, height;
+		int renderThreadsMode;
+		int seed;
+		std::string outputPath; // Empty for stdout.
+
+		BenchmarkArgs()
+		{
+			this->sceneTypes.assign(std::begin(BENCHMARK_SCENE_TYPES), std::end(BENCHMARK_SCENE_TYPES));
+			this->chunkDistance = 1;
+			this->frameCount = 120;
+			this->warmupFrameCount = 10;
+			this->width = 640;
+			this->height = 400;
+			this->renderThreadsMode = 4;
+			this->seed = 12345;
+		}
+	};
+
+	void PrintUsage()
+	{
+		std::cerr << "Usage: otesa_renderer_benchmark [--scene all|city|dungeon|wilderness] [--chunk-distance N] [--frames N] "
+			"[--warmup N] [--width N] [--height N] [--threads MODE] [--seed N] [--output PATH]\n";
+	}
+
+	bool TryParseInt(const char *str, int minValue, int maxValue, int *outValue)
+	{
+		char *end = nullptr;
+		const long value = std::strtol(str, &end, 10);
+		if ((end == str) || (*end != '\0') || (value < minValue) || (value > maxValue))
+		{
+			return false;
+		}
+
+		*outValue = static_cast<int>(value);
+		return true;
+	}
+
+	bool TryParseArgs(int argc, char *argv[], BenchmarkArgs *outArgs)
+	{
+		for (int i = 1; i < argc; i++)
+		{
+			const std::string arg = argv[i];
+			if ((i + 1) >= argc)
+			{
+				std::cerr << "Missing value for \"" << arg << "\".\n";
+				return false;
+			}
+
+			const char *value = argv[i + 1];
+			i++;
+
+			bool success = true;
+			if (arg == "--scene")
+			{
+				const std::string sceneName = value;
+				outArgs->sceneTypes.clear();
+				if (sceneName == "all")
+				{
+					outArgs->sceneTypes.assign(std::begin(BENCHMARK_SCENE_TYPES), std::end(BENCHMARK_SCENE_TYPES));
+				}
+				else
+				{
+					for (const BenchmarkSceneType sceneType : BENCHMARK_SCENE_TYPES)
+					{
+						if (sceneName == GetSceneName(sceneType))
+						{
+							outArgs->sceneTypes.emplace_back(sceneType);
+						}
+					}
+
+					success = !outArgs->sceneTypes.empty();
+				}
+			}
+			else if (arg == "--chunk-distance")
+			{
+				success = TryParseInt(value, 0, 8, &outArgs->chunkDistance);
+			}
+			else if (arg == "--frames")
+			{
+				success = TryParseInt(value, 1, 100000, &outArgs->frameCount);
+			}
+			else if (arg == "--warmup")
+			{
+				success = TryParseInt(value, 0, 100000, &outArgs->warmupFrameCount);
+			}
+			else if (arg == "--width")
+			{
+				success = TryParseInt(value, 16, 16384, &outArgs->width);
+			}
+			else if (arg == "--height")
+			{
+				success = TryParseInt(value, 16, 16384, &outArgs->height);
+			}
+			else if (arg == "--threads")
+			{
+				success = TryParseInt(value, 0, 5, &outArgs->renderThreadsMode);
+			}
+			else if (arg == "--seed")
+			{
+				success = TryParseInt(value, 0, 0x7FFFFFFF, &outArgs->seed);
+			}
+			else if (arg == "--output")
+			{
+				outArgs->outputPath = value;
+			}
+			else
+			{
+				std::cerr << "Unrecognized argument \"" << arg << "\".\n";
+				return false;
+			}
+
+			if (!success)
+			{
+				std::cerr << "Invalid value \"" << value << "\" for \"" << arg << "\".\n";
+				return false;
+			}
+		}
+
+		return true;
+	}
+}
+
+// Procedural content. Palette indices are laid out as 16 hues of 16 shades each so the light table can darken
+// any texel without knowing what it is. Index 0 stays transparent for alpha testing.
+namespace
+{
+	constexpr int PALETTE_HUE_COUNT = 16;
+	constexpr int PALETTE_SHADE_COUNT = 16;
+	constexpr int LIGHT_LEVEL_COUNT = 13;
+	constexpr int TEXTURE_DIM = 64;
+
+	constexpr double EYE_HEIGHT = 0.60;
+	constexpr double STREET_CENTER_Z = 33.0; // Local Z of the hallway/street the camera travels along in every chunk.
+	constexpr double LIGHT_START_RADIUS = 1.0;
+	constexpr double LIGHT_END_RADIUS = 4.0;
+	constexpr int MAX_BENCHMARK_LIGHTS = 64;
+
+	enum class BenchmarkTextureType
+	{
+		Brick,
+		Stone,
+		Cobblestone,
+		Grass,
+		Ceiling,
+		Tree,
+
+		Count
+	};
+
+	enum class BenchmarkMeshType
+	{
+		Box, // Five sides, no bottom.
+		Walls, // Four sides, for voxels under a ceiling.
+		FloorPatch,
+		CeilingPatch,
+		Cross, // Two intersecting quads for vegetation/billboard-like sprites.
+
+		Count
+	};
+
+	constexpr int BENCHMARK_TEXTURE_TYPE_COUNT = static_cast<int>(BenchmarkTextureType::Count);
+	constexpr int BENCHMARK_MESH_TYPE_COUNT = static_cast<int>(BenchmarkMeshType::Count);
+	constexpr int PATCH_VOXELS = 16; // Floor/ceiling patch side length, keeps each patch under the renderer's per-mesh triangle limit.
+	static_assert((ChunkUtils::CHUNK_DIM % PATCH_VOXELS) == 0);
+
+	uint8_t MakePaletteIndex(int hue, int shade)
+	{
+		const int index = (hue * PALETTE_SHADE_COUNT) + std::clamp(shade, 0, PALETTE_SHADE_COUNT - 1);
+		return static_cast<uint8_t>(std::max(index, 1));
+	}
+
+	struct BenchmarkMesh
+	{
+		VertexPositionBufferID positionBufferID;
+		VertexAttributeBufferID normalBufferID;
+		VertexAttributeBufferID texCoordBufferID;
+		IndexBufferID indexBufferID;
+		int triangleCount;
+	};
+
+	struct BenchmarkMeshBuilder
+	{
+		std::vector<double> positions;
+		std::vector<double> normals;
+		std::vector<double> texCoords;
+		std::vector<int32_t> indices;
+
+		// Vertex order matches the voxel face meshes in data/meshes.
+		void addQuad(const Double3 &v0, const Double3 &v1, const Double3 &v2, const Double3 &v3, const Double3 &normal)
+		{
+			const int32_t firstIndex = static_cast<int32_t>(this->positions.size() / MeshUtils::POSITION_COMPONENTS_PER_VERTEX);
+			const Double3 vertices[] = { v0, v1, v2, v3 };
+			constexpr double texCoords[] = { 0.0, 0.0, 0.0, 1.0, 1.0, 1.0, 1.0, 0.0 };
+			for (const Double3 &vertex : vertices)
+			{
+				this->positions.insert(this->positions.end(), { vertex.x, vertex.y, vertex.z });
+				this->normals.insert(this->normals.end(), { normal.x, normal.y, normal.z });
+			}
+
+			this->texCoords.insert(this->texCoords.end(), std::begin(texCoords), std::end(texCoords));
+
+			for (const int32_t index : MeshUtils::DefaultQuadVertexIndices)
+			{
+				this->indices.emplace_back(firstIndex + index);
+			}
+		}
+	};
+
+	void WriteBoxSides(BenchmarkMeshBuilder &builder)
+	{
+		builder.addQuad(Double3(1.0, 1.0, 0.0), Double3(1.0, 0.0, 0.0), Double3(0.0, 0.0, 0.0), Double3(0.0, 1.0, 0.0), -Double3::UnitZ);
+		builder.addQuad(Double3(0.0, 1.0, 0.0), Double3(0.0, 0.0, 0.0), Double3(0.0, 0.0, 1.0), Double3(0.0, 1.0, 1.0), -Double3::UnitX);
+		builder.addQuad(Double3(1.0, 1.0, 1.0), Double3(1.0, 0.0, 1.0), Double3(1.0, 0.0, 0.0), Double3(1.0, 1.0, 0.0), Double3::UnitX);
+		builder.addQuad(Double3(0.0, 1.0, 1.0), Double3(0.0, 0.0, 1.0), Double3(1.0, 0.0, 1.0), Double3(1.0, 1.0, 1.0), Double3::UnitZ);
+	}
+
+	void WriteMeshGeometry(BenchmarkMeshType type, BenchmarkMeshBuilder &builder)
+	{
+		switch (type)
+		{
+		case BenchmarkMeshType::Box:
+			WriteBoxSides(builder);
+			builder.addQuad(Double3(0.0, 1.0, 1.0), Double3(1.0, 1.0, 1.0), Double3(1.0, 1.0, 0.0), Double3(0.0, 1.0, 0.0), Double3::UnitY);
+			break;
+		case BenchmarkMeshType::Walls:
+			WriteBoxSides(builder);
+			break;
+		case BenchmarkMeshType::FloorPatch:
+		case BenchmarkMeshType::CeilingPatch:
+			for (int z = 0; z < PATCH_VOXELS; z++)
+			{
+				for (int x = 0; x < PATCH_VOXELS; x++)
+				{
+					const double x0 = static_cast<double>(x);
+					const double z0 = static_cast<double>(z);
+					const double x1 = x0 + 1.0;
+					const double z1 = z0 + 1.0;
+					if (type == BenchmarkMeshType::FloorPatch)
+					{
+						builder.addQuad(Double3(x0, 0.0, z0), Double3(x0, 0.0, z1), Double3(x1, 0.0, z1), Double3(x1, 0.0, z0), Double3::UnitY);
+					}
+					else
+					{
+						builder.addQuad(Double3(x0, 0.0, z0), Double3(x1, 0.0, z0), Double3(x1, 0.0, z1), Double3(x0, 0.0, z1), -Double3::UnitY);
+					}
+				}
+			}
+			break;
+		case BenchmarkMeshType::Cross:
+			builder.addQuad(Double3(0.0, 1.0, 0.5), Double3(0.0, 0.0, 0.5), Double3(1.0, 0.0, 0.5), Double3(1.0, 1.0, 0.5), Double3::UnitZ);
+			builder.addQuad(Double3(0.5, 1.0, 0.0), Double3(0.5, 0.0, 0.0), Double3(0.5, 0.0, 1.0), Double3(0.5, 1.0, 1.0), -Double3::UnitX);
+			break;
+		default:
+			DebugNotImplementedMsg(std::to_string(static_cast<int>(type)));
+			break;
+		}
+	}
+
+	void WriteTextureTexels(BenchmarkTextureType type, Span2D<uint8_t> texels)
+	{
+		const int width = texels.getWidth();
+		const int height = texels.getHeight();
+		for (int y = 0; y < height; y++)
+		{
+			for (int x = 0; x < width; x++)
+			{
+				// Cheap deterministic noise so texture sampling isn't trivially cache-friendly.
+				const uint32_t noise = ((static_cast<uint32_t>(x) * 73856093u) ^ (static_cast<uint32_t>(y) * 19349663u) ^ (static_cast<uint32_t>(type) * 83492791u)) % 5u;
+				const int shade = 10 + static_cast<int>(noise);
+
+				uint8_t texel = 0;
+				switch (type)
+				{
+				case BenchmarkTextureType::Brick:
+				{
+					const int row = y / 8;
+					const bool isMortar = ((y % 8) == 0) || (((x + ((row & 1) * 8)) % 16) == 0);
+					texel = isMortar ? MakePaletteIndex(0, 8) : MakePaletteIndex(1, shade);
+					break;
+				}
+				case BenchmarkTextureType::Stone:
+					texel = (((x / 16) + (y / 16)) & 1) ? MakePaletteIndex(2, shade) : MakePaletteIndex(2, shade - 3);
+					break;
+				case BenchmarkTextureType::Cobblestone:
+					texel = (((x % 8) == 0) || ((y % 8) == 0)) ? MakePaletteIndex(0, 6) : MakePaletteIndex(3, shade);
+					break;
+				case BenchmarkTextureType::Grass:
+					texel = MakePaletteIndex(4, shade - static_cast<int>((x ^ y) & 3));
+					break;
+				case BenchmarkTextureType::Ceiling:
+					texel = MakePaletteIndex(5, shade - 4);
+					break;
+				case BenchmarkTextureType::Tree:
+				{
+					// Trunk plus a round canopy, everything else transparent.
+					const int dx = x - (width / 2);
+					const int dy = y - (height / 3);
+					const bool isTrunk = (std::abs(dx) < 3) && (y >= (height / 3));
+					const bool isCanopy = ((dx * dx) + (dy * dy)) < ((width * width) / 9);
+					if (isCanopy)
+					{
+						texel = MakePaletteIndex(4, shade - 2);
+					}
+					else if (isTrunk)
+					{
+						texel = MakePaletteIndex(6, shade - 4);
+					}
+
+					break;
+				}
+				default:
+					DebugNotImplementedMsg(std::to_string(static_cast<int>(type)));
+					break;
+				}
+
+				texels.set(x, y, texel);
+			}
+		}
+	}
+
+	struct BenchmarkInstance
+	{
+		BenchmarkMeshType meshType;
+		BenchmarkTextureType textureType;
+		WorldDouble3 position;
+		Double3 scale;
+	};
+
+	struct BenchmarkScene
+	{
+		std::vector<BenchmarkInstance> instances;
+		std::vector<WorldDouble3> lightPositions;
+		double ambientPercent;
+		RenderLightingType lightingType;
+		Color clearColor;
+		int chunkCount;
+		int minVoxelX, maxVoxelX; // Camera path extent along X.
+	};
+
+	bool IsStreetVoxel(int localZ)
+	{
+		return (localZ == 32) || (localZ == 33);
+	}
+
+	void AddPatches(BenchmarkScene &scene, BenchmarkMeshType meshType, BenchmarkTextureType textureType, double y, int chunkX, int chunkZ)
+	{
+		for (int patchZ = 0; patchZ < ChunkUtils::CHUNK_DIM; patchZ += PATCH_VOXELS)
+		{
+			for (int patchX = 0; patchX < ChunkUtils::CHUNK_DIM; patchX += PATCH_VOXELS)
+			{
+				const WorldDouble3 position(
+					static_cast<double>((chunkX * ChunkUtils::CHUNK_DIM) + patchX),
+					y,
+					static_cast<double>((chunkZ * ChunkUtils::CHUNK_DIM) + patchZ));
+				scene.instances.push_back({ meshType, textureType, position, Double3(1.0, 1.0, 1.0) });
+			}
+		}
+	}
+
+	void AddCityChunk(BenchmarkScene &scene, int chunkX, int chunkZ, Random &random)
+	{
+		AddPatches(scene, BenchmarkMeshType::FloorPatch, BenchmarkTextureType::Cobblestone, 0.0, chunkX, chunkZ);
+
+		// 8x8 voxel blocks with two-voxel streets between them.
+		constexpr int blockDim = 8;
+		constexpr int streetWidth = 2;
+		const double chunkOriginX = static_cast<double>(chunkX * ChunkUtils::CHUNK_DIM);
+		const double chunkOriginZ = static_cast<double>(chunkZ * ChunkUtils::CHUNK_DIM);
+		for (int blockZ = 0; blockZ < ChunkUtils::CHUNK_DIM; blockZ += blockDim)
+		{
+			for (int blockX = 0; blockX < ChunkUtils::CHUNK_DIM; blockX += blockDim)
+			{
+				const bool isPlaza = random.next(8) == 0;
+				if (!isPlaza)
+				{
+					const double buildingDim = static_cast<double>(blockDim - streetWidth);
+					const double buildingHeight = static_cast<double>(2 + random.next(5));
+					const BenchmarkTextureType textureType = random.nextBool() ? BenchmarkTextureType::Brick : BenchmarkTextureType::Stone;
+					const WorldDouble3 position(chunkOriginX + blockX + streetWidth, 0.0, chunkOriginZ + blockZ + streetWidth);
+					scene.instances.push_back({ BenchmarkMeshType::Box, textureType, position, Double3(buildingDim, buildingHeight, buildingDim) });
+				}
+
+				// A tree or statue on the street corner.
+				if (random.next(3) == 0)
+				{
+					const WorldDouble3 position(chunkOriginX + blockX + 0.5, 0.0, chunkOriginZ + blockZ);
+					scene.instances.push_back({ BenchmarkMeshType::Cross, BenchmarkTextureType::Tree, position, Double3(1.0, 2.0, 1.0) });
+				}
+			}
+		}
+	}
+
+	void AddDungeonChunk(BenchmarkScene &scene, int chunkX, int chunkZ, Random &random)
+	{
+		AddPatches(scene, BenchmarkMeshType::FloorPatch, BenchmarkTextureType::Stone, 0.0, chunkX, chunkZ);
+		AddPatches(scene, BenchmarkMeshType::CeilingPatch, BenchmarkTextureType::Ceiling, 1.0, chunkX, chunkZ);
+
+		// 4x4 voxel rooms with walls on their edges and random openings, one voxel per wall instance like a real interior.
+		constexpr int roomDim = 4;
+		const double chunkOriginX = static_cast<double>(chunkX * ChunkUtils::CHUNK_DIM);
+		const double chunkOriginZ = static_cast<double>(chunkZ * ChunkUtils::CHUNK_DIM);
+		for (int z = 0; z < ChunkUtils::CHUNK_DIM; z++)
+		{
+			for (int x = 0; x < ChunkUtils::CHUNK_DIM; x++)
+			{
+				const bool isRoomEdge = ((x % roomDim) == 0) || ((z % roomDim) == 0);
+				const bool isCorner = ((x % roomDim) == 0) && ((z % roomDim) == 0);
+				const bool isOpening = !isCorner && (random.next(3) == 0);
+				if (!isRoomEdge || isOpening || IsStreetVoxel(z))
+				{
+					continue;
+				}
+
+				const WorldDouble3 position(chunkOriginX + x, 0.0, chunkOriginZ + z);
+				scene.instances.push_back({ BenchmarkMeshType::Walls, BenchmarkTextureType::Stone, position, Double3(1.0, 1.0, 1.0) });
+			}
+		}
+
+		// Torches along the hallway plus a few scattered in rooms.
+		for (int x = 2; x < ChunkUtils::CHUNK_DIM; x += 8)
+		{
+			scene.lightPositions.emplace_back(chunkOriginX + x + 0.5, 0.90, chunkOriginZ + STREET_CENTER_Z);
+		}
+
+		for (int i = 0; i < 8; i++)
+		{
+			const double x = chunkOriginX + random.next(ChunkUtils::CHUNK_DIM) + 0.5;
+			const double z = chunkOriginZ + random.next(ChunkUtils::CHUNK_DIM) + 0.5;
+			scene.lightPositions.emplace_back(x, 0.90, z);
+		}
+	}
+
+	void AddWildernessChunk(BenchmarkScene &scene, int chunkX, int chunkZ, Random &random)
+	{
+		AddPatches(scene, BenchmarkMeshType::FloorPatch, BenchmarkTextureType::Grass, 0.0, chunkX, chunkZ);
+
+		const double chunkOriginX = static_cast<double>(chunkX * ChunkUtils::CHUNK_DIM);
+		const double chunkOriginZ = static_cast<double>(chunkZ * ChunkUtils::CHUNK_DIM);
+		for (int i = 0; i < 192; i++)
+		{
+			const int x = random.next(ChunkUtils::CHUNK_DIM);
+			const int z = random.next(ChunkUtils::CHUNK_DIM);
+			if (IsStreetVoxel(z))
+			{
+				continue;
+			}
+
+			const double treeHeight = 1.5 + random.nextReal();
+			const WorldDouble3 position(chunkOriginX + x, 0.0, chunkOriginZ + z);
+			scene.instances.push_back({ BenchmarkMeshType::Cross, BenchmarkTextureType::Tree, position, Double3(1.0, treeHeight, 1.0) });
+		}
+
+		// Ruins and rock piles.
+		for (int i = 0; i < 8; i++)
+		{
+			const int x = random.next(ChunkUtils::CHUNK_DIM - 4);
+			const int z = random.next(ChunkUtils::CHUNK_DIM - 4);
+			if (IsStreetVoxel(z) || IsStreetVoxel(z + 1) || IsStreetVoxel(z + 2) || IsStreetVoxel(z + 3))
+			{
+				continue;
+			}
+
+			const Double3 scale(static_cast<double>(1 + random.next(3)), static_cast<double>(1 + random.next(2)), static_cast<double>(1 + random.next(3)));
+			const WorldDouble3 position(chunkOriginX + x, 0.0, chunkOriginZ + z);
+			scene.instances.push_back({ BenchmarkMeshType::Box, BenchmarkTextureType::Stone, position, scale });
+		}
+	}
+
+	BenchmarkScene MakeScene(BenchmarkSceneType type, int chunkDistance, int seed)
+	{
+		BenchmarkScene scene;
+		scene.chunkCount = ((chunkDistance * 2) + 1) * ((chunkDistance * 2) + 1);
+		scene.minVoxelX = (-chunkDistance * ChunkUtils::CHUNK_DIM) + 2;
+		scene.maxVoxelX = ((chunkDistance + 1) * ChunkUtils::CHUNK_DIM) - 2;
+
+		switch (type)
+		{
+		case BenchmarkSceneType::City:
+			scene.ambientPercent = 1.0;
+			scene.lightingType = RenderLightingType::PerMesh;
+			scene.clearColor = Color(97, 142, 203);
+			break;
+		case BenchmarkSceneType::Dungeon:
+			scene.ambientPercent = 0.0;
+			scene.lightingType = RenderLightingType::PerPixel;
+			scene.clearColor = Colors::Black;
+			break;
+		case BenchmarkSceneType::Wilderness:
+			scene.ambientPercent = 1.0;
+			scene.lightingType = RenderLightingType::PerMesh;
+			scene.clearColor = Color(97, 142, 203);
+			break;
+		default:
+			DebugNotImplementedMsg(std::to_string(static_cast<int>(type)));
+			break;
+		}
+
+		Random random(seed + static_cast<int>(type));
+		for (int chunkZ = -chunkDistance; chunkZ <= chunkDistance; chunkZ++)
+		{
+			for (int chunkX = -chunkDistance; chunkX <= chunkDistance; chunkX++)
+			{
+				switch (type)
+				{
+				case BenchmarkSceneType::City:
+					AddCityChunk(scene, chunkX, chunkZ, random);
+					break;
+				case BenchmarkSceneType::Dungeon:
+					AddDungeonChunk(scene, chunkX, chunkZ, random);
+					break;
+				case BenchmarkSceneType::Wilderness:
+					AddWildernessChunk(scene, chunkX, chunkZ, random);
+					break;
+				default:
+					break;
+				}
+			}
+		}
+
+		return scene;
+	}
+}
+
+// Renderer resources and the frame loop.
+namespace
+{
+	struct BenchmarkResources
+	{
+		ObjectTextureID paletteTextureID;
+		ObjectTextureID lightTableTextureID;
+		ObjectTextureID ditherTextureID;
+		ObjectTextureID skyBgTextureID;
+		ObjectTextureID textureIDs[BENCHMARK_TEXTURE_TYPE_COUNT];
+		BenchmarkMesh meshes[BENCHMARK_MESH_TYPE_COUNT];
+		RenderMaterialID materialIDs[BENCHMARK_TEXTURE_TYPE_COUNT][RENDER_LIGHTING_TYPE_COUNT];
+		RenderMaterialInstanceID materialInstID;
+		UniformBufferID lightsBufferID;
+	};
+
+	ObjectTextureID CreateTexture8(SoftwareRenderer &renderer, int width, int height)
+	{
+		const ObjectTextureID textureID = renderer.createTexture(width, height, 1);
+		DebugAssert(textureID >= 0);
+		return textureID;
+	}
+
+	Span2D<uint8_t> LockTexture8(SoftwareRenderer &renderer, ObjectTextureID textureID)
+	{
+		LockedTexture lockedTexture = renderer.lockTexture(textureID);
+		DebugAssert(lockedTexture.isValid());
+		return lockedTexture.getTexels8();
+	}
+
+	void InitResources(SoftwareRenderer &renderer, BenchmarkResources &resources)
+	{
+		resources.paletteTextureID = renderer.createTexture(PALETTE_HUE_COUNT * PALETTE_SHADE_COUNT, 1, 4);
+		DebugAssert(resources.paletteTextureID >= 0);
+		LockedTexture paletteLockedTexture = renderer.lockTexture(resources.paletteTextureID);
+		Span2D<uint32_t> paletteTexels = paletteLockedTexture.getTexels32();
+		for (int hue = 0; hue < PALETTE_HUE_COUNT; hue++)
+		{
+			const double hueRadians = (static_cast<double>(hue) / static_cast<double>(PALETTE_HUE_COUNT)) * Constants::TwoPi;
+			for (int shade = 0; shade < PALETTE_SHADE_COUNT; shade++)
+			{
+				const double brightness = static_cast<double>(shade) / static_cast<double>(PALETTE_SHADE_COUNT - 1);
+				const auto makeChannel = [hueRadians, brightness](double offset)
+				{
+					const double value = (0.55 + (0.45 * std::cos(hueRadians + offset))) * brightness * 255.0;
+					return static_cast<uint8_t>(std::clamp(value, 0.0, 255.0));
+				};
+
+				const Color color(makeChannel(0.0), makeChannel(2.094), makeChannel(4.189));
+				paletteTexels.set((hue * PALETTE_SHADE_COUNT) + shade, 0, color.toRGBA());
+			}
+		}
+
+		paletteTexels.set(0, 0, Colors::TransparentRGBA);
+		renderer.unlockTexture(resources.paletteTextureID);
+
+		// Each light level darkens shades by one step, the last level is pitch black.
+		constexpr int paletteLength = PALETTE_HUE_COUNT * PALETTE_SHADE_COUNT;
+		resources.lightTableTextureID = CreateTexture8(renderer, paletteLength, LIGHT_LEVEL_COUNT);
+		Span2D<uint8_t> lightTableTexels = LockTexture8(renderer, resources.lightTableTextureID);
+		for (int lightLevel = 0; lightLevel < LIGHT_LEVEL_COUNT; lightLevel++)
+		{
+			for (int paletteIndex = 0; paletteIndex < paletteLength; paletteIndex++)
+			{
+				const int hue = paletteIndex / PALETTE_SHADE_COUNT;
+				const int shade = paletteIndex % PALETTE_SHADE_COUNT;
+				const bool isLastLevel = lightLevel == (LIGHT_LEVEL_COUNT - 1);
+				const uint8_t shadedIndex = isLastLevel ? MakePaletteIndex(0, 0) : MakePaletteIndex(hue, shade - lightLevel);
+				lightTableTexels.set(paletteIndex, lightLevel, (paletteIndex == 0) ? 0 : shadedIndex);
+			}
+		}
+
+		renderer.unlockTexture(resources.lightTableTextureID);
+
+		// Dithering is disabled, the renderer still expects a placeholder texture.
+		resources.ditherTextureID = CreateTexture8(renderer, 1, 1);
+		resources.skyBgTextureID = CreateTexture8(renderer, 1, 1);
+		LockTexture8(renderer, resources.skyBgTextureID).set(0, 0, MakePaletteIndex(7, 12));
+		renderer.unlockTexture(resources.skyBgTextureID);
+
+		for (int i = 0; i < BENCHMARK_TEXTURE_TYPE_COUNT; i++)
+		{
+			const BenchmarkTextureType textureType = static_cast<BenchmarkTextureType>(i);
+			resources.textureIDs[i] = CreateTexture8(renderer, TEXTURE_DIM, TEXTURE_DIM);
+			WriteTextureTexels(textureType, LockTexture8(renderer, resources.textureIDs[i]));
+			renderer.unlockTexture(resources.textureIDs[i]);
+
+			const bool isAlphaTested = textureType == BenchmarkTextureType::Tree;
+			const FragmentShaderType fragmentShaderType = isAlphaTested ? FragmentShaderType::AlphaTested : FragmentShaderType::Opaque;
+			for (int j = 0; j < RENDER_LIGHTING_TYPE_COUNT; j++)
+			{
+				RenderMaterialKey materialKey;
+				materialKey.init(VertexShaderType::Basic, fragmentShaderType, Span<const ObjectTextureID>(&resources.textureIDs[i], 1),
+					static_cast<RenderLightingType>(j), !isAlphaTested, true, true);
+				resources.materialIDs[i][j] = renderer.createMaterial(materialKey);
+			}
+		}
+
+		for (int i = 0; i < BENCHMARK_MESH_TYPE_COUNT; i++)
+		{
+			BenchmarkMeshBuilder builder;
+			WriteMeshGeometry(static_cast<BenchmarkMeshType>(i), builder);
+
+			const int vertexCount = static_cast<int>(builder.positions.size()) / MeshUtils::POSITION_COMPONENTS_PER_VERTEX;
+			const int indexCount = static_cast<int>(builder.indices.size());
+			BenchmarkMesh &mesh = resources.meshes[i];
+			mesh.positionBufferID = renderer.createVertexPositionBuffer(vertexCount, MeshUtils::POSITION_COMPONENTS_PER_VERTEX, sizeof(double));
+			mesh.normalBufferID = renderer.createVertexAttributeBuffer(vertexCount, MeshUtils::NORMAL_COMPONENTS_PER_VERTEX, sizeof(double));
+			mesh.texCoordBufferID = renderer.createVertexAttributeBuffer(vertexCount, MeshUtils::TEX_COORD_COMPONENTS_PER_VERTEX, sizeof(double));
+			mesh.indexBufferID = renderer.createIndexBuffer(indexCount, sizeof(int32_t));
+			mesh.triangleCount = indexCount / MeshUtils::INDICES_PER_TRIANGLE;
+
+			Span<double> positions = renderer.lockVertexPositionBuffer(mesh.positionBufferID).getDoubles();
+			std::copy(builder.positions.begin(), builder.positions.end(), positions.begin());
+			renderer.unlockVertexPositionBuffer(mesh.positionBufferID);
+
+			Span<double> normals = renderer.lockVertexAttributeBuffer(mesh.normalBufferID).getDoubles();
+			std::copy(builder.normals.begin(), builder.normals.end(), normals.begin());
+			renderer.unlockVertexAttributeBuffer(mesh.normalBufferID);
+
+			Span<double> texCoords = renderer.lockVertexAttributeBuffer(mesh.texCoordBufferID).getDoubles();
+			std::copy(builder.texCoords.begin(), builder.texCoords.end(), texCoords.begin());
+			renderer.unlockVertexAttributeBuffer(mesh.texCoordBufferID);
+
+			Span<int> indices = renderer.lockIndexBuffer(mesh.indexBufferID).getInts();
+			std::copy(builder.indices.begin(), builder.indices.end(), indices.begin());
+			renderer.unlockIndexBuffer(mesh.indexBufferID);
+		}
+
+		resources.materialInstID = renderer.createMaterialInstance();
+		renderer.setMaterialInstanceMeshLightPercent(resources.materialInstID, 1.0);
+
+		constexpr int bytesPerLight = sizeof(double) * 5;
+		resources.lightsBufferID = renderer.createUniformBuffer(MAX_BENCHMARK_LIGHTS, bytesPerLight, alignof(double));
+	}
+
+	// FNV-1a over the final frame so runs can be checked for identical output.
+	uint64_t HashColorBuffer(const Buffer2D<uint32_t> &colorBuffer)
+	{
+		uint64_t hash = 14695981039346656037ull;
+		for (const uint32_t color : colorBuffer)
+		{
+			hash ^= color;
+			hash *= 1099511628211ull;
+		}
+
+		return hash;
+	}
+
+	struct BenchmarkFrameStats
+	{
+		double frameSeconds;
+		RendererProfilerData3D profilerData;
+	};
+
+	struct BenchmarkSceneResult
+	{
+		BenchmarkSceneType type;
+		int chunkCount;
+		int instanceCount;
+		int lightCount;
+		int64_t submittedTriangleCount;
+		std::vector<BenchmarkFrameStats> frames;
+		uint64_t lastFrameHash;
+	};
+
+	void UpdateTransforms(SoftwareRenderer &renderer, UniformBufferID transformBufferID, const BenchmarkScene &scene, const RenderCamera &camera)
+	{
+		const int instanceCount = static_cast<int>(scene.instances.size());
+		for (int i = 0; i < instanceCount; i++)
+		{
+			const BenchmarkInstance &instance = scene.instances[i];
+			const Double3 position = instance.position - camera.floatingOriginPoint;
+			const Matrix4d modelMatrix = Matrix4d::translation(position.x, position.y, position.z) *
+				Matrix4d::scale(instance.scale.x, instance.scale.y, instance.scale.z);
+
+			LockedBuffer lockedTransform = renderer.lockUniformBufferIndex(transformBufferID, i);
+			std::copy(reinterpret_cast<const std::byte*>(&modelMatrix), reinterpret_cast<const std::byte*>(&modelMatrix) + sizeof(modelMatrix),
+				lockedTransform.bytes.begin());
+			renderer.unlockUniformBufferIndex(transformBufferID, i);
+		}
+	}
+
+	// Nearest lights first like the game's visible light list.
+	int UpdateLights(SoftwareRenderer &renderer, UniformBufferID lightsBufferID, const BenchmarkScene &scene, const RenderCamera &camera,
+		std::vector<WorldDouble3> &sortedLightPositions)
+	{
+		sortedLightPositions = scene.lightPositions;
+		std::sort(sortedLightPositions.begin(), sortedLightPositions.end(),
+			[&camera](const WorldDouble3 &a, const WorldDouble3 &b)
+		{
+			return (a - camera.worldPoint).lengthSquared() < (b - camera.worldPoint).lengthSquared();
+		});
+
+		const int lightCount = std::min(static_cast<int>(sortedLightPositions.size()), MAX_BENCHMARK_LIGHTS);
+		LockedBuffer lockedLights = renderer.lockUniformBuffer(lightsBufferID);
+		for (int i = 0; i < lightCount; i++)
+		{
+			const Double3 position = sortedLightPositions[i] - camera.floatingOriginPoint;
+			double *lightValues = reinterpret_cast<double*>(lockedLights.bytes.begin() + (i * lockedLights.bytesPerStride));
+			lightValues[0] = position.x;
+			lightValues[1] = position.y;
+			lightValues[2] = position.z;
+			lightValues[3] = LIGHT_START_RADIUS;
+			lightValues[4] = LIGHT_END_RADIUS;
+		}
+
+		renderer.unlockUniformBuffer(lightsBufferID);
+		return lightCount;
+	}
+
+	// Walks the length of the street/hallway while turning two full circles.
+	RenderCamera MakeCamera(const BenchmarkScene &scene, int frameIndex, int frameCount, double aspectRatio)
+	{
+		const double percent = static_cast<double>(frameIndex) / static_cast<double>(std::max(frameCount - 1, 1));
+		const double x = static_cast<double>(scene.minVoxelX) + (percent * static_cast<double>(scene.maxVoxelX - scene.minVoxelX));
+		const WorldDouble3 worldPoint(x, EYE_HEIGHT, STREET_CENTER_Z);
+		const Degrees yaw = std::fmod(percent * 720.0, 360.0);
+		const Degrees pitch = 0.0;
+		const Degrees fovY = 60.0;
+
+		RenderCamera camera;
+		camera.init(worldPoint, yaw, pitch, fovY, aspectRatio, RendererUtils::getTallPixelRatio(false));
+		return camera;
+	}
+
+	BenchmarkSceneResult RunScene(SoftwareRenderer &renderer, const BenchmarkResources &resources, BenchmarkSceneType type, const BenchmarkArgs &args)
+	{
+		const BenchmarkScene scene = MakeScene(type, args.chunkDistance, args.seed);
+		const int instanceCount = static_cast<int>(scene.instances.size());
+		const int lightingTypeIndex = static_cast<int>(scene.lightingType);
+
+		BenchmarkSceneResult result;
+		result.type = type;
+		result.chunkCount = scene.chunkCount;
+		result.instanceCount = instanceCount;
+		result.lightCount = static_cast<int>(scene.lightPositions.size());
+		result.submittedTriangleCount = 0;
+		result.lastFrameHash = 0;
+
+		const UniformBufferID transformBufferID = renderer.createUniformBuffer(std::max(instanceCount, 1), sizeof(Matrix4d), alignof(Matrix4d));
+		DebugAssert(transformBufferID >= 0);
+
+		// Opaque geometry goes first so alpha-tested draws can depth test against it.
+		std::vector<RenderDrawCall> opaqueDrawCalls;
+		std::vector<RenderDrawCall> alphaTestedDrawCalls;
+		for (int i = 0; i < instanceCount; i++)
+		{
+			const BenchmarkInstance &instance = scene.instances[i];
+			const BenchmarkMesh &mesh = resources.meshes[static_cast<int>(instance.meshType)];
+
+			RenderDrawCall drawCall;
+			drawCall.transformBufferID = transformBufferID;
+			drawCall.transformIndex = i;
+			drawCall.positionBufferID = mesh.positionBufferID;
+			drawCall.normalBufferID = mesh.normalBufferID;
+			drawCall.texCoordBufferID = mesh.texCoordBufferID;
+			drawCall.indexBufferID = mesh.indexBufferID;
+			drawCall.materialID = resources.materialIDs[static_cast<int>(instance.textureType)][lightingTypeIndex];
+			drawCall.materialInstID = resources.materialInstID;
+			drawCall.multipassType = RenderMultipassType::None;
+
+			const bool isAlphaTested = instance.textureType == BenchmarkTextureType::Tree;
+			std::vector<RenderDrawCall> &drawCalls = isAlphaTested ? alphaTestedDrawCalls : opaqueDrawCalls;
+			drawCalls.emplace_back(drawCall);
+			result.submittedTriangleCount += mesh.triangleCount;
+		}
+
+		RenderCommandList commandList;
+		commandList.addDrawCalls(opaqueDrawCalls);
+		commandList.addDrawCalls(alphaTestedDrawCalls);
+
+		Buffer2D<uint32_t> colorBuffer(args.width, args.height);
+		const double aspectRatio = static_cast<double>(args.width) / static_cast<double>(args.height);
+		std::vector<WorldDouble3> sortedLightPositions;
+		ChunkInt2 prevCameraChunk(-1000000, -1000000);
+
+		const int totalFrameCount = args.warmupFrameCount + args.frameCount;
+		result.frames.reserve(args.frameCount);
+		for (int i = 0; i < totalFrameCount; i++)
+		{
+			const bool isWarmup = i < args.warmupFrameCount;
+			const int pathFrameIndex = isWarmup ? 0 : (i - args.warmupFrameCount);
+			const RenderCamera camera = MakeCamera(scene, pathFrameIndex, args.frameCount, aspectRatio);
+
+			// Model matrices are relative to the camera's chunk, same as the game's floating origin.
+			if (camera.chunk != prevCameraChunk)
+			{
+				UpdateTransforms(renderer, transformBufferID, scene, camera);
+				prevCameraChunk = camera.chunk;
+			}
+
+			const int visibleLightCount = UpdateLights(renderer, resources.lightsBufferID, scene, camera, sortedLightPositions);
+
+			RenderFrameSettings frameSettings;
+			frameSettings.init(scene.clearColor, scene.ambientPercent, resources.lightsBufferID, visibleLightCount, 0.0, resources.paletteTextureID,
+				resources.lightTableTextureID, resources.ditherTextureID, resources.skyBgTextureID, args.renderThreadsMode, DitheringMode::None, false);
+
+			colorBuffer.fill(scene.clearColor.toRGBA());
+
+			const auto startTime = std::chrono::high_resolution_clock::now();
+			renderer.submitFrame(commandList, camera, frameSettings, colorBuffer.begin());
+			const double frameSeconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+
+			if (!isWarmup)
+			{
+				BenchmarkFrameStats frameStats;
+				frameStats.frameSeconds = frameSeconds;
+				frameStats.profilerData = renderer.getProfilerData();
+				result.frames.emplace_back(std::move(frameStats));
+			}
+		}
+
+		result.lastFrameHash = HashColorBuffer(colorBuffer);
+		renderer.freeUniformBuffer(transformBufferID);
+		return result;
+	}
+}
+
+// JSON output.
+namespace
+{
+	double GetPercentile(std::vector<double> values, double percent)
+	{
+		if (values.empty())
+		{
+			return 0.0;
+		}
+
+		std::sort(values.begin(), values.end());
+		const int index = std::clamp(static_cast<int>(std::ceil(percent * static_cast<double>(values.size()))) - 1, 0, static_cast<int>(values.size()) - 1);
+		return values[index];
+	}
+
+	void WriteSceneJson(std::ostream &stream, const BenchmarkSceneResult &result, const BenchmarkArgs &args)
+	{
+		const int frameCount = static_cast<int>(result.frames.size());
+		const double frameCountReal = static_cast<double>(std::max(frameCount, 1));
+
+		std::vector<double> frameMilliseconds;
+		double totalFrameSeconds = 0.0;
+		double totalGeometrySeconds = 0.0;
+		double totalBusySeconds = 0.0;
+		double totalIdleSeconds = 0.0;
+		int64_t totalDrawCalls = 0;
+		int64_t totalPresentedTriangles = 0;
+		int64_t totalGeometryTriangles = 0;
+		int64_t totalCoverageTests = 0;
+		int64_t totalDepthTests = 0;
+		int64_t totalColorWrites = 0;
+		int64_t totalHiZRejectedTriangles = 0;
+		int64_t totalHiZRejectedTiles = 0;
+		int threadCount = 0;
+		for (const BenchmarkFrameStats &frame : result.frames)
+		{
+			const RendererProfilerData3D &profilerData = frame.profilerData;
+			frameMilliseconds.emplace_back(frame.frameSeconds * 1000.0);
+			totalFrameSeconds += frame.frameSeconds;
+			totalGeometrySeconds += profilerData.geometrySeconds;
+
+			for (const double seconds : profilerData.threadBusySeconds)
+			{
+				totalBusySeconds += seconds;
+			}
+
+			for (const double seconds : profilerData.threadIdleSeconds)
+			{
+				totalIdleSeconds += seconds;
+			}
+
+			totalDrawCalls += profilerData.drawCallCount;
+			totalPresentedTriangles += profilerData.presentedTriangleCount;
+			totalGeometryTriangles += profilerData.geometryTriangleCount;
+			totalCoverageTests += profilerData.totalCoverageTests;
+			totalDepthTests += profilerData.totalDepthTests;
+			totalColorWrites += profilerData.totalColorWrites;
+			totalHiZRejectedTriangles += profilerData.totalHiZRejectedTriangles;
+			totalHiZRejectedTiles += profilerData.totalHiZRejectedTiles;
+			threadCount = profilerData.threadCount;
+		}
+
+		const double totalSecondsSafe = std::max(totalFrameSeconds, 1.0e-9);
+		const double pixelCount = static_cast<double>(args.width) * static_cast<double>(args.height);
+		const auto perFrame = [frameCountReal](double total) { return total / frameCountReal; };
+
+		char hashBuffer[32];
+		std::snprintf(hashBuffer, sizeof(hashBuffer), "%016llx", static_cast<unsigned long long>(result.lastFrameHash));
+
+		stream << "    {\n";
+		stream << "      \"scene\": \"" << GetSceneName(result.type) << "\",\n";
+		stream << "      \"chunkCount\": " << result.chunkCount << ",\n";
+		stream << "      \"instanceCount\": " << result.instanceCount << ",\n";
+		stream << "      \"lightCount\": " << result.lightCount << ",\n";
+		stream << "      \"submittedTrianglesPerFrame\": " << result.submittedTriangleCount << ",\n";
+		stream << "      \"frames\": " << frameCount << ",\n";
+		stream << "      \"threadCount\": " << threadCount << ",\n";
+		stream << "      \"frameMs\": { \"mean\": " << perFrame(totalFrameSeconds * 1000.0)
+			<< ", \"min\": " << GetPercentile(frameMilliseconds, 0.0)
+			<< ", \"p50\": " << GetPercentile(frameMilliseconds, 0.50)
+			<< ", \"p95\": " << GetPercentile(frameMilliseconds, 0.95)
+			<< ", \"p99\": " << GetPercentile(frameMilliseconds, 0.99)
+			<< ", \"max\": " << GetPercentile(frameMilliseconds, 1.0) << " },\n";
+		stream << "      \"stageMs\": { \"geometryThreadSum\": " << perFrame(totalGeometrySeconds * 1000.0)
+			<< ", \"busyThreadSum\": " << perFrame(totalBusySeconds * 1000.0)
+			<< ", \"idleThreadSum\": " << perFrame(totalIdleSeconds * 1000.0) << " },\n";
+		stream << "      \"perFrame\": { \"drawCalls\": " << perFrame(static_cast<double>(totalDrawCalls))
+			<< ", \"geometryTriangles\": " << perFrame(static_cast<double>(totalGeometryTriangles))
+			<< ", \"presentedTriangles\": " << perFrame(static_cast<double>(totalPresentedTriangles))
+			<< ", \"hiZRejectedTriangles\": " << perFrame(static_cast<double>(totalHiZRejectedTriangles))
+			<< ", \"hiZRejectedTiles\": " << perFrame(static_cast<double>(totalHiZRejectedTiles))
+			<< ", \"coverageTests\": " << perFrame(static_cast<double>(totalCoverageTests))
+			<< ", \"depthTests\": " << perFrame(static_cast<double>(totalDepthTests))
+			<< ", \"colorWrites\": " << perFrame(static_cast<double>(totalColorWrites)) << " },\n";
+		stream << "      \"trianglesPerSecond\": " << (static_cast<double>(totalPresentedTriangles) / totalSecondsSafe) << ",\n";
+		stream << "      \"pixelsPerSecond\": " << ((pixelCount * static_cast<double>(frameCount)) / totalSecondsSafe) << ",\n";
+		stream << "      \"colorWritesPerSecond\": " << (static_cast<double>(totalColorWrites) / totalSecondsSafe) << ",\n";
+		stream << "      \"lastFrameHash\": \"" << hashBuffer << "\"\n";
+		stream << "    }";
+	}
+
+	void WriteJson(std::ostream &stream, const std::vector<BenchmarkSceneResult> &results, const BenchmarkArgs &args, const char *kernelsName)
+	{
+		stream << "{\n";
+		stream << "  \"benchmark\": \"software-renderer\",\n";
+		stream << "  \"rasterizerKernels\": \"" << kernelsName << "\",\n";
+#ifdef HAVE_SOFTWARE_RASTERIZER_FLOAT
+		stream << "  \"rasterizerPrecision\": \"float\",\n";
+#else
+		stream << "  \"rasterizerPrecision\": \"double\",\n";
+#endif
+		stream << "  \"width\": " << args.width << ",\n";
+		stream << "  \"height\": " << args.height << ",\n";
+		stream << "  \"chunkDistance\": " << args.chunkDistance << ",\n";
+		stream << "  \"renderThreadsMode\": " << args.renderThreadsMode << ",\n";
+		stream << "  \"warmupFrames\": " << args.warmupFrameCount << ",\n";
+		stream << "  \"seed\": " << args.seed << ",\n";
+		stream << "  \"scenes\": [\n";
+
+		for (int i = 0; i < static_cast<int>(results.size()); i++)
+		{
+			WriteSceneJson(stream, results[i], args);
+			stream << ((i < (static_cast<int>(results.size()) - 1)) ? ",\n" : "\n");
+		}
+
+		stream << "  ]\n";
+		stream << "}\n";
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	BenchmarkArgs args;
+	if (!TryParseArgs(argc, argv, &args))
+	{
+		PrintUsage();
+		return EXIT_FAILURE;
+	}
+
+	RenderInitSettings initSettings;
+	initSettings.init(nullptr, std::string(), args.width, args.height, args.renderThreadsMode, DitheringMode::None);
+
+	SoftwareRenderer renderer;
+	if (!renderer.init(initSettings))
+	{
+		std::cerr << "Couldn't init software renderer.\n";
+		return EXIT_FAILURE;
+	}
+
+	BenchmarkResources resources;
+	InitResources(renderer, resources);
+
+	std::vector<BenchmarkSceneResult> results;
+	for (const BenchmarkSceneType sceneType : args.sceneTypes)
+	{
+		results.emplace_back(RunScene(renderer, resources, sceneType, args));
+	}
+
+	const char *kernelsName = SoftwareRasterizerKernels::select().name;
+	renderer.shutdown();
+
+	if (args.outputPath.empty())
+	{
+		WriteJson(std::cout, results, args, kernelsName);
+	}
+	else
+	{
+		std::ofstream stream(args.outputPath, std::ofstream::trunc);
+		if (!stream.is_open())
+		{
+			std::cerr << "Couldn't open \"" << args.outputPath << "\" for writing.\n";
+			return EXIT_FAILURE;
+		}
+
+		WriteJson(stream, results, args, kernelsName);
+	}
+
+	return EXIT_SUCCESS;
+}
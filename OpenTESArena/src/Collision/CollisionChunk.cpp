@@ -6,6 +6,42 @@
 
 #include "components/debug/Debug.h"
 
+namespace
+{
+	void FreePhysicsCompoundBody(JPH::BodyID &bodyID, JPH::BodyInterface &bodyInterface)
+	{
+		if (!bodyID.IsInvalid())
+		{
+			bodyInterface.RemoveBody(bodyID);
+			bodyInterface.DestroyBody(bodyID);
+			bodyID = Physics::INVALID_BODY_ID;
+		}
+	}
+}
+
+CollisionChunkRegion::CollisionChunkRegion()
+{
+	this->wallCompoundBodyID = Physics::INVALID_BODY_ID;
+	this->doorCompoundBodyID = Physics::INVALID_BODY_ID;
+	this->sensorCompoundBodyID = Physics::INVALID_BODY_ID;
+}
+
+void CollisionChunkRegion::freePhysicsCompoundBodies(JPH::BodyInterface &bodyInterface)
+{
+	FreePhysicsCompoundBody(this->wallCompoundBodyID, bodyInterface);
+	FreePhysicsCompoundBody(this->doorCompoundBodyID, bodyInterface);
+	FreePhysicsCompoundBody(this->sensorCompoundBodyID, bodyInterface);
+}
+
+int CollisionChunk::getRegionIndex(SNInt x, WEInt z)
+{
+	DebugAssert(x >= 0);
+	DebugAssert(x < Chunk::WIDTH);
+	DebugAssert(z >= 0);
+	DebugAssert(z < Chunk::DEPTH);
+	return (x / CollisionChunk::REGION_DIM) + ((z / CollisionChunk::REGION_DIM) * CollisionChunk::REGION_COUNT_X);
+}
+
 void CollisionChunk::init(const ChunkInt2 &position, int height)
 {
 	Chunk::init(position, height);
@@ -14,38 +50,23 @@ void CollisionChunk::init(const ChunkInt2 &position, int height)
 	this->shapeDefs.emplace_back(CollisionShapeDefinition());
 	this->shapeMappings.emplace(VoxelChunk::AIR_TRAITS_DEF_ID, CollisionChunk::AIR_COLLISION_SHAPE_DEF_ID);
 
-	this->shapeDefIDs.init(Chunk::WIDTH, height, Chunk::DEPTH);
+	this->shapeDefIDs.initOrReuse(Chunk::WIDTH, height, Chunk::DEPTH);
 	this->shapeDefIDs.fill(CollisionChunk::AIR_COLLISION_SHAPE_DEF_ID);
 
-	this->enabledColliders.init(Chunk::WIDTH, height, Chunk::DEPTH);
+	this->enabledColliders.initOrReuse(Chunk::WIDTH, height, Chunk::DEPTH);
 	this->enabledColliders.fill(false);
 
-	this->wallCompoundBodyID = Physics::INVALID_BODY_ID;
-	this->doorCompoundBodyID = Physics::INVALID_BODY_ID;
-	this->sensorCompoundBodyID = Physics::INVALID_BODY_ID;
+	for (CollisionChunkRegion &region : this->regions)
+	{
+		region = CollisionChunkRegion();
+	}
 }
 
 void CollisionChunk::freePhysicsCompoundBodies(JPH::BodyInterface &bodyInterface)
 {
-	if (!this->wallCompoundBodyID.IsInvalid())
+	for (CollisionChunkRegion &region : this->regions)
 	{
-		bodyInterface.RemoveBody(this->wallCompoundBodyID);
-		bodyInterface.DestroyBody(this->wallCompoundBodyID);
-		this->wallCompoundBodyID = Physics::INVALID_BODY_ID;
-	}
-
-	if (!this->doorCompoundBodyID.IsInvalid())
-	{
-		bodyInterface.RemoveBody(this->doorCompoundBodyID);
-		bodyInterface.DestroyBody(this->doorCompoundBodyID);
-		this->doorCompoundBodyID = Physics::INVALID_BODY_ID;
-	}
-
-	if (!this->sensorCompoundBodyID.IsInvalid())
-	{
-		bodyInterface.RemoveBody(this->sensorCompoundBodyID);
-		bodyInterface.DestroyBody(this->sensorCompoundBodyID);
-		this->sensorCompoundBodyID = Physics::INVALID_BODY_ID;
+		region.freePhysicsCompoundBodies(bodyInterface);
 	}
 }
 
@@ -54,11 +75,13 @@ void CollisionChunk::clear()
 	Chunk::clear();
 	this->shapeDefs.clear();
 	this->shapeMappings.clear();
-	this->shapeDefIDs.clear();
-	this->enabledColliders.clear();
-	DebugAssert(this->wallCompoundBodyID == Physics::INVALID_BODY_ID);
-	DebugAssert(this->doorCompoundBodyID == Physics::INVALID_BODY_ID);
-	DebugAssert(this->sensorCompoundBodyID == Physics::INVALID_BODY_ID);
+
+	for (const CollisionChunkRegion &region : this->regions)
+	{
+		DebugAssert(region.wallCompoundBodyID == Physics::INVALID_BODY_ID);
+		DebugAssert(region.doorCompoundBodyID == Physics::INVALID_BODY_ID);
+		DebugAssert(region.sensorCompoundBodyID == Physics::INVALID_BODY_ID);
+	}
 }
 
 int CollisionChunk::getCollisionShapeDefCount() const
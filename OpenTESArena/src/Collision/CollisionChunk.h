@@ -16,19 +16,40 @@
 
 using CollisionShapeDefID = int;
 
+// Compound bodies for one column of voxels in a chunk.
+struct CollisionChunkRegion
+{
+	JPH::BodyID wallCompoundBodyID; // Holds most of the game world, uses enhanced internal edge removal setting.
+	JPH::BodyID doorCompoundBodyID; // Holds door colliders
+	JPH::BodyID sensorCompoundBodyID; // Holds SENSOR colliders
+
+	CollisionChunkRegion();
+
+	void freePhysicsCompoundBodies(JPH::BodyInterface &bodyInterface);
+};
+
 struct CollisionChunk final : public Chunk
 {
+	// The chunk is split into square columns of voxels with their own bodies, so a voxel change only rebuilds
+	// the colliders in its region. Combined boxes crossing a region border are split between regions.
+	static constexpr int REGION_DIM = 16;
+	static constexpr int REGION_COUNT_X = Chunk::WIDTH / REGION_DIM;
+	static constexpr int REGION_COUNT_Z = Chunk::DEPTH / REGION_DIM;
+	static constexpr int REGION_COUNT = REGION_COUNT_X * REGION_COUNT_Z;
+	static_assert((Chunk::WIDTH % REGION_DIM) == 0);
+	static_assert((Chunk::DEPTH % REGION_DIM) == 0);
+
 	std::vector<CollisionShapeDefinition> shapeDefs;
 	std::unordered_map<VoxelShapeDefID, CollisionShapeDefID> shapeMappings;
 	Buffer3D<CollisionShapeDefID> shapeDefIDs;
 	Buffer3D<bool> enabledColliders; // @todo: decide if this is obsolete and whether the Body can store its in/out of world state
 	
-	JPH::BodyID wallCompoundBodyID; // Holds most of the game world, uses enhanced internal edge removal setting.
-	JPH::BodyID doorCompoundBodyID; // Holds door colliders
-	JPH::BodyID sensorCompoundBodyID; // Holds SENSOR colliders
+	CollisionChunkRegion regions[REGION_COUNT];
 
 	static constexpr CollisionShapeDefID AIR_COLLISION_SHAPE_DEF_ID = 0;
 
+	static int getRegionIndex(SNInt x, WEInt z);
+
 	void init(const ChunkInt2 &position, int height);
 	void freePhysicsCompoundBodies(JPH::BodyInterface &bodyInterface);
 	void clear();
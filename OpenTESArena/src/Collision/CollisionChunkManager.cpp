@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "Jolt/Jolt.h"
 #include "Jolt/Physics/Body/BodyCreationSettings.h"
 #include "Jolt/Physics/Body/BodyLock.h"
@@ -59,72 +61,108 @@ namespace
 		*outRotation = JPH::Quat::sRotation(JPH::Vec3Arg::sAxisY(), boxYRotation);
 	}
 
-	JPH::BodyID CreateChunkCompoundShape(const CollisionChunk &collisionChunk, double ceilingScale, CompoundShapeCategory category,
-		const VoxelChunk &voxelChunk, const VoxelBoxCombineChunk &boxCombineChunk, JPH::PhysicsSystem &physicsSystem)
+	// Part of a combined box that's inside one region.
+	struct RegionBox
 	{
-		const ChunkInt2 chunkPos = collisionChunk.position;
-		const int chunkHeight = collisionChunk.height;
+		VoxelInt3 min;
+		VoxelInt3 max;
+	};
 
-		JPH::StaticCompoundShapeSettings compoundShapeSettings;
-		compoundShapeSettings.SetEmbedded();
+	constexpr int CompoundShapeCategoryCount = 3;
 
-		std::vector<JPH::Ref<JPH::BoxShapeSettings>> boxShapeSettingsList; // Freed at end of scope
+	JPH::BodyID &GetRegionCompoundBodyID(CollisionChunkRegion &region, CompoundShapeCategory category)
+	{
+		switch (category)
+		{
+		case CompoundShapeCategory::Walls:
+			return region.wallCompoundBodyID;
+		case CompoundShapeCategory::Doors:
+			return region.doorCompoundBodyID;
+		case CompoundShapeCategory::Sensors:
+			return region.sensorCompoundBodyID;
+		default:
+			DebugCrash("Unhandled compound shape category " + std::to_string(static_cast<int>(category)) + ".");
+		}
+	}
 
-		const KeyValuePool<VoxelBoxCombineResultID, VoxelBoxCombineResult> &combinedBoxesPool = boxCombineChunk.combinedBoxesPool;
-		for (const VoxelBoxCombineResult &combinedBoxResult : combinedBoxesPool.values)
+	// Returns whether the box starting at this voxel belongs in the compound shape category's body.
+	bool IsRegionBoxInCategory(const VoxelInt3 &boxMin, CompoundShapeCategory category, const CollisionChunk &collisionChunk, const VoxelChunk &voxelChunk)
+	{
+		bool isTriggerVoxel = false;
+		VoxelTriggerDefID triggerDefID;
+		if (voxelChunk.tryGetTriggerDefID(boxMin.x, boxMin.y, boxMin.z, &triggerDefID))
 		{
-			const VoxelInt3 combinedBoxMin = combinedBoxResult.min;
-			const VoxelInt3 combinedBoxMax = combinedBoxResult.max;
+			const VoxelTriggerDefinition &voxelTriggerDef = voxelChunk.triggerDefs[triggerDefID];
+			isTriggerVoxel = voxelTriggerDef.hasValidDefForPhysics();
+		}
 
-			bool isTriggerVoxel = false;
-			VoxelTriggerDefID triggerDefID;
-			if (voxelChunk.tryGetTriggerDefID(combinedBoxMin.x, combinedBoxMin.y, combinedBoxMin.z, &triggerDefID))
-			{
-				const VoxelTriggerDefinition &voxelTriggerDef = voxelChunk.triggerDefs[triggerDefID];
-				isTriggerVoxel = voxelTriggerDef.hasValidDefForPhysics();
-			}
+		bool isInteriorLevelChangeVoxel = false;
+		VoxelTransitionDefID transitionDefID;
+		if (voxelChunk.tryGetTransitionDefID(boxMin.x, boxMin.y, boxMin.z, &transitionDefID))
+		{
+			const TransitionDefinition &transitionDef = voxelChunk.transitionDefs[transitionDefID];
+			isInteriorLevelChangeVoxel = transitionDef.type == TransitionType::InteriorLevelChange;
+		}
 
-			bool isInteriorLevelChangeVoxel = false;
-			VoxelTransitionDefID transitionDefID;
-			if (voxelChunk.tryGetTransitionDefID(combinedBoxMin.x, combinedBoxMin.y, combinedBoxMin.z, &transitionDefID))
+		bool isDoorVoxel = false;
+		bool isClosedDoor = false;
+		VoxelDoorDefID doorDefID;
+		if (voxelChunk.tryGetDoorDefID(boxMin.x, boxMin.y, boxMin.z, &doorDefID))
+		{
+			isDoorVoxel = true;
+			int doorAnimInstIndex;
+			if (voxelChunk.tryGetDoorAnimInstIndex(boxMin.x, boxMin.y, boxMin.z, &doorAnimInstIndex))
 			{
-				const TransitionDefinition &transitionDef = voxelChunk.transitionDefs[transitionDefID];
-				isInteriorLevelChangeVoxel = transitionDef.type == TransitionType::InteriorLevelChange;
+				const VoxelDoorAnimationInstance &doorAnimInst = voxelChunk.doorAnimInsts[doorAnimInstIndex];
+				isClosedDoor = doorAnimInst.stateType == VoxelDoorAnimationStateType::Closed;
 			}
-
-			bool isDoorVoxel = false;
-			bool isClosedDoor = false;
-			VoxelDoorDefID doorDefID;
-			if (voxelChunk.tryGetDoorDefID(combinedBoxMin.x, combinedBoxMin.y, combinedBoxMin.z, &doorDefID))
+			else
 			{
-				isDoorVoxel = true;
-				int doorAnimInstIndex;
-				if (voxelChunk.tryGetDoorAnimInstIndex(combinedBoxMin.x, combinedBoxMin.y, combinedBoxMin.z, &doorAnimInstIndex))
-				{
-					const VoxelDoorAnimationInstance &doorAnimInst = voxelChunk.doorAnimInsts[doorAnimInstIndex];
-					isClosedDoor = doorAnimInst.stateType == VoxelDoorAnimationStateType::Closed;
-				}
-				else
-				{
-					isClosedDoor = true;
-				}
+				isClosedDoor = true;
 			}
+		}
 
-			const bool voxelHasCollision = collisionChunk.enabledColliders.get(combinedBoxMin.x, combinedBoxMin.y, combinedBoxMin.z);
-			const bool isSensorCollider = isTriggerVoxel || isInteriorLevelChangeVoxel;
+		const bool voxelHasCollision = collisionChunk.enabledColliders.get(boxMin.x, boxMin.y, boxMin.z);
+		const bool isSensorCollider = isTriggerVoxel || isInteriorLevelChangeVoxel;
 
-			const bool shouldAddWall = (voxelHasCollision && !isSensorCollider && !isDoorVoxel) && (category == CompoundShapeCategory::Walls);
-			const bool shouldAddDoor = isClosedDoor && (category == CompoundShapeCategory::Doors);
-			const bool shouldAddSensor = isSensorCollider && (category == CompoundShapeCategory::Sensors);
-			const bool shouldCreateCollider = shouldAddWall || shouldAddDoor || shouldAddSensor;
-			if (!shouldCreateCollider)
-			{
-				continue;
-			}
+		switch (category)
+		{
+		case CompoundShapeCategory::Walls:
+			return voxelHasCollision && !isSensorCollider && !isDoorVoxel;
+		case CompoundShapeCategory::Doors:
+			return isClosedDoor;
+		case CompoundShapeCategory::Sensors:
+			return isSensorCollider;
+		default:
+			DebugUnhandledReturnMsg(bool, std::to_string(static_cast<int>(category)));
+		}
+	}
 
-			const VoxelShapeDefID voxelShapeDefID = voxelChunk.shapeDefIDs.get(combinedBoxMin.x, combinedBoxMin.y, combinedBoxMin.z);
+	JPH::BodyID CreateRegionCompoundShape(const CollisionChunk &collisionChunk, double ceilingScale, CompoundShapeCategory category,
+		Span<const RegionBox> regionBoxes, const VoxelChunk &voxelChunk, JPH::PhysicsSystem &physicsSystem)
+	{
+		if (regionBoxes.getCount() == 0)
+		{
+			// Jolt doesn't like creating a compound shape with 0 sub-shapes
+			return Physics::INVALID_BODY_ID;
+		}
+
+		const ChunkInt2 chunkPos = collisionChunk.position;
+
+		JPH::StaticCompoundShapeSettings compoundShapeSettings;
+		compoundShapeSettings.SetEmbedded();
+
+		std::vector<JPH::Ref<JPH::BoxShapeSettings>> boxShapeSettingsList; // Freed at end of scope
+		boxShapeSettingsList.reserve(regionBoxes.getCount());
+
+		const bool isSensorCollider = category == CompoundShapeCategory::Sensors;
+		for (const RegionBox &regionBox : regionBoxes)
+		{
+			const VoxelInt3 boxMin = regionBox.min;
+			const VoxelInt3 boxMax = regionBox.max;
+			const VoxelShapeDefID voxelShapeDefID = voxelChunk.shapeDefIDs.get(boxMin.x, boxMin.y, boxMin.z);
 			const VoxelShapeDefinition &voxelShapeDef = voxelChunk.shapeDefs[voxelShapeDefID];
-			const CollisionShapeDefID collisionShapeDefID = collisionChunk.shapeDefIDs.get(combinedBoxMin.x, combinedBoxMin.y, combinedBoxMin.z);
+			const CollisionShapeDefID collisionShapeDefID = collisionChunk.shapeDefIDs.get(boxMin.x, boxMin.y, boxMin.z);
 			const CollisionShapeDefinition &collisionShapeDef = collisionChunk.getCollisionShapeDef(collisionShapeDefID);
 
 			boxShapeSettingsList.emplace_back(new JPH::BoxShapeSettings());
@@ -132,21 +170,15 @@ namespace
 
 			JPH::Vec3 boxPosition;
 			JPH::Quat boxRotation;
-			MakePhysicsColliderInitValues(combinedBoxMin.x, combinedBoxMin.y, combinedBoxMin.z, combinedBoxMax.x, combinedBoxMax.y, combinedBoxMax.z,
-				chunkPos, collisionShapeDef, voxelShapeDef.scaleType, ceilingScale, isSensorCollider, physicsSystem, boxShapeSettings, &boxPosition, &boxRotation);
+			MakePhysicsColliderInitValues(boxMin.x, boxMin.y, boxMin.z, boxMax.x, boxMax.y, boxMax.z, chunkPos, collisionShapeDef,
+				voxelShapeDef.scaleType, ceilingScale, isSensorCollider, physicsSystem, boxShapeSettings, &boxPosition, &boxRotation);
 
 			compoundShapeSettings.AddShape(boxPosition, boxRotation, boxShapeSettings);
 		}
 
-		if (compoundShapeSettings.mSubShapes.empty())
-		{
-			// Jolt doesn't like creating a compound shape with 0 sub-shapes
-			return Physics::INVALID_BODY_ID;
-		}
-
 		const JPH::Vec3 compoundBodyPosition = JPH::Vec3::sZero();
 		const JPH::Quat compoundBodyRotation = JPH::Quat::sIdentity();
-		const JPH::ObjectLayer objectLayer = (category == CompoundShapeCategory::Sensors) ? PhysicsLayers::SENSOR : PhysicsLayers::NON_MOVING;
+		const JPH::ObjectLayer objectLayer = isSensorCollider ? PhysicsLayers::SENSOR : PhysicsLayers::NON_MOVING;
 		JPH::BodyCreationSettings compoundBodyCreationSettings(&compoundShapeSettings, compoundBodyPosition, compoundBodyRotation, JPH::EMotionType::Static, objectLayer);
 
 		if (category == CompoundShapeCategory::Walls)
@@ -154,7 +186,7 @@ namespace
 			// Keep player from erratically hopping/skipping as much when running due to no contact welding in Jolt.
 			compoundBodyCreationSettings.mEnhancedInternalEdgeRemoval = true;
 		}
-		else if (category == CompoundShapeCategory::Sensors)
+		else if (isSensorCollider)
 		{
 			compoundBodyCreationSettings.mIsSensor = true;
 		}
@@ -163,6 +195,131 @@ namespace
 		JPH::BodyID compoundBodyID = bodyInterface.CreateAndAddBody(compoundBodyCreationSettings, JPH::EActivation::Activate);
 		return compoundBodyID;
 	}
+
+	// Recreates the bodies of each category in the regions set in that category's bit mask. A region's bodies
+	// only depend on the voxels inside it, so regions without dirty voxels can keep theirs.
+	void RebuildRegionCompoundShapes(CollisionChunk &collisionChunk, double ceilingScale, const uint32_t (&regionMasks)[CompoundShapeCategoryCount],
+		const VoxelChunk &voxelChunk, const VoxelBoxCombineChunk &boxCombineChunk, JPH::PhysicsSystem &physicsSystem)
+	{
+		static_assert(CollisionChunk::REGION_COUNT <= 32);
+
+		JPH::BodyInterface &bodyInterface = physicsSystem.GetBodyInterface();
+		for (int categoryIndex = 0; categoryIndex < CompoundShapeCategoryCount; categoryIndex++)
+		{
+			const CompoundShapeCategory category = static_cast<CompoundShapeCategory>(categoryIndex);
+			const uint32_t regionMask = regionMasks[categoryIndex];
+			for (int regionIndex = 0; regionIndex < CollisionChunk::REGION_COUNT; regionIndex++)
+			{
+				if ((regionMask & (1u << regionIndex)) == 0)
+				{
+					continue;
+				}
+
+				JPH::BodyID &bodyID = GetRegionCompoundBodyID(collisionChunk.regions[regionIndex], category);
+				if (!bodyID.IsInvalid())
+				{
+					bodyInterface.RemoveBody(bodyID);
+					bodyInterface.DestroyBody(bodyID);
+					bodyID = Physics::INVALID_BODY_ID;
+				}
+			}
+		}
+
+		// Split combined boxes at region borders.
+		std::vector<RegionBox> regionBoxesLists[CollisionChunk::REGION_COUNT][CompoundShapeCategoryCount];
+		const KeyValuePool<VoxelBoxCombineResultID, VoxelBoxCombineResult> &combinedBoxesPool = boxCombineChunk.combinedBoxesPool;
+		for (const VoxelBoxCombineResult &combinedBoxResult : combinedBoxesPool.values)
+		{
+			const VoxelInt3 combinedBoxMin = combinedBoxResult.min;
+			const VoxelInt3 combinedBoxMax = combinedBoxResult.max;
+			const int regionXStart = combinedBoxMin.x / CollisionChunk::REGION_DIM;
+			const int regionXEnd = combinedBoxMax.x / CollisionChunk::REGION_DIM;
+			const int regionZStart = combinedBoxMin.z / CollisionChunk::REGION_DIM;
+			const int regionZEnd = combinedBoxMax.z / CollisionChunk::REGION_DIM;
+
+			for (int regionZ = regionZStart; regionZ <= regionZEnd; regionZ++)
+			{
+				for (int regionX = regionXStart; regionX <= regionXEnd; regionX++)
+				{
+					const int regionIndex = regionX + (regionZ * CollisionChunk::REGION_COUNT_X);
+					const uint32_t regionBit = 1u << regionIndex;
+
+					RegionBox regionBox;
+					regionBox.min = VoxelInt3(
+						std::max(combinedBoxMin.x, regionX * CollisionChunk::REGION_DIM),
+						combinedBoxMin.y,
+						std::max(combinedBoxMin.z, regionZ * CollisionChunk::REGION_DIM));
+					regionBox.max = VoxelInt3(
+						std::min(combinedBoxMax.x, ((regionX + 1) * CollisionChunk::REGION_DIM) - 1),
+						combinedBoxMax.y,
+						std::min(combinedBoxMax.z, ((regionZ + 1) * CollisionChunk::REGION_DIM) - 1));
+
+					for (int categoryIndex = 0; categoryIndex < CompoundShapeCategoryCount; categoryIndex++)
+					{
+						if ((regionMasks[categoryIndex] & regionBit) == 0)
+						{
+							continue;
+						}
+
+						const CompoundShapeCategory category = static_cast<CompoundShapeCategory>(categoryIndex);
+						if (IsRegionBoxInCategory(regionBox.min, category, collisionChunk, voxelChunk))
+						{
+							regionBoxesLists[regionIndex][categoryIndex].emplace_back(regionBox);
+						}
+					}
+				}
+			}
+		}
+
+		for (int categoryIndex = 0; categoryIndex < CompoundShapeCategoryCount; categoryIndex++)
+		{
+			const CompoundShapeCategory category = static_cast<CompoundShapeCategory>(categoryIndex);
+			const uint32_t regionMask = regionMasks[categoryIndex];
+			for (int regionIndex = 0; regionIndex < CollisionChunk::REGION_COUNT; regionIndex++)
+			{
+				if ((regionMask & (1u << regionIndex)) == 0)
+				{
+					continue;
+				}
+
+				const std::vector<RegionBox> &regionBoxes = regionBoxesLists[regionIndex][categoryIndex];
+				JPH::BodyID &bodyID = GetRegionCompoundBodyID(collisionChunk.regions[regionIndex], category);
+				bodyID = CreateRegionCompoundShape(collisionChunk, ceilingScale, category, regionBoxes, voxelChunk, physicsSystem);
+			}
+		}
+	}
+
+	void UpdateVoxelShapeDef(CollisionChunk &collisionChunk, const VoxelChunk &voxelChunk, SNInt x, int y, WEInt z)
+	{
+		const VoxelShapeDefID voxelShapeDefID = voxelChunk.shapeDefIDs.get(x, y, z);
+		CollisionShapeDefID collisionShapeDefID = collisionChunk.findShapeDefIdMapping(voxelChunk, voxelShapeDefID);
+		if (collisionShapeDefID == -1)
+		{
+			collisionShapeDefID = collisionChunk.addShapeDefIdMapping(voxelChunk, voxelShapeDefID);
+		}
+
+		collisionChunk.shapeDefIDs.set(x, y, z, collisionShapeDefID);
+	}
+
+	void UpdateVoxelEnabledCollider(CollisionChunk &collisionChunk, const VoxelChunk &voxelChunk, SNInt x, int y, WEInt z)
+	{
+		bool voxelHasCollision = false;
+
+		int doorAnimInstIndex;
+		if (voxelChunk.tryGetDoorAnimInstIndex(x, y, z, &doorAnimInstIndex))
+		{
+			const VoxelDoorAnimationInstance &doorAnimInst = voxelChunk.doorAnimInsts[doorAnimInstIndex];
+			voxelHasCollision = doorAnimInst.stateType == VoxelDoorAnimationStateType::Closed;
+		}
+		else
+		{
+			const VoxelTraitsDefID voxelTraitsDefID = voxelChunk.traitsDefIDs.get(x, y, z);
+			const VoxelTraitsDefinition &voxelTraitsDef = voxelChunk.traitsDefs[voxelTraitsDefID];
+			voxelHasCollision = voxelTraitsDef.hasCollision();
+		}
+
+		collisionChunk.enabledColliders.set(x, y, z, voxelHasCollision);
+	}
 }
 
 void CollisionChunkManager::populateChunkShapeDefs(CollisionChunk &collisionChunk, const VoxelChunk &voxelChunk)
@@ -175,14 +332,7 @@ void CollisionChunkManager::populateChunkShapeDefs(CollisionChunk &collisionChun
 		{
 			for (SNInt x = 0; x < Chunk::WIDTH; x++)
 			{
-				const VoxelShapeDefID voxelShapeDefID = voxelChunk.shapeDefIDs.get(x, y, z);
-				CollisionShapeDefID collisionShapeDefID = collisionChunk.findShapeDefIdMapping(voxelChunk, voxelShapeDefID);
-				if (collisionShapeDefID == -1)
-				{
-					collisionShapeDefID = collisionChunk.addShapeDefIdMapping(voxelChunk, voxelShapeDefID);
-				}
-
-				collisionChunk.shapeDefIDs.set(x, y, z, collisionShapeDefID);
+				UpdateVoxelShapeDef(collisionChunk, voxelChunk, x, y, z);
 			}
 		}
 	}
@@ -198,22 +348,7 @@ void CollisionChunkManager::populateChunkEnabledColliders(CollisionChunk &collis
 		{
 			for (SNInt x = 0; x < Chunk::WIDTH; x++)
 			{
-				bool voxelHasCollision = false;
-
-				int doorAnimInstIndex;
-				if (voxelChunk.tryGetDoorAnimInstIndex(x, y, z, &doorAnimInstIndex))
-				{
-					const VoxelDoorAnimationInstance &doorAnimInst = voxelChunk.doorAnimInsts[doorAnimInstIndex];
-					voxelHasCollision = doorAnimInst.stateType == VoxelDoorAnimationStateType::Closed;
-				}
-				else
-				{
-					const VoxelTraitsDefID voxelTraitsDefID = voxelChunk.traitsDefIDs.get(x, y, z);
-					const VoxelTraitsDefinition &voxelTraitsDef = voxelChunk.traitsDefs[voxelTraitsDefID];
-					voxelHasCollision = voxelTraitsDef.hasCollision();
-				}
-
-				collisionChunk.enabledColliders.set(x, y, z, voxelHasCollision);
+				UpdateVoxelEnabledCollider(collisionChunk, voxelChunk, x, y, z);
 			}
 		}
 	}
@@ -226,64 +361,48 @@ void CollisionChunkManager::populateChunk(int index, double ceilingScale, const
 	CollisionChunk &collisionChunk = this->getChunkAtIndex(index);
 	collisionChunk.init(chunkPos, chunkHeight);
 
-	this->populateChunkShapeDefs(collisionChunk, voxelChunk); // @todo: give positions span that is all WxHxD
-	this->populateChunkEnabledColliders(collisionChunk, voxelChunk); // @todo: give positions span that is all WxHxD
+	this->populateChunkShapeDefs(collisionChunk, voxelChunk);
+	this->populateChunkEnabledColliders(collisionChunk, voxelChunk);
 
-	DebugAssert(collisionChunk.wallCompoundBodyID == Physics::INVALID_BODY_ID);
-	DebugAssert(collisionChunk.doorCompoundBodyID == Physics::INVALID_BODY_ID);
-	DebugAssert(collisionChunk.sensorCompoundBodyID == Physics::INVALID_BODY_ID);
-	collisionChunk.wallCompoundBodyID = CreateChunkCompoundShape(collisionChunk, ceilingScale, CompoundShapeCategory::Walls, voxelChunk, boxCombineChunk, physicsSystem);
-	collisionChunk.doorCompoundBodyID = CreateChunkCompoundShape(collisionChunk, ceilingScale, CompoundShapeCategory::Doors, voxelChunk, boxCombineChunk, physicsSystem);
-	collisionChunk.sensorCompoundBodyID = CreateChunkCompoundShape(collisionChunk, ceilingScale, CompoundShapeCategory::Sensors, voxelChunk, boxCombineChunk, physicsSystem);
+	constexpr uint32_t allRegionsMask = (CollisionChunk::REGION_COUNT == 32) ? ~0u : ((1u << CollisionChunk::REGION_COUNT) - 1);
+	const uint32_t regionMasks[CompoundShapeCategoryCount] = { allRegionsMask, allRegionsMask, allRegionsMask };
+	RebuildRegionCompoundShapes(collisionChunk, ceilingScale, regionMasks, voxelChunk, boxCombineChunk, physicsSystem);
 }
 
 void CollisionChunkManager::updateDirtyVoxels(const ChunkInt2 &chunkPos, double ceilingScale, const VoxelChunk &voxelChunk,
 	const VoxelBoxCombineChunk &boxCombineChunk, JPH::PhysicsSystem &physicsSystem)
 {
 	CollisionChunk &collisionChunk = this->getChunkAtPosition(chunkPos);
-	JPH::BodyInterface &bodyInterface = physicsSystem.GetBodyInterface();
-
-	// @todo: this dirty shapes list might be full of brand new voxels this frame, so we're accidentally destroying + recreating them all (found during the AddBodiesPrepare/Finalize() work)
 
 	const Span<const VoxelInt3> dirtyShapeDefPositions = voxelChunk.dirtyShapeDefPositions;
 	const Span<const VoxelInt3> dirtyDoorAnimInstPositions = voxelChunk.dirtyDoorAnimInstPositions;
 
-	if (dirtyShapeDefPositions.getCount() > 0)
+	// Walls and sensors change with voxel shapes, doors change with door animations.
+	uint32_t shapeRegionMask = 0;
+	for (const VoxelInt3 voxel : dirtyShapeDefPositions)
 	{
-		if (collisionChunk.wallCompoundBodyID != Physics::INVALID_BODY_ID)
-		{
-			bodyInterface.RemoveBody(collisionChunk.wallCompoundBodyID);
-			bodyInterface.DestroyBody(collisionChunk.wallCompoundBodyID);
-			collisionChunk.wallCompoundBodyID = Physics::INVALID_BODY_ID;
-		}
-
-		if (collisionChunk.sensorCompoundBodyID != Physics::INVALID_BODY_ID)
-		{
-			bodyInterface.RemoveBody(collisionChunk.sensorCompoundBodyID);
-			bodyInterface.DestroyBody(collisionChunk.sensorCompoundBodyID);
-			collisionChunk.sensorCompoundBodyID = Physics::INVALID_BODY_ID;
-		}
-
-		this->populateChunkShapeDefs(collisionChunk, voxelChunk); // @todo: give dirty positions span so it's much faster
-		this->populateChunkEnabledColliders(collisionChunk, voxelChunk); // @todo: give dirty positions span so it's much faster
-
-		collisionChunk.wallCompoundBodyID = CreateChunkCompoundShape(collisionChunk, ceilingScale, CompoundShapeCategory::Walls, voxelChunk, boxCombineChunk, physicsSystem);
-		collisionChunk.sensorCompoundBodyID = CreateChunkCompoundShape(collisionChunk, ceilingScale, CompoundShapeCategory::Sensors, voxelChunk, boxCombineChunk, physicsSystem);
+		UpdateVoxelShapeDef(collisionChunk, voxelChunk, voxel.x, voxel.y, voxel.z);
+		UpdateVoxelEnabledCollider(collisionChunk, voxelChunk, voxel.x, voxel.y, voxel.z);
+		shapeRegionMask |= 1u << CollisionChunk::getRegionIndex(voxel.x, voxel.z);
 	}
 
-	if (dirtyDoorAnimInstPositions.getCount() > 0)
+	uint32_t doorRegionMask = 0;
+	for (const VoxelInt3 voxel : dirtyDoorAnimInstPositions)
 	{
-		if (collisionChunk.doorCompoundBodyID != Physics::INVALID_BODY_ID)
-		{
-			bodyInterface.RemoveBody(collisionChunk.doorCompoundBodyID);
-			bodyInterface.DestroyBody(collisionChunk.doorCompoundBodyID);
-			collisionChunk.doorCompoundBodyID = Physics::INVALID_BODY_ID;
-		}
-
-		this->populateChunkEnabledColliders(collisionChunk, voxelChunk); // @todo: give dirty positions span so it's much faster
+		UpdateVoxelEnabledCollider(collisionChunk, voxelChunk, voxel.x, voxel.y, voxel.z);
+		doorRegionMask |= 1u << CollisionChunk::getRegionIndex(voxel.x, voxel.z);
+	}
 
-		collisionChunk.doorCompoundBodyID = CreateChunkCompoundShape(collisionChunk, ceilingScale, CompoundShapeCategory::Doors, voxelChunk, boxCombineChunk, physicsSystem);
+	if ((shapeRegionMask == 0) && (doorRegionMask == 0))
+	{
+		return;
 	}
+
+	uint32_t regionMasks[CompoundShapeCategoryCount];
+	regionMasks[static_cast<int>(CompoundShapeCategory::Walls)] = shapeRegionMask;
+	regionMasks[static_cast<int>(CompoundShapeCategory::Doors)] = doorRegionMask;
+	regionMasks[static_cast<int>(CompoundShapeCategory::Sensors)] = shapeRegionMask;
+	RebuildRegionCompoundShapes(collisionChunk, ceilingScale, regionMasks, voxelChunk, boxCombineChunk, physicsSystem);
 }
 
 void CollisionChunkManager::update(double dt, Span<const ChunkInt2> activeChunkPositions, Span<const ChunkInt2> newChunkPositions,
@@ -302,21 +421,28 @@ void CollisionChunkManager::update(double dt, Span<const ChunkInt2> activeChunkP
 
 	for (const ChunkInt2 chunkPos : newChunkPositions)
 	{
-		const int spawnIndex = this->spawnChunk();
+		const int spawnIndex = this->spawnChunk(chunkPos);
 		const VoxelChunk &voxelChunk = voxelChunkManager.getChunkAtPosition(chunkPos);
 		const VoxelBoxCombineChunk &boxCombineChunk = voxelBoxCombineChunkManager.getChunkAtPosition(chunkPos);
 		this->populateChunk(spawnIndex, ceilingScale, chunkPos, voxelChunk, boxCombineChunk, physicsSystem);
 	}
 
-	// Update dirty voxels.
+	// Update dirty voxels. New chunks were just built from their current voxels so every voxel in them is already
+	// up to date.
 	for (const ChunkInt2 chunkPos : activeChunkPositions)
 	{
+		const auto newChunkIter = std::find(newChunkPositions.begin(), newChunkPositions.end(), chunkPos);
+		if (newChunkIter != newChunkPositions.end())
+		{
+			continue;
+		}
+
 		const VoxelChunk &voxelChunk = voxelChunkManager.getChunkAtPosition(chunkPos);
 		const VoxelBoxCombineChunk &boxCombineChunk = voxelBoxCombineChunkManager.getChunkAtPosition(chunkPos);
 		this->updateDirtyVoxels(chunkPos, ceilingScale, voxelChunk, boxCombineChunk, physicsSystem);
 	}
 
-	this->chunkPool.clear();
+	this->trimChunkPool();
 }
 
 void CollisionChunkManager::clear(JPH::PhysicsSystem &physicsSystem)
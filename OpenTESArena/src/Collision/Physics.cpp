@@ -2,6 +2,7 @@
 #include <cmath>
 
 #include "Physics.h"
+#include "RayCastEntityIndex.h"
 #include "RayCastTypes.h"
 #include "../Assets/ArenaTypes.h"
 #include "../Assets/MIFFile.h"
@@ -21,175 +22,6 @@
 
 namespace Physics
 {
-	struct EntityEntry
-	{
-		CoordDouble3 coord;
-		EntityObservedResult observedResult;
-
-		void init(const CoordDouble3 &coord, const EntityObservedResult &observedResult)
-		{
-			this->coord = coord;
-			this->observedResult = observedResult;
-		}
-	};
-
-	// Container of the voxels each entity is touching per chunk. Each chunk needs to look at adjacent chunk
-	// entities in case some of them overlap the chunk edge.
-	struct ChunkEntityMap
-	{
-		ChunkInt2 chunk;
-		std::unordered_map<VoxelInt3, std::vector<EntityEntry>> mappings;
-
-		void init(const ChunkInt2 &chunk)
-		{
-			this->chunk = chunk;
-		}
-
-		void add(const VoxelInt3 &voxel, const EntityEntry &entry)
-		{
-			auto iter = this->mappings.find(voxel);
-			if (iter == this->mappings.end())
-			{
-				iter = this->mappings.emplace(voxel, std::vector<EntityEntry>()).first;
-			}
-
-			std::vector<EntityEntry> &entryList = iter->second;
-			entryList.emplace_back(entry);
-		}
-	};
-
-	// Builds a set of voxels for a chunk that are at least partially touched by entities. A point of reference
-	// is needed for evaluating entity animations. Ignores entities behind the camera.
-	Physics::ChunkEntityMap makeChunkEntityMap(const ChunkInt2 &chunk, const CoordDouble3 &viewCoord,
-		double ceilingScale, const VoxelChunkManager &voxelChunkManager, const EntityChunkManager &entityChunkManager,
-		const EntityDefinitionLibrary &entityDefLibrary)
-	{
-		// Include entities within one chunk of the center chunk to get entities that are partially touching
-		// the center chunk.
-		constexpr int chunkDistance = 1;
-		ChunkInt2 minChunk, maxChunk;
-		ChunkUtils::getSurroundingChunks(chunk, chunkDistance, &minChunk, &maxChunk);
-
-		// Gather up entities in nearby chunks.
-		const int totalNearbyEntities = [&entityChunkManager, &minChunk, &maxChunk]()
-		{
-			int count = 0;
-			for (WEInt z = minChunk.y; z <= maxChunk.y; z++)
-			{
-				for (SNInt x = minChunk.x; x <= maxChunk.x; x++)
-				{
-					const EntityChunk *entityChunkPtr = entityChunkManager.findChunkAtPosition(ChunkInt2(x, z));
-					if (entityChunkPtr != nullptr)
-					{
-						count += static_cast<int>(entityChunkPtr->entityIDs.size());
-					}
-				}
-			}
-
-			return count;
-		}();
-
-		Buffer<EntityInstanceID> entityInstIDs(totalNearbyEntities);
-		entityInstIDs.fill(-1);
-
-		int entityInsertIndex = 0;
-		auto addEntitiesFromChunk = [&entityChunkManager, &entityInstIDs, &entityInsertIndex](SNInt chunkX, WEInt chunkZ)
-		{
-			EntityInstanceID *entityInstIDsPtr = entityInstIDs.begin() + entityInsertIndex;
-			const int size = entityInstIDs.getCount() - entityInsertIndex;
-			const EntityChunk *entityChunkPtr = entityChunkManager.findChunkAtPosition(ChunkInt2(chunkX, chunkZ));
-			if (entityChunkPtr != nullptr)
-			{
-				int writtenCount = 0;
-				for (size_t i = 0; i < entityChunkPtr->entityIDs.size(); i++)
-				{
-					if (writtenCount >= size)
-					{
-						break;
-					}
-
-					entityInstIDsPtr[i] = entityChunkPtr->entityIDs[i];
-					writtenCount++;
-				}
-
-				DebugAssert(writtenCount <= size);
-				entityInsertIndex += writtenCount;
-			}
-		};
-
-		for (WEInt z = minChunk.y; z <= maxChunk.y; z++)
-		{
-			for (SNInt x = minChunk.x; x <= maxChunk.x; x++)
-			{
-				addEntitiesFromChunk(x, z);
-			}
-		}
-
-		const WorldDouble3 viewPosition = VoxelUtils::coordToWorldPoint(viewCoord);
-
-		ChunkEntityMap chunkEntityMap;
-		chunkEntityMap.init(chunk);
-
-		// Build mappings of voxels to entities.
-		for (const EntityInstanceID entityInstID : entityInstIDs)
-		{
-			const EntityInstance &entityInst = entityChunkManager.getEntity(entityInstID);
-
-			EntityObservedResult observedResult;
-			entityChunkManager.getEntityObservedResult(entityInstID, viewPosition, observedResult);
-
-			// Iterate over the voxels the entity's bounding box touches.
-			const WorldDouble3 entityPosition = entityChunkManager.getEntityPosition(entityInstID);
-			const CoordDouble3 entityCoord = VoxelUtils::worldPointToCoord(entityPosition);
-			const BoundingBox3D &entityBBox = entityChunkManager.getEntityBoundingBox(entityInst.bboxID);
-			const WorldDouble3 entityMinWorldPoint = entityPosition - Double3(entityBBox.halfWidth, 0.0, entityBBox.halfDepth);
-			const WorldDouble3 entityMaxWorldPoint = entityPosition + Double3(entityBBox.halfWidth, entityBBox.height, entityBBox.halfDepth);
-			const WorldInt3 entityMinWorldVoxel = VoxelUtils::pointToVoxel(entityMinWorldPoint, ceilingScale);
-			const WorldInt3 entityMaxWorldVoxel = VoxelUtils::pointToVoxel(entityMaxWorldPoint, ceilingScale);
-			const WorldInt3 voxelCoordDiff = entityMaxWorldVoxel - entityMinWorldVoxel;
-
-			for (WEInt z = 0; z <= voxelCoordDiff.z; z++)
-			{
-				for (int y = 0; y <= voxelCoordDiff.y; y++)
-				{
-					for (SNInt x = 0; x <= voxelCoordDiff.x; x++)
-					{
-						const WorldInt3 curWorldVoxel(entityMinWorldVoxel.x + x, entityMinWorldVoxel.y + y, entityMinWorldVoxel.z + z);
-						const CoordInt3 curCoord = VoxelUtils::worldVoxelToCoord(curWorldVoxel);
-
-						if (curCoord.chunk == chunk)
-						{
-							EntityEntry entry;
-							entry.init(entityCoord, observedResult);
-							chunkEntityMap.add(curCoord.voxel, entry);
-						}
-					}
-				}
-			}
-		}
-
-		return chunkEntityMap;
-	}
-
-	// The given chunk coordinate is known to be loaded.
-	const ChunkEntityMap &getOrAddChunkEntityMap(const ChunkInt2 &chunk, const CoordDouble3 &viewCoord,
-		double ceilingScale, const VoxelChunkManager &voxelChunkManager, const EntityChunkManager &entityChunkManager,
-		const EntityDefinitionLibrary &entityDefLibrary, std::vector<ChunkEntityMap> &chunkEntityMaps)
-	{
-		for (const ChunkEntityMap &map : chunkEntityMaps)
-		{
-			if (map.chunk == chunk)
-			{
-				return map;
-			}
-		}
-
-		ChunkEntityMap newMap = Physics::makeChunkEntityMap(chunk, viewCoord, ceilingScale, voxelChunkManager,
-			entityChunkManager, entityDefLibrary);
-		chunkEntityMaps.emplace_back(std::move(newMap));
-		return chunkEntityMaps.back();
-	}
-
 	bool getEntityRayIntersection(const EntityObservedResult &observedResult, const CoordDouble3 &entityCoord, const EntityDefinition &entityDef,
 		const VoxelDouble3 &entityForward, const VoxelDouble3 &entityRight, const VoxelDouble3 &entityUp, double entityWidth, double entityHeight,
 		const WorldDouble3 &rayWorldPoint, const VoxelDouble3 &rayDirection, WorldDouble3 *outHitPoint)
@@ -357,8 +189,8 @@ namespace Physics
 	// Helper function for testing which entities in a voxel are intersected by a ray.
 	bool testEntitiesInVoxel(const CoordDouble3 &rayCoord, const VoxelDouble3 &rayDirection,
 		const VoxelDouble3 &flatForward, const VoxelDouble3 &flatRight, const VoxelDouble3 &flatUp,
-		const VoxelInt3 &voxel, const ChunkEntityMap &chunkEntityMap, const EntityChunkManager &entityChunkManager,
-		const EntityDefinitionLibrary &entityDefLibrary, RayCastHit &hit)
+		const CoordInt3 &voxelCoord, double ceilingScale, const EntityChunkManager &entityChunkManager,
+		RayCastEntityIndex &entityIndex, RayCastHit &hit)
 	{
 		const WorldDouble3 rayWorldPoint = VoxelUtils::coordToWorldPoint(rayCoord); // @todo just use WorldDouble3 everywhere?
 
@@ -366,35 +198,34 @@ namespace Physics
 		RayCastHit entityHit;
 		entityHit.t = RayCastHit::NO_HIT_DISTANCE;
 
-		const auto &entityMappings = chunkEntityMap.mappings;
-		const auto iter = entityMappings.find(voxel);
-		if (iter != entityMappings.end())
+		// Iterate over all entities that cross this voxel and ray test them.
+		const Span<const EntityInstanceID> entityInstIDs = entityIndex.getEntitiesInVoxel(voxelCoord, ceilingScale, entityChunkManager);
+		for (const EntityInstanceID entityInstID : entityInstIDs)
 		{
-			// Iterate over all entities that cross this voxel and ray test them.
-			Span<const EntityEntry> entityEntryList = iter->second;
-			for (const EntityEntry &entry : entityEntryList)
+			// The ray start is the point of reference for entity animations.
+			EntityObservedResult observedResult;
+			entityChunkManager.getEntityObservedResult(entityInstID, rayWorldPoint, observedResult);
+			const int linearizedKeyframeIndex = observedResult.linearizedKeyframeIndex;
+
+			const EntityInstance &entityInst = entityChunkManager.getEntity(entityInstID);
+			const EntityDefinition &entityDef = entityChunkManager.getEntityDef(entityInst.defID);
+			const EntityAnimationDefinition &animDef = entityDef.animDef;
+			DebugAssertIndex(animDef.keyframes, linearizedKeyframeIndex);
+			const EntityAnimationDefinitionKeyframe &animKeyframe = animDef.keyframes[linearizedKeyframeIndex];
+			const double flatWidth = animKeyframe.width;
+			const double flatHeight = animKeyframe.height;
+
+			const WorldDouble3 entityPosition = entityChunkManager.getEntityPosition(entityInst.positionID);
+			const CoordDouble3 entityCoord = VoxelUtils::worldPointToCoord(entityPosition);
+
+			WorldDouble3 hitWorldPoint;
+			if (Physics::getEntityRayIntersection(observedResult, entityCoord, entityDef, flatForward, flatRight, flatUp,
+				flatWidth, flatHeight, rayWorldPoint, rayDirection, &hitWorldPoint))
 			{
-				const EntityObservedResult &observedResult = entry.observedResult;
-				const EntityInstanceID entityInstID = observedResult.entityInstID;
-				const int linearizedKeyframeIndex = observedResult.linearizedKeyframeIndex;
-
-				const EntityInstance &entityInst = entityChunkManager.getEntity(entityInstID);
-				const EntityDefinition &entityDef = entityChunkManager.getEntityDef(entityInst.defID);
-				const EntityAnimationDefinition &animDef = entityDef.animDef;
-				DebugAssertIndex(animDef.keyframes, linearizedKeyframeIndex);
-				const EntityAnimationDefinitionKeyframe &animKeyframe = animDef.keyframes[linearizedKeyframeIndex];
-				const double flatWidth = animKeyframe.width;
-				const double flatHeight = animKeyframe.height;
-
-				WorldDouble3 hitWorldPoint;
-				if (Physics::getEntityRayIntersection(observedResult, entry.coord, entityDef, flatForward, flatRight, flatUp,
-					flatWidth, flatHeight, rayWorldPoint, rayDirection, &hitWorldPoint))
+				const double distance = (hitWorldPoint - rayWorldPoint).length();
+				if (distance < entityHit.t)
 				{
-					const double distance = (hitWorldPoint - rayWorldPoint).length();
-					if (distance < entityHit.t)
-					{
-						entityHit.initEntity(distance, hitWorldPoint, entityInstID);
-					}
+					entityHit.initEntity(distance, hitWorldPoint, entityInstID);
 				}
 			}
 		}
@@ -416,8 +247,7 @@ namespace Physics
 	template<bool NonNegativeDirX, bool NonNegativeDirY, bool NonNegativeDirZ>
 	void rayCastInternal(const CoordDouble3 &rayCoord, const VoxelDouble3 &rayDirection, const VoxelDouble3 &cameraForward,
 		double ceilingScale, const VoxelChunkManager &voxelChunkManager, const EntityChunkManager &entityChunkManager,
-		const CollisionChunkManager &collisionChunkManager, bool includeEntities, const EntityDefinitionLibrary &entityDefLibrary,
-		std::vector<ChunkEntityMap> &chunkEntityMaps, RayCastHit &hit)
+		const CollisionChunkManager &collisionChunkManager, bool includeEntities, RayCastEntityIndex &entityIndex, RayCastHit &hit)
 	{
 		// Each flat shares the same axes. Their forward direction always faces opposite to the camera direction.
 		const VoxelDouble3 flatForward = VoxelDouble3(-cameraForward.x, 0.0, -cameraForward.z).normalized();
@@ -542,10 +372,9 @@ namespace Physics
 			if (includeEntities)
 			{
 				// Test the initial voxel's entities for ray intersections.
-				const ChunkEntityMap &chunkEntityMap = Physics::getOrAddChunkEntityMap(currentChunk, rayCoord,
-					ceilingScale, voxelChunkManager, entityChunkManager, entityDefLibrary, chunkEntityMaps);
+				const CoordInt3 rayVoxelCoord(currentChunk, rayVoxel);
 				success |= Physics::testEntitiesInVoxel(rayCoord, rayDirection, flatForward, flatRight, flatUp,
-					rayVoxel, chunkEntityMap, entityChunkManager, entityDefLibrary, hit);
+					rayVoxelCoord, ceilingScale, entityChunkManager, entityIndex, hit);
 			}
 
 			if (success)
@@ -681,10 +510,8 @@ namespace Physics
 			if (includeEntities)
 			{
 				// Test the current voxel's entities for ray intersections.
-				const ChunkEntityMap &chunkEntityMap = Physics::getOrAddChunkEntityMap(savedVoxelCoord.chunk, rayCoord,
-					ceilingScale, voxelChunkManager, entityChunkManager, entityDefLibrary, chunkEntityMaps);
 				success |= Physics::testEntitiesInVoxel(rayCoord, rayDirection, flatForward, flatRight, flatUp,
-					savedVoxelCoord.voxel, chunkEntityMap, entityChunkManager, entityDefLibrary, hit);
+					savedVoxelCoord, ceilingScale, entityChunkManager, entityIndex, hit);
 			}
 
 			if (success)
@@ -694,97 +521,106 @@ namespace Physics
 			}
 		}
 	}
-}
 
-bool Physics::rayCast(const CoordDouble3 &rayStart, const VoxelDouble3 &rayDirection, double ceilingScale,
-	const VoxelDouble3 &cameraForward, bool includeEntities, const VoxelChunkManager &voxelChunkManager,
-	const EntityChunkManager &entityChunkManager, const CollisionChunkManager &collisionChunkManager,
-	const EntityDefinitionLibrary &entityDefLibrary, RayCastHit &hit)
-{
-	// Set the hit distance to max. This will ensure that if we don't hit a voxel but do hit an
-	// entity, the distance can still be used.
-	hit.t = RayCastHit::NO_HIT_DISTANCE;
-
-	// Voxel->entity mappings for each chunk touched by the ray casting loop.
-	std::vector<ChunkEntityMap> chunkEntityMaps;
+	void rayCastDispatch(const CoordDouble3 &rayStart, const VoxelDouble3 &rayDirection, double ceilingScale,
+		const VoxelDouble3 &cameraForward, bool includeEntities, const VoxelChunkManager &voxelChunkManager,
+		const EntityChunkManager &entityChunkManager, const CollisionChunkManager &collisionChunkManager,
+		RayCastEntityIndex &entityIndex, RayCastHit &hit)
+	{
+		// Set the hit distance to max. This will ensure that if we don't hit a voxel but do hit an
+		// entity, the distance can still be used.
+		hit.t = RayCastHit::NO_HIT_DISTANCE;
 
-	// Ray cast through the voxel grid, populating the output hit data. Use the ray direction booleans for
-	// better code generation (at the expense of having a pile of if/else branches here).
-	const bool nonNegativeDirX = rayDirection.x >= 0.0;
-	const bool nonNegativeDirY = rayDirection.y >= 0.0;
-	const bool nonNegativeDirZ = rayDirection.z >= 0.0;
+		// Ray cast through the voxel grid, populating the output hit data. Use the ray direction booleans for
+		// better code generation (at the expense of having a pile of if/else branches here).
+		const bool nonNegativeDirX = rayDirection.x >= 0.0;
+		const bool nonNegativeDirY = rayDirection.y >= 0.0;
+		const bool nonNegativeDirZ = rayDirection.z >= 0.0;
 
-	if (nonNegativeDirX)
-	{
-		if (nonNegativeDirY)
-		{
-			if (nonNegativeDirZ)
-			{
-				Physics::rayCastInternal<true, true, true>(rayStart, rayDirection, cameraForward, ceilingScale,
-					voxelChunkManager, entityChunkManager, collisionChunkManager, includeEntities, entityDefLibrary,
-					chunkEntityMaps, hit);
-			}
-			else
-			{
-				Physics::rayCastInternal<true, true, false>(rayStart, rayDirection, cameraForward, ceilingScale,
-					voxelChunkManager, entityChunkManager, collisionChunkManager, includeEntities, entityDefLibrary,
-					chunkEntityMaps, hit);
-			}
-		}
-		else
+		if (nonNegativeDirX)
 		{
-			if (nonNegativeDirZ)
-			{
-				Physics::rayCastInternal<true, false, true>(rayStart, rayDirection, cameraForward, ceilingScale,
-					voxelChunkManager, entityChunkManager, collisionChunkManager, includeEntities, entityDefLibrary,
-					chunkEntityMaps, hit);
-			}
-			else
+			if (nonNegativeDirY)
 			{
-				Physics::rayCastInternal<true, false, false>(rayStart, rayDirection, cameraForward, ceilingScale,
-					voxelChunkManager, entityChunkManager, collisionChunkManager, includeEntities, entityDefLibrary,
-					chunkEntityMaps, hit);
-			}
-		}
-	}
-	else
-	{
-		if (nonNegativeDirY)
-		{
-			if (nonNegativeDirZ)
-			{
-				Physics::rayCastInternal<false, true, true>(rayStart, rayDirection, cameraForward, ceilingScale,
-					voxelChunkManager, entityChunkManager, collisionChunkManager, includeEntities, entityDefLibrary,
-					chunkEntityMaps, hit);
+				if (nonNegativeDirZ)
+				{
+					Physics::rayCastInternal<true, true, true>(rayStart, rayDirection, cameraForward, ceilingScale,
+						voxelChunkManager, entityChunkManager, collisionChunkManager, includeEntities, entityIndex, hit);
+				}
+				else
+				{
+					Physics::rayCastInternal<true, true, false>(rayStart, rayDirection, cameraForward, ceilingScale,
+						voxelChunkManager, entityChunkManager, collisionChunkManager, includeEntities, entityIndex, hit);
+				}
 			}
 			else
 			{
-				Physics::rayCastInternal<false, true, false>(rayStart, rayDirection, cameraForward, ceilingScale,
-					voxelChunkManager, entityChunkManager, collisionChunkManager, includeEntities, entityDefLibrary,
-					chunkEntityMaps, hit);
+				if (nonNegativeDirZ)
+				{
+					Physics::rayCastInternal<true, false, true>(rayStart, rayDirection, cameraForward, ceilingScale,
+						voxelChunkManager, entityChunkManager, collisionChunkManager, includeEntities, entityIndex, hit);
+				}
+				else
+				{
+					Physics::rayCastInternal<true, false, false>(rayStart, rayDirection, cameraForward, ceilingScale,
+						voxelChunkManager, entityChunkManager, collisionChunkManager, includeEntities, entityIndex, hit);
+				}
 			}
 		}
 		else
 		{
-			if (nonNegativeDirZ)
+			if (nonNegativeDirY)
 			{
-				Physics::rayCastInternal<false, false, true>(rayStart, rayDirection, cameraForward, ceilingScale,
-					voxelChunkManager, entityChunkManager, collisionChunkManager, includeEntities, entityDefLibrary,
-					chunkEntityMaps, hit);
+				if (nonNegativeDirZ)
+				{
+					Physics::rayCastInternal<false, true, true>(rayStart, rayDirection, cameraForward, ceilingScale,
+						voxelChunkManager, entityChunkManager, collisionChunkManager, includeEntities, entityIndex, hit);
+				}
+				else
+				{
+					Physics::rayCastInternal<false, true, false>(rayStart, rayDirection, cameraForward, ceilingScale,
+						voxelChunkManager, entityChunkManager, collisionChunkManager, includeEntities, entityIndex, hit);
+				}
 			}
 			else
 			{
-				Physics::rayCastInternal<false, false, false>(rayStart, rayDirection, cameraForward, ceilingScale,
-					voxelChunkManager, entityChunkManager, collisionChunkManager, includeEntities, entityDefLibrary,
-					chunkEntityMaps, hit);
+				if (nonNegativeDirZ)
+				{
+					Physics::rayCastInternal<false, false, true>(rayStart, rayDirection, cameraForward, ceilingScale,
+						voxelChunkManager, entityChunkManager, collisionChunkManager, includeEntities, entityIndex, hit);
+				}
+				else
+				{
+					Physics::rayCastInternal<false, false, false>(rayStart, rayDirection, cameraForward, ceilingScale,
+						voxelChunkManager, entityChunkManager, collisionChunkManager, includeEntities, entityIndex, hit);
+				}
 			}
 		}
 	}
+}
+
+bool Physics::rayCast(const CoordDouble3 &rayStart, const VoxelDouble3 &rayDirection, double ceilingScale,
+	const VoxelDouble3 &cameraForward, bool includeEntities, const VoxelChunkManager &voxelChunkManager,
+	const EntityChunkManager &entityChunkManager, const CollisionChunkManager &collisionChunkManager,
+	RayCastEntityIndex &entityIndex, RayCastHit &hit)
+{
+	Physics::rayCastDispatch(rayStart, rayDirection, ceilingScale, cameraForward, includeEntities, voxelChunkManager,
+		entityChunkManager, collisionChunkManager, entityIndex, hit);
 
 	// Return whether the ray hit something.
 	return hit.t < RayCastHit::NO_HIT_DISTANCE;
 }
 
+bool Physics::rayCast(const CoordDouble3 &rayStart, const VoxelDouble3 &rayDirection, double ceilingScale,
+	const VoxelDouble3 &cameraForward, bool includeEntities, const VoxelChunkManager &voxelChunkManager,
+	const EntityChunkManager &entityChunkManager, const CollisionChunkManager &collisionChunkManager,
+	const EntityDefinitionLibrary &entityDefLibrary, RayCastHit &hit)
+{
+	// Voxel->entity mappings for each chunk touched by this ray only.
+	RayCastEntityIndex entityIndex;
+	return Physics::rayCast(rayStart, rayDirection, ceilingScale, cameraForward, includeEntities, voxelChunkManager,
+		entityChunkManager, collisionChunkManager, entityIndex, hit);
+}
+
 bool Physics::rayCast(const CoordDouble3 &rayStart, const VoxelDouble3 &rayDirection,
 	const VoxelDouble3 &cameraForward, bool includeEntities, const VoxelChunkManager &voxelChunkManager,
 	const EntityChunkManager &entityChunkManager, const CollisionChunkManager &collisionChunkManager,
@@ -795,6 +631,29 @@ bool Physics::rayCast(const CoordDouble3 &rayStart, const VoxelDouble3 &rayDirec
 		entityChunkManager, collisionChunkManager, entityDefLibrary, hit);
 }
 
+int Physics::rayCastBatch(Span<const RayCastQuery> queries, double ceilingScale, const VoxelChunkManager &voxelChunkManager,
+	const EntityChunkManager &entityChunkManager, const CollisionChunkManager &collisionChunkManager,
+	RayCastEntityIndex &entityIndex, Span<RayCastHit> outHits)
+{
+	DebugAssert(outHits.getCount() >= queries.getCount());
+
+	int hitCount = 0;
+	for (int i = 0; i < queries.getCount(); i++)
+	{
+		const RayCastQuery &query = queries[i];
+		RayCastHit &hit = outHits[i];
+		Physics::rayCastDispatch(query.start, query.direction, ceilingScale, query.cameraForward, query.includeEntities,
+			voxelChunkManager, entityChunkManager, collisionChunkManager, entityIndex, hit);
+
+		if (hit.t < RayCastHit::NO_HIT_DISTANCE)
+		{
+			hitCount++;
+		}
+	}
+
+	return hitCount;
+}
+
 JPH::CompoundShape *Physics::getCompoundShapeFromBody(const JPH::Body &body, JPH::PhysicsSystem &physicsSystem)
 {
 	JPH::Shape *baseShape = const_cast<JPH::Shape*>(body.GetShape());
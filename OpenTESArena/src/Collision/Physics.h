@@ -11,22 +11,25 @@
 #include "../Math/Vector3.h"
 #include "../Voxels/VoxelUtils.h"
 
+#include "components/utilities/Span.h"
+
 class CollisionChunkManager;
 class EntityChunkManager;
+class RayCastEntityIndex;
 class VoxelChunkManager;
 
 struct RayCastHit;
+struct RayCastQuery;
 
 namespace Physics
 {
 	// Jolt init values.
 	constexpr int TempAllocatorByteCount = 20 * 1024 * 1024; // 20MB
-	constexpr int ThreadCount = 1;
 	constexpr int MaxBodies = 250000;
 	constexpr int BodyMutexCount = 0; // Use default settings.
 	constexpr int MaxBodyPairs = 65536;
 	constexpr int MaxContactConstraints = 16384;
-	constexpr double DeltaTime = 1.0 / 240.0; // Very high # of updates per frame to help prevent bumpy road feeling at lower FPS.
+	constexpr int MaxStepsPerFrame = 4; // Physics runs in slow motion instead of compounding a slow frame with more steps.
 
 	// Shape creation tweaks.
 	constexpr double BoxConvexRadius = 0.020;
@@ -49,6 +52,19 @@ namespace Physics
 		const CollisionChunkManager &collisionChunkManager, const EntityDefinitionLibrary &entityDefLibrary,
 		RayCastHit &hit);
 
+	// Same as above but entity lookups go through the given index, so rays cast before it's cleared don't
+	// have to find which voxels entities touch again.
+	bool rayCast(const CoordDouble3 &rayStart, const VoxelDouble3 &rayDirection, double ceilingScale,
+		const VoxelDouble3 &cameraForward, bool includeEntities, const VoxelChunkManager &voxelChunkManager,
+		const EntityChunkManager &entityChunkManager, const CollisionChunkManager &collisionChunkManager,
+		RayCastEntityIndex &entityIndex, RayCastHit &hit);
+
+	// Casts each query's ray and writes its hit to the same index in the output. A hit distance of
+	// RayCastHit::NO_HIT_DISTANCE means that ray didn't hit anything. Returns the number of rays that hit.
+	int rayCastBatch(Span<const RayCastQuery> queries, double ceilingScale, const VoxelChunkManager &voxelChunkManager,
+		const EntityChunkManager &entityChunkManager, const CollisionChunkManager &collisionChunkManager,
+		RayCastEntityIndex &entityIndex, Span<RayCastHit> outHits);
+
 	JPH::CompoundShape *getCompoundShapeFromBody(const JPH::Body &body, JPH::PhysicsSystem &physicsSystem);
 	JPH::CompoundShape *getCompoundShapeFromBodyID(JPH::BodyID bodyID, JPH::PhysicsSystem &physicsSystem);
 	JPH::StaticCompoundShape *getStaticCompoundShapeFromBody(const JPH::Body &body, JPH::PhysicsSystem &physicsSystem);
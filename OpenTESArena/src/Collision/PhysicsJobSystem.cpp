@@ -0,0 +1,82 @@
+#include <thread>
+
+#include "PhysicsJobSystem.h"
+
+#include "components/debug/Debug.h"
+#include "components/utilities/JobSystem.h"
+
+PhysicsJobSystem::PhysicsJobSystem()
+{
+	this->jobSystem = nullptr;
+}
+
+void PhysicsJobSystem::init(int maxJobs, int maxBarriers, ::JobSystem &jobSystem)
+{
+	DebugAssert(maxJobs > 0);
+	DebugAssert(maxBarriers > 0);
+	this->jobs.Init(maxJobs, maxJobs);
+	JPH::JobSystemWithBarrier::Init(maxBarriers);
+	this->jobSystem = &jobSystem;
+}
+
+int PhysicsJobSystem::GetMaxConcurrency() const
+{
+	return this->jobSystem->getThreadCount() + 1;
+}
+
+PhysicsJobSystem::JobHandle PhysicsJobSystem::CreateJob(const char *name, JPH::ColorArg color, const JobFunction &jobFunction,
+	JPH::uint32 dependencyCount)
+{
+	JPH::uint32 jobIndex = JPH::FixedSizeFreeList<Job>::cInvalidObjectIndex;
+	while (true)
+	{
+		jobIndex = this->jobs.ConstructObject(name, color, this, jobFunction, dependencyCount);
+		if (jobIndex != JPH::FixedSizeFreeList<Job>::cInvalidObjectIndex)
+		{
+			break;
+		}
+
+		// Wait for running jobs to finish and free their slots.
+		std::this_thread::yield();
+	}
+
+	Job *job = &this->jobs.Get(jobIndex);
+	JobHandle jobHandle(job);
+	if (dependencyCount == 0)
+	{
+		this->QueueJob(job);
+	}
+
+	return jobHandle;
+}
+
+void PhysicsJobSystem::QueueJob(Job *job)
+{
+	if (this->jobSystem->getThreadCount() == 0)
+	{
+		// Nothing else can run it.
+		job->Execute();
+		return;
+	}
+
+	// Whichever of a job system thread or a barrier wait gets to the job first executes it, the other does nothing.
+	job->AddRef();
+	this->jobSystem->queueDetachedJob([job]()
+	{
+		job->Execute();
+		job->Release();
+	});
+}
+
+void PhysicsJobSystem::QueueJobs(Job **jobs, JPH::uint jobCount)
+{
+	for (JPH::uint i = 0; i < jobCount; i++)
+	{
+		this->QueueJob(jobs[i]);
+	}
+}
+
+void PhysicsJobSystem::FreeJob(Job *job)
+{
+	this->jobs.DestructObject(job);
+}
@@ -0,0 +1,30 @@
+#ifndef PHYSICS_JOB_SYSTEM_H
+#define PHYSICS_JOB_SYSTEM_H
+
+#include "Jolt/Jolt.h"
+#include "Jolt/Core/FixedSizeFreeList.h"
+#include "Jolt/Core/JobSystemWithBarrier.h"
+
+class JobSystem;
+
+// Runs Jolt's physics jobs on the engine's job system threads so physics doesn't need its own thread pool.
+// The thread stepping physics also runs jobs while it waits on a barrier.
+class PhysicsJobSystem final : public JPH::JobSystemWithBarrier
+{
+private:
+	JPH::FixedSizeFreeList<Job> jobs;
+	::JobSystem *jobSystem; // Engine job system, not the Jolt base class.
+protected:
+	void QueueJob(Job *job) override;
+	void QueueJobs(Job **jobs, JPH::uint jobCount) override;
+	void FreeJob(Job *job) override;
+public:
+	PhysicsJobSystem();
+
+	void init(int maxJobs, int maxBarriers, ::JobSystem &jobSystem);
+
+	int GetMaxConcurrency() const override;
+	JobHandle CreateJob(const char *name, JPH::ColorArg color, const JobFunction &jobFunction, JPH::uint32 dependencyCount = 0) override;
+};
+
+#endif
@@ -0,0 +1,152 @@
+#include <algorithm>
+
+#include "RayCastEntityIndex.h"
+#include "../Entities/EntityChunkManager.h"
+#include "../World/ChunkUtils.h"
+
+#include "components/debug/Debug.h"
+
+namespace
+{
+	bool IsVoxelLess(const VoxelInt3 &a, const VoxelInt3 &b)
+	{
+		if (a.x != b.x)
+		{
+			return a.x < b.x;
+		}
+
+		if (a.y != b.y)
+		{
+			return a.y < b.y;
+		}
+
+		return a.z < b.z;
+	}
+}
+
+RayCastEntityIndex::RayCastEntityIndex()
+{
+	this->chunkCount = 0;
+	this->ceilingScale = 0.0;
+}
+
+const RayCastEntityIndex::ChunkEntries &RayCastEntityIndex::getOrAddChunk(const ChunkInt2 &chunk, double ceilingScale,
+	const EntityChunkManager &entityChunkManager)
+{
+	if (this->chunkCount == 0)
+	{
+		this->ceilingScale = ceilingScale;
+	}
+
+	DebugAssert(this->ceilingScale == ceilingScale);
+
+	for (int i = 0; i < this->chunkCount; i++)
+	{
+		const ChunkEntries &chunkEntries = this->chunks[i];
+		if (chunkEntries.chunk == chunk)
+		{
+			return chunkEntries;
+		}
+	}
+
+	if (this->chunkCount == static_cast<int>(this->chunks.size()))
+	{
+		this->chunks.emplace_back();
+	}
+
+	ChunkEntries &chunkEntries = this->chunks[this->chunkCount];
+	chunkEntries.chunk = chunk;
+	chunkEntries.voxels.clear();
+	chunkEntries.entityInstIDs.clear();
+	this->chunkCount++;
+
+	// Include entities within one chunk of the center chunk to get entities that are partially touching it.
+	constexpr int chunkDistance = 1;
+	ChunkInt2 minChunk, maxChunk;
+	ChunkUtils::getSurroundingChunks(chunk, chunkDistance, &minChunk, &maxChunk);
+
+	this->scratchEntries.clear();
+	for (WEInt chunkZ = minChunk.y; chunkZ <= maxChunk.y; chunkZ++)
+	{
+		for (SNInt chunkX = minChunk.x; chunkX <= maxChunk.x; chunkX++)
+		{
+			const EntityChunk *entityChunkPtr = entityChunkManager.findChunkAtPosition(ChunkInt2(chunkX, chunkZ));
+			if (entityChunkPtr == nullptr)
+			{
+				continue;
+			}
+
+			for (const EntityInstanceID entityInstID : entityChunkPtr->entityIDs)
+			{
+				// Iterate over the voxels the entity's bounding box touches.
+				const EntityInstance &entityInst = entityChunkManager.getEntity(entityInstID);
+				const WorldDouble3 entityPosition = entityChunkManager.getEntityPosition(entityInst.positionID);
+				const BoundingBox3D &entityBBox = entityChunkManager.getEntityBoundingBox(entityInst.bboxID);
+				const WorldDouble3 entityMinWorldPoint = entityPosition - Double3(entityBBox.halfWidth, 0.0, entityBBox.halfDepth);
+				const WorldDouble3 entityMaxWorldPoint = entityPosition + Double3(entityBBox.halfWidth, entityBBox.height, entityBBox.halfDepth);
+				const WorldInt3 entityMinWorldVoxel = VoxelUtils::pointToVoxel(entityMinWorldPoint, ceilingScale);
+				const WorldInt3 entityMaxWorldVoxel = VoxelUtils::pointToVoxel(entityMaxWorldPoint, ceilingScale);
+
+				for (WEInt z = entityMinWorldVoxel.z; z <= entityMaxWorldVoxel.z; z++)
+				{
+					for (int y = entityMinWorldVoxel.y; y <= entityMaxWorldVoxel.y; y++)
+					{
+						for (SNInt x = entityMinWorldVoxel.x; x <= entityMaxWorldVoxel.x; x++)
+						{
+							const CoordInt3 curCoord = VoxelUtils::worldVoxelToCoord(WorldInt3(x, y, z));
+							if (curCoord.chunk == chunk)
+							{
+								Entry entry;
+								entry.voxel = curCoord.voxel;
+								entry.entityInstID = entityInstID;
+								this->scratchEntries.emplace_back(entry);
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+
+	std::sort(this->scratchEntries.begin(), this->scratchEntries.end(),
+		[](const Entry &a, const Entry &b)
+	{
+		return IsVoxelLess(a.voxel, b.voxel);
+	});
+
+	chunkEntries.voxels.reserve(this->scratchEntries.size());
+	chunkEntries.entityInstIDs.reserve(this->scratchEntries.size());
+	for (const Entry &entry : this->scratchEntries)
+	{
+		chunkEntries.voxels.emplace_back(entry.voxel);
+		chunkEntries.entityInstIDs.emplace_back(entry.entityInstID);
+	}
+
+	return chunkEntries;
+}
+
+Span<const EntityInstanceID> RayCastEntityIndex::getEntitiesInVoxel(const CoordInt3 &coord, double ceilingScale,
+	const EntityChunkManager &entityChunkManager)
+{
+	const ChunkEntries &chunkEntries = this->getOrAddChunk(coord.chunk, ceilingScale, entityChunkManager);
+	const std::vector<VoxelInt3> &voxels = chunkEntries.voxels;
+	const auto range = std::equal_range(voxels.begin(), voxels.end(), coord.voxel, IsVoxelLess);
+	const int startIndex = static_cast<int>(std::distance(voxels.begin(), range.first));
+	const int count = static_cast<int>(std::distance(range.first, range.second));
+	if (count == 0)
+	{
+		return Span<const EntityInstanceID>();
+	}
+
+	return Span<const EntityInstanceID>(chunkEntries.entityInstIDs.data() + startIndex, count);
+}
+
+int RayCastEntityIndex::getChunkCount() const
+{
+	return this->chunkCount;
+}
+
+void RayCastEntityIndex::clear()
+{
+	this->chunkCount = 0;
+}
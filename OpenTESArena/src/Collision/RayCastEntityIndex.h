@@ -0,0 +1,51 @@
+#ifndef RAY_CAST_ENTITY_INDEX_H
+#define RAY_CAST_ENTITY_INDEX_H
+
+#include <vector>
+
+#include "../Entities/EntityInstance.h"
+#include "../World/Coord.h"
+
+#include "components/utilities/Span.h"
+
+class EntityChunkManager;
+
+// Voxels touched by each entity's bounding box, for ray casts. Chunks are indexed the first time a ray enters
+// them and then shared by every ray until the index is cleared, which must happen whenever entities move or
+// are freed. Clearing keeps allocations for the next frame.
+class RayCastEntityIndex
+{
+private:
+	struct Entry
+	{
+		VoxelInt3 voxel;
+		EntityInstanceID entityInstID;
+	};
+
+	struct ChunkEntries
+	{
+		ChunkInt2 chunk;
+
+		// Parallel lists sorted by voxel so an entity list is a contiguous range.
+		std::vector<VoxelInt3> voxels;
+		std::vector<EntityInstanceID> entityInstIDs;
+	};
+
+	std::vector<ChunkEntries> chunks; // Entries past chunkCount are kept for reuse.
+	int chunkCount;
+	double ceilingScale;
+	std::vector<Entry> scratchEntries;
+
+	const ChunkEntries &getOrAddChunk(const ChunkInt2 &chunk, double ceilingScale, const EntityChunkManager &entityChunkManager);
+public:
+	RayCastEntityIndex();
+
+	// Entities whose bounding box touches the voxel, indexing the voxel's chunk if needed.
+	Span<const EntityInstanceID> getEntitiesInVoxel(const CoordInt3 &coord, double ceilingScale, const EntityChunkManager &entityChunkManager);
+
+	int getChunkCount() const;
+
+	void clear();
+};
+
+#endif
@@ -34,3 +34,16 @@ void RayCastHit::initEntity(double t, const WorldDouble3 &worldPoint, EntityInst
 	this->type = RayCastHitType::Entity;
 	this->entityHit.id = id;
 }
+
+RayCastQuery::RayCastQuery()
+{
+	this->includeEntities = false;
+}
+
+void RayCastQuery::init(const CoordDouble3 &start, const VoxelDouble3 &direction, const VoxelDouble3 &cameraForward, bool includeEntities)
+{
+	this->start = start;
+	this->direction = direction;
+	this->cameraForward = cameraForward;
+	this->includeEntities = includeEntities;
+}
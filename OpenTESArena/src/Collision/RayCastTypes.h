@@ -46,4 +46,17 @@ struct RayCastHit
 	void initEntity(double t, const WorldDouble3 &worldPoint, EntityInstanceID id);
 };
 
+// One ray in a batched ray cast.
+struct RayCastQuery
+{
+	CoordDouble3 start;
+	VoxelDouble3 direction;
+	VoxelDouble3 cameraForward; // Entity flats face opposite to this.
+	bool includeEntities;
+
+	RayCastQuery();
+
+	void init(const CoordDouble3 &start, const VoxelDouble3 &direction, const VoxelDouble3 &cameraForward, bool includeEntities);
+};
+
 #endif
@@ -68,6 +68,19 @@ void VfxEntityAnimationKey::initMeleeStrike(int bloodIndex)
 	this->index = bloodIndex;
 }
 
+EntityAnimationLibrary::Entry::Entry(LoadFunc &&loadFunc)
+	: loadFunc(std::move(loadFunc))
+{
+	this->isLoaded = false;
+}
+
+EntityAnimationDefinitionID EntityAnimationLibrary::addEntry(LoadFunc &&loadFunc)
+{
+	const EntityAnimationDefinitionID animDefID = static_cast<EntityAnimationDefinitionID>(this->entries.size());
+	this->entries.emplace_back(std::move(loadFunc));
+	return animDefID;
+}
+
 void EntityAnimationLibrary::init(const BinaryAssetLibrary &binaryAssetLibrary, const CharacterClassLibrary &charClassLibrary, TextureManager &textureManager)
 {
 	const ExeData &exeData = binaryAssetLibrary.getExeData();
@@ -77,16 +90,18 @@ void EntityAnimationLibrary::init(const BinaryAssetLibrary &binaryAssetLibrary,
 	for (int i = 0; i < creatureAnimCount; i++)
 	{
 		const int creatureID = i + 1;
-		EntityAnimationDefinition animDef;
-		if (!ArenaAnimUtils::tryMakeDynamicEntityCreatureAnims(creatureID, exeData, textureManager, &animDef))
+		const EntityAnimationDefinitionID animDefID = this->addEntry(
+			[creatureID, &exeData, &textureManager](EntityAnimationDefinition *outDef)
 		{
-			DebugLogError("Couldn't create animation definition for creature " + std::to_string(creatureID) + ".");
-			continue;
-		}
+			if (!ArenaAnimUtils::tryMakeDynamicEntityCreatureAnims(creatureID, exeData, textureManager, outDef))
+			{
+				DebugLogError("Couldn't create animation definition for creature " + std::to_string(creatureID) + ".");
+				return false;
+			}
+
+			return true;
+		});
 
-		const EntityAnimationDefinitionID animDefID = static_cast<EntityAnimationDefinitionID>(this->defs.size());
-		this->defs.emplace_back(std::move(animDef));
-		
 		CreatureEntityAnimationKey animKey;
 		animKey.init(creatureID);
 		this->creatureDefIDs.emplace_back(std::move(animKey), animDefID);
@@ -97,29 +112,25 @@ void EntityAnimationLibrary::init(const BinaryAssetLibrary &binaryAssetLibrary,
 	for (int i = 0; i < charClassCount; i++)
 	{
 		const int charClassDefID = i;
-		EntityAnimationDefinition maleAnimDef, femaleAnimDef;
-		if (!ArenaAnimUtils::tryMakeDynamicEntityHumanAnims(charClassDefID, true, charClassLibrary, binaryAssetLibrary, textureManager, &maleAnimDef))
-		{
-			DebugLogError("Couldn't create animation definition for male human enemy " + std::to_string(charClassDefID) + ".");
-			continue;
-		}
-
-		if (!ArenaAnimUtils::tryMakeDynamicEntityHumanAnims(charClassDefID, false, charClassLibrary, binaryAssetLibrary, textureManager, &femaleAnimDef))
+		for (const bool male : { true, false })
 		{
-			DebugLogError("Couldn't create animation definition for female human enemy " + std::to_string(charClassDefID) + ".");
-			continue;
+			const EntityAnimationDefinitionID animDefID = this->addEntry(
+				[charClassDefID, male, &charClassLibrary, &binaryAssetLibrary, &textureManager](EntityAnimationDefinition *outDef)
+			{
+				if (!ArenaAnimUtils::tryMakeDynamicEntityHumanAnims(charClassDefID, male, charClassLibrary, binaryAssetLibrary, textureManager, outDef))
+				{
+					DebugLogError("Couldn't create animation definition for " + std::string(male ? "male" : "female") +
+						" human enemy " + std::to_string(charClassDefID) + ".");
+					return false;
+				}
+
+				return true;
+			});
+
+			HumanEnemyEntityAnimationKey animKey;
+			animKey.init(male, charClassDefID);
+			this->humanEnemyDefIDs.emplace_back(std::move(animKey), animDefID);
 		}
-
-		const EntityAnimationDefinitionID maleAnimDefID = static_cast<EntityAnimationDefinitionID>(this->defs.size());
-		const EntityAnimationDefinitionID femaleAnimDefID = maleAnimDefID + 1;
-		this->defs.emplace_back(std::move(maleAnimDef));
-		this->defs.emplace_back(std::move(femaleAnimDef));
-
-		HumanEnemyEntityAnimationKey maleAnimKey, femaleAnimKey;
-		maleAnimKey.init(true, charClassDefID);
-		femaleAnimKey.init(false, charClassDefID);
-		this->humanEnemyDefIDs.emplace_back(std::move(maleAnimKey), maleAnimDefID);
-		this->humanEnemyDefIDs.emplace_back(std::move(femaleAnimKey), femaleAnimDefID);
 	}
 
 	// Citizens
@@ -127,29 +138,25 @@ void EntityAnimationLibrary::init(const BinaryAssetLibrary &binaryAssetLibrary,
 	for (int i = 0; i < climateCount; i++)
 	{
 		const ArenaClimateType climateType = ArenaClimateUtils::getClimateType(i);
-		EntityAnimationDefinition maleAnimDef, femaleAnimDef;
-		if (!ArenaAnimUtils::tryMakeCitizenAnims(climateType, true, exeData, textureManager, &maleAnimDef))
+		for (const bool male : { true, false })
 		{
-			DebugLogError("Couldn't create animation definition for male citizen " + std::to_string(static_cast<int>(climateType)) + ".");
-			continue;
+			const EntityAnimationDefinitionID animDefID = this->addEntry(
+				[climateType, male, &exeData, &textureManager](EntityAnimationDefinition *outDef)
+			{
+				if (!ArenaAnimUtils::tryMakeCitizenAnims(climateType, male, exeData, textureManager, outDef))
+				{
+					DebugLogError("Couldn't create animation definition for " + std::string(male ? "male" : "female") +
+						" citizen " + std::to_string(static_cast<int>(climateType)) + ".");
+					return false;
+				}
+
+				return true;
+			});
+
+			CitizenEntityAnimationKey animKey;
+			animKey.init(male, climateType);
+			this->citizenDefIDs.emplace_back(std::move(animKey), animDefID);
 		}
-
-		if (!ArenaAnimUtils::tryMakeCitizenAnims(climateType, false, exeData, textureManager, &femaleAnimDef))
-		{
-			DebugLogError("Couldn't create animation definition for female citizen " + std::to_string(static_cast<int>(climateType)) + ".");
-			continue;
-		}
-
-		const EntityAnimationDefinitionID maleAnimDefID = static_cast<EntityAnimationDefinitionID>(this->defs.size());
-		const EntityAnimationDefinitionID femaleAnimDefID = maleAnimDefID + 1;
-		this->defs.emplace_back(std::move(maleAnimDef));
-		this->defs.emplace_back(std::move(femaleAnimDef));
-
-		CitizenEntityAnimationKey maleAnimKey, femaleAnimKey;
-		maleAnimKey.init(true, climateType);
-		femaleAnimKey.init(false, climateType);
-		this->citizenDefIDs.emplace_back(std::move(maleAnimKey), maleAnimDefID);
-		this->citizenDefIDs.emplace_back(std::move(femaleAnimKey), femaleAnimDefID);
 	}
 
 	// VFX
@@ -161,18 +168,25 @@ void EntityAnimationLibrary::init(const BinaryAssetLibrary &binaryAssetLibrary,
 	const Span<const std::string> spellProjectileAnimFilenames(exeData.entities.effectAnimations + spellProjectileStartIndex, spellTypeCount);
 	const Span<const std::string> spellExplosionAnimFilenames(exeData.entities.effectAnimations + spellExplosionStartIndex, spellTypeCount);
 	const Span<const std::string> meleeVfxAnimFilenames(exeData.entities.effectAnimations + meleeVfxStartIndex, meleeVfxCount); // Blood, demon, undead
-	for (int i = 0; i < spellProjectileAnimFilenames.getCount(); i++)
+
+	auto addVfxEntry = [this, &textureManager](const std::string &animFilename, bool isLooping, const char *vfxName)
 	{
-		const std::string animFilename = String::toUppercase(spellProjectileAnimFilenames[i]);
-		EntityAnimationDefinition animDef;
-		if (!ArenaAnimUtils::tryMakeVfxAnim(animFilename, true, textureManager, &animDef))
+		return this->addEntry([animFilename, isLooping, vfxName, &textureManager](EntityAnimationDefinition *outDef)
 		{
-			DebugLogError("Couldn't create VFX animation definition for spell projectile \"" + animFilename + "\".");
-			continue;
-		}
+			if (!ArenaAnimUtils::tryMakeVfxAnim(animFilename, isLooping, textureManager, outDef))
+			{
+				DebugLogError("Couldn't create VFX animation definition for " + std::string(vfxName) + " \"" + animFilename + "\".");
+				return false;
+			}
 
-		const EntityAnimationDefinitionID animDefID = static_cast<EntityAnimationDefinitionID>(this->defs.size());
-		this->defs.emplace_back(std::move(animDef));
+			return true;
+		});
+	};
+
+	for (int i = 0; i < spellProjectileAnimFilenames.getCount(); i++)
+	{
+		const std::string animFilename = String::toUppercase(spellProjectileAnimFilenames[i]);
+		const EntityAnimationDefinitionID animDefID = addVfxEntry(animFilename, true, "spell projectile");
 
 		VfxEntityAnimationKey animKey;
 		animKey.initSpellProjectile(i);
@@ -182,15 +196,7 @@ void EntityAnimationLibrary::init(const BinaryAssetLibrary &binaryAssetLibrary,
 	for (int i = 0; i < spellExplosionAnimFilenames.getCount(); i++)
 	{
 		const std::string animFilename = String::toUppercase(spellExplosionAnimFilenames[i]);
-		EntityAnimationDefinition animDef;
-		if (!ArenaAnimUtils::tryMakeVfxAnim(animFilename, false, textureManager, &animDef))
-		{
-			DebugLogError("Couldn't create VFX animation definition for spell explosion \"" + animFilename + "\".");
-			continue;
-		}
-
-		const EntityAnimationDefinitionID animDefID = static_cast<EntityAnimationDefinitionID>(this->defs.size());
-		this->defs.emplace_back(std::move(animDef));
+		const EntityAnimationDefinitionID animDefID = addVfxEntry(animFilename, false, "spell explosion");
 
 		VfxEntityAnimationKey animKey;
 		animKey.initSpellExplosion(i);
@@ -200,15 +206,7 @@ void EntityAnimationLibrary::init(const BinaryAssetLibrary &binaryAssetLibrary,
 	for (int i = 0; i < meleeVfxAnimFilenames.getCount(); i++)
 	{
 		const std::string animFilename = String::toUppercase(meleeVfxAnimFilenames[i]);
-		EntityAnimationDefinition animDef;
-		if (!ArenaAnimUtils::tryMakeVfxAnim(animFilename, false, textureManager, &animDef))
-		{
-			DebugLogError("Couldn't create VFX animation definition for melee strike \"" + animFilename + "\".");
-			continue;
-		}
-
-		const EntityAnimationDefinitionID animDefID = static_cast<EntityAnimationDefinitionID>(this->defs.size());
-		this->defs.emplace_back(std::move(animDef));
+		const EntityAnimationDefinitionID animDefID = addVfxEntry(animFilename, false, "melee strike");
 
 		VfxEntityAnimationKey animKey;
 		animKey.initMeleeStrike(i);
@@ -218,7 +216,7 @@ void EntityAnimationLibrary::init(const BinaryAssetLibrary &binaryAssetLibrary,
 
 int EntityAnimationLibrary::getDefinitionCount() const
 {
-	return static_cast<int>(this->defs.size());
+	return static_cast<int>(this->entries.size());
 }
 
 EntityAnimationDefinitionID EntityAnimationLibrary::getCreatureAnimDefID(const CreatureEntityAnimationKey &key) const
@@ -273,8 +271,17 @@ EntityAnimationDefinitionID EntityAnimationLibrary::getVfxAnimDefID(const VfxEnt
 	return iter->second;
 }
 
-const EntityAnimationDefinition &EntityAnimationLibrary::getDefinition(EntityAnimationDefinitionID id) const
+const EntityAnimationDefinition &EntityAnimationLibrary::getDefinition(EntityAnimationDefinitionID id)
 {
-	DebugAssertIndex(this->defs, id);
-	return this->defs[id];
+	DebugAssertIndex(this->entries, id);
+	Entry &entry = this->entries[id];
+	if (!entry.isLoaded)
+	{
+		// A failed definition stays empty, the error is logged once.
+		entry.loadFunc(&entry.def);
+		entry.loadFunc = LoadFunc();
+		entry.isLoaded = true;
+	}
+
+	return entry.def;
 }
@@ -1,6 +1,7 @@
 #ifndef ENTITY_ANIMATION_LIBRARY_H
 #define ENTITY_ANIMATION_LIBRARY_H
 
+#include <functional>
 #include <unordered_map>
 #include <vector>
 
@@ -59,14 +60,30 @@ struct VfxEntityAnimationKey
 
 using EntityAnimationDefinitionID = int;
 
+// Definitions are registered by key at startup and only built the first time they're requested, since a session
+// only sees a few of the creatures and classes. Building one uses the texture manager so it must happen on the
+// main thread.
 class EntityAnimationLibrary : public Singleton<EntityAnimationLibrary>
 {
 private:
-	std::vector<EntityAnimationDefinition> defs;
+	using LoadFunc = std::function<bool(EntityAnimationDefinition *outDef)>;
+
+	struct Entry
+	{
+		LoadFunc loadFunc; // Released once loaded.
+		EntityAnimationDefinition def;
+		bool isLoaded;
+
+		Entry(LoadFunc &&loadFunc);
+	};
+
+	std::vector<Entry> entries;
 	std::vector<std::pair<CreatureEntityAnimationKey, EntityAnimationDefinitionID>> creatureDefIDs;
 	std::vector<std::pair<HumanEnemyEntityAnimationKey, EntityAnimationDefinitionID>> humanEnemyDefIDs;
 	std::vector<std::pair<CitizenEntityAnimationKey, EntityAnimationDefinitionID>> citizenDefIDs;
 	std::vector<std::pair<VfxEntityAnimationKey, EntityAnimationDefinitionID>> vfxDefIDs;
+
+	EntityAnimationDefinitionID addEntry(LoadFunc &&loadFunc);
 public:
 	void init(const BinaryAssetLibrary &binaryAssetLibrary, const CharacterClassLibrary &charClassLibrary, TextureManager &textureManager);
 
@@ -75,7 +92,9 @@ public:
 	EntityAnimationDefinitionID getHumanEnemyAnimDefID(const HumanEnemyEntityAnimationKey &key) const;
 	EntityAnimationDefinitionID getCitizenAnimDefID(const CitizenEntityAnimationKey &key) const;
 	EntityAnimationDefinitionID getVfxAnimDefID(const VfxEntityAnimationKey &key) const;
-	const EntityAnimationDefinition &getDefinition(EntityAnimationDefinitionID id) const;
+
+	// Builds the definition if this is the first time it's requested.
+	const EntityAnimationDefinition &getDefinition(EntityAnimationDefinitionID id);
 };
 
 #endif
@@ -172,6 +172,12 @@ EntityTransferResult::EntityTransferResult()
 	this->id = -1;
 }
 
+EntityLevelPlacement::EntityLevelPlacement()
+{
+	this->placementDefIndex = -1;
+	this->positionIndex = -1;
+}
+
 const EntityDefinition &EntityChunkManager::getEntityDef(EntityDefID defID) const
 {
 	const EntityDefinitionLibrary &defLibrary = EntityDefinitionLibrary::getInstance();
@@ -226,6 +232,18 @@ int EntityChunkManager::findAvailableTransformHeapIndex() const
 	return heapIndex;
 }
 
+void EntityChunkManager::queueEntityDelta(EntityInstanceID entityInstID, ChunkEntityDeltaType type)
+{
+	const auto iter = this->levelPlacements.find(entityInstID);
+	if (iter == this->levelPlacements.end())
+	{
+		return;
+	}
+
+	this->pendingDeltaPlacements.emplace_back(iter->second);
+	this->pendingDeltaTypes.emplace_back(type);
+}
+
 void EntityChunkManager::initializeEntity(EntityInstance &entityInst, EntityInstanceID instID, const EntityDefinition &entityDef,
 	const EntityAnimationDefinition &animDef, const EntityInitInfo &initInfo, Random &random, JPH::PhysicsSystem &physicsSystem, Renderer &renderer)
 {
@@ -672,7 +690,7 @@ void EntityChunkManager::initializeEntity(EntityInstance &entityInst, EntityInst
 
 void EntityChunkManager::populateChunkEntities(EntityChunk &entityChunk, const VoxelChunk &voxelChunk,
 	const LevelDefinition &levelDefinition, const LevelInfoDefinition &levelInfoDefinition, const WorldInt2 &levelOffset,
-	const EntityGenInfo &entityGenInfo, const std::optional<CitizenGenInfo> &citizenGenInfo,
+	const ChunkDelta *chunkDelta, const EntityGenInfo &entityGenInfo, const std::optional<CitizenGenInfo> &citizenGenInfo,
 	Random &random, const EntityDefinitionLibrary &entityDefLibrary, JPH::PhysicsSystem &physicsSystem,
 	TextureManager &textureManager, Renderer &renderer)
 {
@@ -709,8 +727,9 @@ void EntityChunkManager::populateChunkEntities(EntityChunk &entityChunk, const V
 		DebugAssert(initialAnimStateIndex.has_value());
 
 		std::optional<EntityDefID> entityDefID; // Global entity def ID (shared across all active chunks).
-		for (const WorldDouble2 &worldPosition : placementDef.positions)
+		for (int positionIndex = 0; positionIndex < static_cast<int>(placementDef.positions.size()); positionIndex++)
 		{
+			const WorldDouble2 &worldPosition = placementDef.positions[positionIndex];
 			const WorldInt2 worldVoxelXZ = VoxelUtils::pointToVoxel(worldPosition);
 			const WorldInt3 worldVoxel(worldVoxelXZ.x, 1, worldVoxelXZ.y);
 			if (!ChunkUtils::IsInWritingRange(worldVoxel, startX, endX, startY, endY, startZ, endZ))
@@ -718,6 +737,11 @@ void EntityChunkManager::populateChunkEntities(EntityChunk &entityChunk, const V
 				continue;
 			}
 
+			if ((chunkDelta != nullptr) && chunkDelta->hasEntityDelta(i, positionIndex, ChunkEntityDeltaType::Removed))
+			{
+				continue;
+			}
+
 			if (!entityDefID.has_value())
 			{
 				entityDefID = this->getOrAddEntityDefID(entityDef, entityDefLibrary);
@@ -750,7 +774,8 @@ void EntityChunkManager::populateChunkEntities(EntityChunk &entityChunk, const V
 				const ContainerEntityDefinition &containerDef = entityDef.container;
 				if (containerDef.type == ContainerEntityDefinitionType::Holder)
 				{
-					initInfo.isLocked = containerDef.holder.locked;
+					const bool isUnlocked = (chunkDelta != nullptr) && chunkDelta->hasEntityDelta(i, positionIndex, ChunkEntityDeltaType::Unlocked);
+					initInfo.isLocked = containerDef.holder.locked && !isUnlocked;
 				}
 			}
 
@@ -768,6 +793,12 @@ void EntityChunkManager::populateChunkEntities(EntityChunk &entityChunk, const V
 			EntityInstance &entityInst = this->entities.get(entityInstID);
 			this->initializeEntity(entityInst, entityInstID, entityDef, animDef, initInfo, random, physicsSystem, renderer);
 			entityChunk.entityIDs.emplace_back(entityInstID);
+
+			EntityLevelPlacement levelPlacement;
+			levelPlacement.chunkPos = chunkPos;
+			levelPlacement.placementDefIndex = i;
+			levelPlacement.positionIndex = positionIndex;
+			this->levelPlacements.emplace(entityInstID, levelPlacement);
 		}
 	}
 
@@ -864,7 +895,7 @@ void EntityChunkManager::populateChunkEntities(EntityChunk &entityChunk, const V
 
 void EntityChunkManager::populateChunk(EntityChunk &entityChunk, const VoxelChunk &voxelChunk,
 	const LevelDefinition &levelDef, const LevelInfoDefinition &levelInfoDef, const MapSubDefinition &mapSubDef,
-	const EntityGenInfo &entityGenInfo, const std::optional<CitizenGenInfo> &citizenGenInfo,
+	const ChunkDelta *chunkDelta, const EntityGenInfo &entityGenInfo, const std::optional<CitizenGenInfo> &citizenGenInfo,
 	double ceilingScale, Random &random, const EntityDefinitionLibrary &entityDefLibrary, JPH::PhysicsSystem &physicsSystem,
 	TextureManager &textureManager, Renderer &renderer)
 {
@@ -882,7 +913,7 @@ void EntityChunkManager::populateChunk(EntityChunk &entityChunk, const VoxelChun
 		{
 			// Populate chunk from the part of the level it overlaps.
 			const WorldInt2 levelOffset = chunkPos * ChunkUtils::CHUNK_DIM;
-			this->populateChunkEntities(entityChunk, voxelChunk, levelDef, levelInfoDef, levelOffset, entityGenInfo,
+			this->populateChunkEntities(entityChunk, voxelChunk, levelDef, levelInfoDef, levelOffset, chunkDelta, entityGenInfo,
 				citizenGenInfo, random, entityDefLibrary, physicsSystem, textureManager, renderer);
 		}
 	}
@@ -894,7 +925,7 @@ void EntityChunkManager::populateChunk(EntityChunk &entityChunk, const VoxelChun
 		{
 			// Populate chunk from the part of the level it overlaps.
 			const WorldInt2 levelOffset = chunkPos * ChunkUtils::CHUNK_DIM;
-			this->populateChunkEntities(entityChunk, voxelChunk, levelDef, levelInfoDef, levelOffset, entityGenInfo,
+			this->populateChunkEntities(entityChunk, voxelChunk, levelDef, levelInfoDef, levelOffset, chunkDelta, entityGenInfo,
 				citizenGenInfo, random, entityDefLibrary, physicsSystem, textureManager, renderer);
 		}
 	}
@@ -906,7 +937,7 @@ void EntityChunkManager::populateChunk(EntityChunk &entityChunk, const VoxelChun
 
 		// Copy level definition directly into chunk.
 		const WorldInt2 levelOffset = WorldInt2::Zero;
-		this->populateChunkEntities(entityChunk, voxelChunk, levelDef, levelInfoDef, levelOffset, entityGenInfo,
+		this->populateChunkEntities(entityChunk, voxelChunk, levelDef, levelInfoDef, levelOffset, chunkDelta, entityGenInfo,
 			citizenGenInfo, random, entityDefLibrary, physicsSystem, textureManager, renderer);
 	}
 }
@@ -1497,6 +1528,9 @@ void EntityChunkManager::updateEnemyDeathStates(JPH::PhysicsSystem &physicsSyste
 				combatState.isDying = false;
 				combatState.isDead = true;
 
+				// Corpses don't come back when the chunk is regenerated.
+				this->queueEntityDelta(entityInstID, ChunkEntityDeltaType::Removed);
+
 				if (EntityUtils::leavesCorpse(entityDef))
 				{
 					JPH::BodyID &physicsBodyID = entityInst.physicsBodyID;
@@ -1582,7 +1616,7 @@ void EntityChunkManager::update(double dt, Span<const ChunkInt2> activeChunkPosi
 	const LevelInfoDefinition *activeLevelInfoDef, const MapSubDefinition &mapSubDef, Span<const LevelDefinition> levelDefs,
 	Span<const int> levelInfoDefIndices, Span<const LevelInfoDefinition> levelInfoDefs, const EntityGenInfo &entityGenInfo,
 	const std::optional<CitizenGenInfo> &citizenGenInfo, double ceilingScale, Random &random, const VoxelChunkManager &voxelChunkManager,
-	AudioManager &audioManager, JPH::PhysicsSystem &physicsSystem, TextureManager &textureManager, Renderer &renderer)
+	ChunkDeltaCache &chunkDeltaCache, AudioManager &audioManager, JPH::PhysicsSystem &physicsSystem, TextureManager &textureManager, Renderer &renderer)
 {
 	const EntityDefinitionLibrary &entityDefLibrary = EntityDefinitionLibrary::getInstance();
 
@@ -1592,6 +1626,17 @@ void EntityChunkManager::update(double dt, Span<const ChunkInt2> activeChunkPosi
 		const EntityChunk &entityChunk = this->getChunkAtIndex(chunkIndex);
 		for (const EntityInstanceID entityInstID : entityChunk.entityIDs)
 		{
+			const EntityInstance &entityInst = this->entities.get(entityInstID);
+			if (entityInst.canBeLocked())
+			{
+				const EntityDefinition &entityDef = this->getEntityDef(entityInst.defID);
+				const EntityLockState &lockState = this->lockStates.get(entityInst.lockStateID);
+				if (entityDef.container.holder.locked && !lockState.isLocked)
+				{
+					this->queueEntityDelta(entityInstID, ChunkEntityDeltaType::Unlocked);
+				}
+			}
+
 			this->queueEntityDestroy(entityInstID, false);
 		}
 
@@ -1602,7 +1647,7 @@ void EntityChunkManager::update(double dt, Span<const ChunkInt2> activeChunkPosi
 	for (const ChunkInt2 chunkPos : newChunkPositions)
 	{
 		const VoxelChunk &voxelChunk = voxelChunkManager.getChunkAtPosition(chunkPos);
-		const int spawnIndex = this->spawnChunk();
+		const int spawnIndex = this->spawnChunk(chunkPos);
 		EntityChunk &entityChunk = this->getChunkAtIndex(spawnIndex);
 		entityChunk.init(chunkPos, voxelChunk.height);
 
@@ -1619,13 +1664,14 @@ void EntityChunkManager::update(double dt, Span<const ChunkInt2> activeChunkPosi
 			levelInfoDefPtr = &levelInfoDefs[levelInfoDefIndex];
 		}
 
-		this->populateChunk(entityChunk, voxelChunk, *levelDefPtr, *levelInfoDefPtr, mapSubDef, entityGenInfo, citizenGenInfo,
+		const ChunkDelta *chunkDelta = chunkDeltaCache.findDelta(chunkPos);
+		this->populateChunk(entityChunk, voxelChunk, *levelDefPtr, *levelInfoDefPtr, mapSubDef, chunkDelta, entityGenInfo, citizenGenInfo,
 			ceilingScale, random, entityDefLibrary, physicsSystem, textureManager, renderer);
 	}
 
-	// Free any unneeded chunks for memory savings in case the chunk distance was once large
-	// and is now small. This is significant even for chunk distance 2->1, or 25->9 chunks.
-	this->chunkPool.clear();
+	// Keep recycled chunks warm for the next chunk border crossing, only freeing the excess in case the
+	// chunk distance was once large and is now small. This is significant even for chunk distance 2->1.
+	this->trimChunkPool();
 
 	const WorldDouble3 playerPosition = player.getEyePosition();
 	const WorldDouble2 playerPositionXZ = playerPosition.getXZ();
@@ -1669,6 +1715,9 @@ void EntityChunkManager::queueEntityDestroy(EntityInstanceID entityInstID, const
 
 		if (chunkToNotify != nullptr)
 		{
+			// Destroyed by gameplay rather than chunk unloading.
+			this->queueEntityDelta(entityInstID, ChunkEntityDeltaType::Removed);
+
 			EntityChunk &entityChunk = this->getChunkAtPosition(*chunkToNotify);
 			const auto iter = std::find(entityChunk.entityIDs.begin(), entityChunk.entityIDs.end(), entityInstID);
 			DebugAssert(iter != entityChunk.entityIDs.end());
@@ -1693,6 +1742,26 @@ void EntityChunkManager::queueEntityDestroy(EntityInstanceID entityInstID, bool
 	this->queueEntityDestroy(entityInstID, chunkToNotify);
 }
 
+void EntityChunkManager::writeChunkDeltas(ChunkDeltaCache &chunkDeltaCache)
+{
+	DebugAssert(this->pendingDeltaPlacements.size() == this->pendingDeltaTypes.size());
+	for (int i = 0; i < static_cast<int>(this->pendingDeltaPlacements.size()); i++)
+	{
+		const EntityLevelPlacement &levelPlacement = this->pendingDeltaPlacements[i];
+
+		ChunkEntityDelta entityDelta;
+		entityDelta.placementDefIndex = levelPlacement.placementDefIndex;
+		entityDelta.positionIndex = levelPlacement.positionIndex;
+		entityDelta.type = this->pendingDeltaTypes[i];
+
+		ChunkDelta &chunkDelta = chunkDeltaCache.getOrAddDelta(levelPlacement.chunkPos);
+		chunkDelta.addEntityDelta(entityDelta);
+	}
+
+	this->pendingDeltaPlacements.clear();
+	this->pendingDeltaTypes.clear();
+}
+
 void EntityChunkManager::endFrame(JPH::PhysicsSystem &physicsSystem, Renderer &renderer)
 {
 	JPH::BodyInterface &bodyInterface = physicsSystem.GetBodyInterface();
@@ -1769,6 +1838,7 @@ void EntityChunkManager::endFrame(JPH::PhysicsSystem &physicsSystem, Renderer &r
 			transformHeap.free(entityInst.transformIndex);
 		}
 
+		this->levelPlacements.erase(entityInstID);
 		this->entities.free(entityInstID);
 	}
 
@@ -1794,6 +1864,8 @@ void EntityChunkManager::clear(JPH::PhysicsSystem &physicsSystem, Renderer &rend
 	}
 
 	this->transformHeaps.clear();
+	this->pendingDeltaPlacements.clear();
+	this->pendingDeltaTypes.clear();
 
 	this->recycleAllChunks();
 }
@@ -15,6 +15,7 @@
 #include "../Math/BoundingBox.h"
 #include "../Rendering/RenderMeshUtils.h"
 #include "../Utilities/Palette.h"
+#include "../World/ChunkDeltaCache.h"
 #include "../World/SpecializedChunkManager.h"
 
 #include "components/utilities/Buffer.h"
@@ -93,6 +94,16 @@ struct EntityTransferResult
 	EntityTransferResult();
 };
 
+// Where an entity came from in its level definition, so gameplay changes to it can be saved with its chunk.
+struct EntityLevelPlacement
+{
+	ChunkInt2 chunkPos; // Chunk it was spawned in, not necessarily the one it's in now.
+	int placementDefIndex;
+	int positionIndex;
+
+	EntityLevelPlacement();
+};
+
 class EntityChunkManager final : public SpecializedChunkManager<EntityChunk>
 {
 private:
@@ -142,21 +153,30 @@ private:
 	// Entities that have moved from one chunk to another and are still in play.
 	std::vector<EntityTransferResult> transferResults;
 
+	// Entities spawned from level definition placements, and changes to them waiting to be written to the
+	// chunk delta cache.
+	std::unordered_map<EntityInstanceID, EntityLevelPlacement> levelPlacements;
+	std::vector<EntityLevelPlacement> pendingDeltaPlacements;
+	std::vector<ChunkEntityDeltaType> pendingDeltaTypes; // Parallel to pending placements.
+
 	EntityDefID addEntityDef(EntityDefinition &&def, const EntityDefinitionLibrary &defLibrary);
 	EntityDefID getOrAddEntityDefID(const EntityDefinition &def, const EntityDefinitionLibrary &defLibrary);
 
 	int findAvailableTransformHeapIndex() const;
 
+	// Does nothing if the entity wasn't spawned from a level definition placement.
+	void queueEntityDelta(EntityInstanceID entityInstID, ChunkEntityDeltaType type);
+
 	void initializeEntity(EntityInstance &entityInst, EntityInstanceID instID, const EntityDefinition &entityDef,
 		const EntityAnimationDefinition &animDef, const EntityInitInfo &initInfo, Random &random, JPH::PhysicsSystem &physicsSystem,
 		Renderer &renderer);
 
 	void populateChunkEntities(EntityChunk &entityChunk, const VoxelChunk &chunk, const LevelDefinition &levelDefinition,
-		const LevelInfoDefinition &levelInfoDefinition, const WorldInt2 &levelOffset, const EntityGenInfo &entityGenInfo,
+		const LevelInfoDefinition &levelInfoDefinition, const WorldInt2 &levelOffset, const ChunkDelta *chunkDelta, const EntityGenInfo &entityGenInfo,
 		const std::optional<CitizenGenInfo> &citizenGenInfo, Random &random, const EntityDefinitionLibrary &entityDefLibrary,
 		JPH::PhysicsSystem &physicsSystem, TextureManager &textureManager, Renderer &renderer);
 	void populateChunk(EntityChunk &entityChunk, const VoxelChunk &voxelChunk, const LevelDefinition &levelDef,
-		const LevelInfoDefinition &levelInfoDef, const MapSubDefinition &mapSubDef, const EntityGenInfo &entityGenInfo,
+		const LevelInfoDefinition &levelInfoDef, const MapSubDefinition &mapSubDef, const ChunkDelta *chunkDelta, const EntityGenInfo &entityGenInfo,
 		const std::optional<CitizenGenInfo> &citizenGenInfo, double ceilingScale, Random &random,
 		const EntityDefinitionLibrary &entityDefLibrary, JPH::PhysicsSystem &physicsSystem, TextureManager &textureManager, Renderer &renderer);
 
@@ -214,14 +234,17 @@ public:
 		const MapSubDefinition &mapSubDef, Span<const LevelDefinition> levelDefs,
 		Span<const int> levelInfoDefIndices, Span<const LevelInfoDefinition> levelInfoDefs,
 		const EntityGenInfo &entityGenInfo, const std::optional<CitizenGenInfo> &citizenGenInfo,
-		double ceilingScale, Random &random, const VoxelChunkManager &voxelChunkManager, AudioManager &audioManager,
-		JPH::PhysicsSystem &physicsSystem, TextureManager &textureManager, Renderer &renderer);
+		double ceilingScale, Random &random, const VoxelChunkManager &voxelChunkManager, ChunkDeltaCache &chunkDeltaCache,
+		AudioManager &audioManager, JPH::PhysicsSystem &physicsSystem, TextureManager &textureManager, Renderer &renderer);
 
 	// Prepares an entity for destruction later this frame, optionally notifying its chunk to remove its reference.
 	// Don't need to notify the chunk if it's being unloaded this frame.
 	void queueEntityDestroy(EntityInstanceID entityInstID, const ChunkInt2 *chunkToNotify);
 	void queueEntityDestroy(EntityInstanceID entityInstID, bool notifyChunk);
 
+	// Saves this frame's changes to level-placed entities, i.e. killed enemies and unlocked or emptied containers.
+	void writeChunkDeltas(ChunkDeltaCache &chunkDeltaCache);
+
 	void endFrame(JPH::PhysicsSystem &physicsSystem, Renderer &renderer);
 	void clear(JPH::PhysicsSystem &physicsSystem, Renderer &renderer);
 };
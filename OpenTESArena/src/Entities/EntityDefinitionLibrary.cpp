@@ -115,8 +115,16 @@ void EntityDefinitionKey::initVfx(VfxEntityAnimationType type, int index)
 	this->vfx.init(type, index);
 }
 
-EntityDefinitionLibrary::Entry::Entry(EntityDefinitionKey &&key, EntityDefinition &&def)
-	: key(std::move(key)), def(std::move(def)) { }
+EntityDefinitionLibrary::Entry::Entry(EntityDefinitionKey &&key, EntityDefinition &&def, EntityAnimationDefinitionID pendingAnimDefID)
+	: key(std::move(key)), def(std::move(def))
+{
+	this->pendingAnimDefID = pendingAnimDefID;
+}
+
+EntityDefinitionLibrary::EntityDefinitionLibrary()
+{
+	this->entityAnimLibrary = nullptr;
+}
 
 int EntityDefinitionLibrary::findDefIndex(const EntityDefinitionKey &key) const
 {
@@ -132,11 +140,12 @@ int EntityDefinitionLibrary::findDefIndex(const EntityDefinitionKey &key) const
 	return NO_INDEX;
 }
 
-void EntityDefinitionLibrary::init(const ExeData &exeData, const CharacterClassLibrary &charClassLibrary, const EntityAnimationLibrary &entityAnimLibrary)
+void EntityDefinitionLibrary::init(const ExeData &exeData, const CharacterClassLibrary &charClassLibrary, EntityAnimationLibrary &entityAnimLibrary)
 {
 	// This init method assumes that all creatures, human enemies, and citizens are known
 	// in advance of loading any levels, and any code that relies on those definitions can
 	// assume that no others are added by a level.
+	this->entityAnimLibrary = &entityAnimLibrary;
 
 	auto addCreatureDef = [this, &exeData, &entityAnimLibrary](int creatureID, bool isFinalBoss)
 	{
@@ -144,16 +153,15 @@ void EntityDefinitionLibrary::init(const ExeData &exeData, const CharacterClassL
 		animKey.init(creatureID);
 
 		const EntityAnimationDefinitionID animDefID = entityAnimLibrary.getCreatureAnimDefID(animKey);
-		EntityAnimationDefinition animDef = entityAnimLibrary.getDefinition(animDefID); // @todo: make const ref and give anim def ID to EntityDefinition instead
 		const int creatureIndex = ArenaAnimUtils::getCreatureIndexFromID(creatureID);
 
 		EntityDefinitionKey key;
 		key.initCreature(creatureIndex, isFinalBoss);
 
 		EntityDefinition entityDef;
-		entityDef.initEnemyCreature(creatureIndex, isFinalBoss, exeData, std::move(animDef));
+		entityDef.initEnemyCreature(creatureIndex, isFinalBoss, exeData, EntityAnimationDefinition());
 
-		this->addDefinition(std::move(key), std::move(entityDef));
+		this->addDefinition(std::move(key), std::move(entityDef), animDefID);
 	};
 
 	auto addHumanEnemyDef = [this, &exeData, &entityAnimLibrary](bool male, int charClassID)
@@ -162,15 +170,14 @@ void EntityDefinitionLibrary::init(const ExeData &exeData, const CharacterClassL
 		animKey.init(male, charClassID);
 
 		const EntityAnimationDefinitionID animDefID = entityAnimLibrary.getHumanEnemyAnimDefID(animKey);
-		EntityAnimationDefinition animDef = entityAnimLibrary.getDefinition(animDefID); // @todo: make const ref and give anim def ID to EntityDefinition instead
 
 		EntityDefinitionKey key;
 		key.initHumanEnemy(male, charClassID);
 
 		EntityDefinition entityDef;
-		entityDef.initEnemyHuman(male, charClassID, std::move(animDef));
+		entityDef.initEnemyHuman(male, charClassID, EntityAnimationDefinition());
 
-		this->addDefinition(std::move(key), std::move(entityDef));
+		this->addDefinition(std::move(key), std::move(entityDef), animDefID);
 	};
 
 	auto addCitizenDef = [this, &exeData, &entityAnimLibrary](ArenaClimateType climateType, bool male)
@@ -179,15 +186,14 @@ void EntityDefinitionLibrary::init(const ExeData &exeData, const CharacterClassL
 		animKey.init(male, climateType);
 
 		const EntityAnimationDefinitionID animDefID = entityAnimLibrary.getCitizenAnimDefID(animKey);
-		EntityAnimationDefinition animDef = entityAnimLibrary.getDefinition(animDefID); // @todo: make const ref and give anim def ID to EntityDefinition instead
 
 		EntityDefinitionKey key;
 		key.initCitizen(male, climateType);
 
 		EntityDefinition entityDef;
-		entityDef.initCitizen(male, climateType, std::move(animDef));
+		entityDef.initCitizen(male, climateType, EntityAnimationDefinition());
 
-		this->addDefinition(std::move(key), std::move(entityDef));
+		this->addDefinition(std::move(key), std::move(entityDef), animDefID);
 	};
 
 	auto addVfxDef = [this, &exeData, &entityAnimLibrary](VfxEntityAnimationType type, int index)
@@ -210,15 +216,14 @@ void EntityDefinitionLibrary::init(const ExeData &exeData, const CharacterClassL
 		}
 
 		const EntityAnimationDefinitionID animDefID = entityAnimLibrary.getVfxAnimDefID(animKey);
-		EntityAnimationDefinition animDef = entityAnimLibrary.getDefinition(animDefID); // @todo: make const ref and give anim def ID to EntityDefinition instead
 
 		EntityDefinitionKey key;
 		key.initVfx(type, index);
 
 		EntityDefinition entityDef;
-		entityDef.initVfx(type, index, std::move(animDef));
+		entityDef.initVfx(type, index, EntityAnimationDefinition());
 
-		this->addDefinition(std::move(key), std::move(entityDef));
+		this->addDefinition(std::move(key), std::move(entityDef), animDefID);
 	};
 
 	// Iterate all creatures + final boss.
@@ -277,7 +282,21 @@ int EntityDefinitionLibrary::getDefinitionCount() const
 const EntityDefinition &EntityDefinitionLibrary::getDefinition(EntityDefID defID) const
 {
 	DebugAssertIndex(this->entries, defID);
-	return this->entries[defID].def;
+	const Entry &entry = this->entries[defID];
+	if (entry.pendingAnimDefID >= 0)
+	{
+		DebugAssert(this->entityAnimLibrary != nullptr);
+		entry.def.animDef = this->entityAnimLibrary->getDefinition(entry.pendingAnimDefID); // @todo: give anim def ID to EntityDefinition instead
+		entry.pendingAnimDefID = -1;
+	}
+
+	return entry.def;
+}
+
+EntityDefinitionType EntityDefinitionLibrary::getDefinitionType(EntityDefID defID) const
+{
+	DebugAssertIndex(this->entries, defID);
+	return this->entries[defID].def.type;
 }
 
 bool EntityDefinitionLibrary::tryGetDefinitionID(const EntityDefinitionKey &key, EntityDefID *outDefID) const
@@ -294,7 +313,7 @@ bool EntityDefinitionLibrary::tryGetDefinitionID(const EntityDefinitionKey &key,
 	}
 }
 
-EntityDefID EntityDefinitionLibrary::addDefinition(EntityDefinitionKey &&key, EntityDefinition &&def)
+EntityDefID EntityDefinitionLibrary::addDefinition(EntityDefinitionKey &&key, EntityDefinition &&def, EntityAnimationDefinitionID pendingAnimDefID)
 {
 	EntityDefID existingDefID;
 	if (this->tryGetDefinitionID(key, &existingDefID))
@@ -303,10 +322,15 @@ EntityDefID EntityDefinitionLibrary::addDefinition(EntityDefinitionKey &&key, En
 		return existingDefID;
 	}
 
-	this->entries.emplace_back(Entry(std::move(key), std::move(def)));
+	this->entries.emplace_back(Entry(std::move(key), std::move(def), pendingAnimDefID));
 	return static_cast<EntityDefID>(this->entries.size()) - 1;
 }
 
+EntityDefID EntityDefinitionLibrary::addDefinition(EntityDefinitionKey &&key, EntityDefinition &&def)
+{
+	return this->addDefinition(std::move(key), std::move(def), -1);
+}
+
 void EntityDefinitionLibrary::clear()
 {
 	this->entries.clear();
@@ -3,13 +3,13 @@
 
 #include <vector>
 
+#include "EntityAnimationLibrary.h"
 #include "EntityDefinition.h"
 #include "EntityUtils.h"
 #include "../Assets/ArenaTypes.h"
 
 #include "components/utilities/Singleton.h"
 
-class EntityAnimationLibrary;
 class TextureManager;
 
 struct ExeData;
@@ -88,7 +88,8 @@ struct EntityDefinitionKey
 
 // Collection of various entity definitions. Not all definition types are supported
 // due to insufficient information for look-up/comparison and therefore the definitions
-// must be split between this library and the currently active level.
+// must be split between this library and the currently active level. Animations come
+// from the entity animation library the first time a definition is requested.
 class EntityDefinitionLibrary : public Singleton<EntityDefinitionLibrary>
 {
 private:
@@ -97,12 +98,16 @@ private:
 	struct Entry
 	{
 		EntityDefinitionKey key;
-		EntityDefinition def;
+		mutable EntityDefinition def;
+		mutable EntityAnimationDefinitionID pendingAnimDefID; // Copied into the definition on first request, -1 once done.
 
-		Entry(EntityDefinitionKey &&key, EntityDefinition &&def);
+		Entry(EntityDefinitionKey &&key, EntityDefinition &&def, EntityAnimationDefinitionID pendingAnimDefID);
 	};
 
 	std::vector<Entry> entries;
+	EntityAnimationLibrary *entityAnimLibrary;
+
+	EntityDefID addDefinition(EntityDefinitionKey &&key, EntityDefinition &&def, EntityAnimationDefinitionID pendingAnimDefID);
 
 	int findDefIndex(const EntityDefinitionKey &key) const;
 public:
@@ -121,15 +126,21 @@ public:
 		}
 	}
 
-	void init(const ExeData &exeData, const CharacterClassLibrary &charClassLibrary, const EntityAnimationLibrary &entityAnimLibrary);
+	EntityDefinitionLibrary();
+
+	void init(const ExeData &exeData, const CharacterClassLibrary &charClassLibrary, EntityAnimationLibrary &entityAnimLibrary);
 
 	// Gets the number of entity definitions. This is useful for the currently-active entity
 	// manager that needs to start its definition IDs at the end of these.
 	int getDefinitionCount() const;
 
-	// Returns raw handle to entity definition (does not protect from dangling pointers).
+	// Returns raw handle to entity definition (does not protect from dangling pointers). Loads its animation
+	// if this is the first request, so it must be called on the main thread.
 	const EntityDefinition &getDefinition(EntityDefID defID) const;
 
+	// Doesn't load the definition's animation.
+	EntityDefinitionType getDefinitionType(EntityDefID defID) const;
+
 	// Attempts to get the definition ID paired with the given definition key.
 	bool tryGetDefinitionID(const EntityDefinitionKey &key, EntityDefID *outDefID) const;
 
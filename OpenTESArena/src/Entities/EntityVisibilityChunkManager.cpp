@@ -16,12 +16,12 @@ void EntityVisibilityChunkManager::update(Span<const ChunkInt2> activeChunkPosit
 	{
 		const VoxelChunk &voxelChunk = voxelChunkManager.getChunkAtPosition(chunkPos);
 
-		const int spawnIndex = this->spawnChunk();
+		const int spawnIndex = this->spawnChunk(chunkPos);
 		EntityVisibilityChunk &visChunk = this->getChunkAtIndex(spawnIndex);
 		visChunk.init(chunkPos, voxelChunk.height);
 	}
 
-	this->chunkPool.clear();
+	this->trimChunkPool();
 
 	for (const ChunkInt2 chunkPos : activeChunkPositions)
 	{
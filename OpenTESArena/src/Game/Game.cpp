@@ -1,14 +1,16 @@
+#include <algorithm>
 #include <chrono>
 #include <cmath>
 #include <cstdint>
+#include <deque>
 #include <filesystem>
+#include <functional>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <thread>
 
 #include "Jolt/Jolt.h"
-#include "Jolt/Core/JobSystemThreadPool.h"
 #include "Jolt/Core/TempAllocator.h"
 #include "Jolt/Physics/PhysicsSystem.h"
 #include "SDL.h"
@@ -16,6 +18,7 @@
 #include "Game.h"
 #include "Options.h"
 #include "../Assets/ArenaLevelLibrary.h"
+#include "../Assets/AssetCache.h"
 #include "../Assets/BinaryAssetLibrary.h"
 #include "../Assets/CityDataFile.h"
 #include "../Assets/TextAssetLibrary.h"
@@ -25,6 +28,7 @@
 #include "../Collision/Physics.h"
 #include "../Collision/PhysicsBodyActivationListener.h"
 #include "../Collision/PhysicsContactListener.h"
+#include "../Collision/PhysicsJobSystem.h"
 #include "../Collision/PhysicsLayer.h"
 #include "../Entities/EntityAnimationLibrary.h"
 #include "../Entities/EntityDefinitionLibrary.h"
@@ -79,7 +83,10 @@ namespace
 		std::chrono::time_point<std::chrono::high_resolution_clock> previousTimePoint, currentTimePoint;
 		double deltaTime; // Difference between frame times in seconds.
 		double clampedDeltaTime; // For game logic calculations that become imprecise or break at low FPS.
-		int physicsSteps; // 1 unless the engine has to do more steps this frame to keep numeric accuracy.
+		double physicsStepSeconds; // Fixed duration of one physics step.
+		double physicsAccumulatedSeconds; // Simulation time not yet covered by a physics step.
+		int physicsSteps; // Fixed-length physics steps to run this frame, can be 0 at high FPS.
+		double physicsInterpolationPercent; // How far between the last two physics steps the rendered frame is.
 
 		FrameTimer()
 		{
@@ -87,7 +94,10 @@ namespace
 			this->minimumFrameDuration = std::chrono::nanoseconds(0);
 			this->deltaTime = 0.0;
 			this->clampedDeltaTime = 0.0;
+			this->physicsStepSeconds = 0.0;
+			this->physicsAccumulatedSeconds = 0.0;
 			this->physicsSteps = 0;
+			this->physicsInterpolationPercent = 0.0;
 		}
 
 		void init()
@@ -129,7 +139,102 @@ namespace
 			constexpr double timeUnitsReal = static_cast<double>(std::nano::den);
 			this->deltaTime = static_cast<double>(previousFrameDuration.count()) / timeUnitsReal;
 			this->clampedDeltaTime = std::fmin(previousFrameDuration.count(), this->maximumFrameDuration.count()) / timeUnitsReal;
-			this->physicsSteps = static_cast<int>(std::ceil(this->clampedDeltaTime / Physics::DeltaTime));
+		}
+
+		void updatePhysicsSteps(int physicsTickRate)
+		{
+			DebugAssert(physicsTickRate > 0);
+			this->physicsStepSeconds = 1.0 / static_cast<double>(physicsTickRate);
+			this->physicsAccumulatedSeconds += this->clampedDeltaTime;
+			this->physicsSteps = static_cast<int>(this->physicsAccumulatedSeconds / this->physicsStepSeconds);
+
+			if (this->physicsSteps > Physics::MaxStepsPerFrame)
+			{
+				// Too far behind to catch up without making the next frame slow too.
+				this->physicsSteps = Physics::MaxStepsPerFrame;
+				this->physicsAccumulatedSeconds = static_cast<double>(this->physicsSteps) * this->physicsStepSeconds;
+			}
+
+			this->physicsAccumulatedSeconds -= static_cast<double>(this->physicsSteps) * this->physicsStepSeconds;
+			this->physicsInterpolationPercent = std::clamp(this->physicsAccumulatedSeconds / this->physicsStepSeconds, 0.0, 1.0);
+		}
+	};
+
+	// Asset library inits as a job graph so independent ones can load at the same time. Each init returns
+	// whether it succeeded and logs its own error.
+	class LibraryInitGraph
+	{
+	private:
+		struct Task
+		{
+			const char *name;
+			std::function<bool()> func;
+			std::vector<const Task*> dependencies;
+			double seconds;
+			bool success;
+		};
+
+		std::deque<Task> tasks; // Same order as job IDs. Deque so jobs can keep pointers to their task.
+		JobGraph jobGraph;
+	public:
+		// Returns the job ID for later tasks to depend on.
+		int addTask(const char *name, std::function<bool()> &&func, std::initializer_list<int> dependencyJobIDs = {})
+		{
+			Task &task = this->tasks.emplace_back();
+			task.name = name;
+			task.func = std::move(func);
+			task.seconds = 0.0;
+			task.success = false;
+
+			for (const int dependencyJobID : dependencyJobIDs)
+			{
+				task.dependencies.emplace_back(&this->tasks[dependencyJobID]);
+			}
+
+			Task *taskPtr = &task;
+			const int jobID = this->jobGraph.addJob([taskPtr]()
+			{
+				for (const Task *dependency : taskPtr->dependencies)
+				{
+					if (!dependency->success)
+					{
+						// Already reported by the dependency.
+						return;
+					}
+				}
+
+				const auto startTime = std::chrono::high_resolution_clock::now();
+				taskPtr->success = taskPtr->func();
+				taskPtr->seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+			});
+
+			DebugAssert(jobID == static_cast<int>(this->tasks.size()) - 1);
+
+			for (const int dependencyJobID : dependencyJobIDs)
+			{
+				this->jobGraph.addDependency(jobID, dependencyJobID);
+			}
+
+			return jobID;
+		}
+
+		// Returns false if any library failed. Libraries depending on a failed one are skipped.
+		bool run(JobSystem &jobSystem)
+		{
+			const auto startTime = std::chrono::high_resolution_clock::now();
+			jobSystem.run(this->jobGraph);
+			const double totalSeconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+
+			bool success = true;
+			for (const Task &task : this->tasks)
+			{
+				DebugLogFormat("Initialized %s in %.2fms.", task.name, task.seconds * 1000.0);
+				success &= task.success;
+			}
+
+			DebugLogFormat("Initialized asset libraries in %.2fms (%d threads).", totalSeconds * 1000.0, jobSystem.getThreadCount() + 1);
+			this->jobGraph.clear();
+			return success;
 		}
 	};
 
@@ -231,6 +336,11 @@ Game::~Game()
 		this->inputManager.removeListener(*this->renderTargetsResetListenerID);
 	}
 
+	if (this->lowMemoryListenerID.has_value())
+	{
+		this->inputManager.removeListener(*this->lowMemoryListenerID);
+	}
+
 	if (this->takeScreenshotListenerID.has_value())
 	{
 		this->inputManager.removeListener(*this->takeScreenshotListenerID);
@@ -277,6 +387,11 @@ bool Game::init()
 
 	VFS::Manager::get().initialize(std::string(arenaPath));
 
+	if (this->options.getMisc_EnableAssetCache())
+	{
+		AssetCache::getInstance().init(Platform::getCachePath() + "assets/");
+	}
+
 	const bool midiPathIsRelative = Path::isRelative(this->options.getAudio_MidiConfig().c_str());
 	const std::string midiFilePath = (midiPathIsRelative ? basePath : "") + this->options.getAudio_MidiConfig();
 	const std::string audioDataPath = dataFolderPath + "audio/";
@@ -308,6 +423,9 @@ bool Game::init()
 		return false;
 	}
 
+	// The thread running the game loop also executes jobs.
+	this->jobSystem.init(Platform::getThreadCount() - 1);
+
 	const double logicalToPixelScale = this->window.getLogicalToPixelScale();
 	this->inputManager.init(logicalToPixelScale);
 
@@ -330,6 +448,12 @@ bool Game::init()
 		this->renderer.handleRenderTargetsReset();
 	});
 
+	this->lowMemoryListenerID = this->inputManager.addLowMemoryListener(
+		[this]()
+	{
+		this->sceneManager.freeChunkPools();
+	});
+
 	this->takeScreenshotListenerID = this->inputManager.addInputActionListener(InputActionName::Screenshot,
 		[this](const InputActionCallbackValues &values)
 	{
@@ -343,70 +467,178 @@ bool Game::init()
 	this->debugProfilerListenerID = this->inputManager.addInputActionListener(
 		InputActionName::DebugProfiler, CommonUiController::onDebugInputAction);
 
-	// Load various asset libraries.
-	if (!FontLibrary::getInstance().init())
+	// Load various asset libraries. Anything using the texture manager has to run one at a time since it isn't thread-safe.
+	FontLibrary &fontLibrary = FontLibrary::getInstance();
+	MeshLibrary &meshLibrary = MeshLibrary::getInstance();
+	ArenaLevelLibrary &arenaLevelLibrary = ArenaLevelLibrary::getInstance();
+	BinaryAssetLibrary &binaryAssetLibrary = BinaryAssetLibrary::getInstance();
+	TextAssetLibrary &textAssetLibrary = TextAssetLibrary::getInstance();
+	ClockLibrary &clockLibrary = ClockLibrary::getInstance();
+	SoundLibrary &soundLibrary = SoundLibrary::getInstance();
+	MusicLibrary &musicLibrary = MusicLibrary::getInstance();
+	CinematicLibrary &cinematicLibrary = CinematicLibrary::getInstance();
+	ItemConditionLibrary &itemConditionLibrary = ItemConditionLibrary::getInstance();
+	ItemMaterialLibrary &itemMaterialLibrary = ItemMaterialLibrary::getInstance();
+	ItemLibrary &itemLibrary = ItemLibrary::getInstance();
+	WeaponAnimationLibrary &weaponAnimLibrary = WeaponAnimationLibrary::getInstance();
+	CharacterClassLibrary &charClassLibrary = CharacterClassLibrary::getInstance();
+	CharacterRaceLibrary &charRaceLibrary = CharacterRaceLibrary::getInstance();
+	EntityAnimationLibrary &entityAnimLibrary = EntityAnimationLibrary::getInstance();
+	EntityDefinitionLibrary &entityDefLibrary = EntityDefinitionLibrary::getInstance();
+	const ExeData &exeData = binaryAssetLibrary.getExeData();
+	TextureManager &textureManager = this->textureManager;
+
+	LibraryInitGraph libraryInitGraph;
+	libraryInitGraph.addTask("font library", [&fontLibrary]()
 	{
-		DebugLogError("Couldn't init font library.");
-		return false;
-	}
+		if (!fontLibrary.init())
+		{
+			DebugLogError("Couldn't init font library.");
+			return false;
+		}
+
+		return true;
+	});
 
 	const std::string meshLibraryPath = dataFolderPath + "meshes/";
-	if (!MeshLibrary::getInstance().init(meshLibraryPath.c_str()))
+	libraryInitGraph.addTask("mesh library", [&meshLibrary, &meshLibraryPath]()
 	{
-		DebugLogError("Couldn't init mesh library.");
-		return false;
-	}
+		if (!meshLibrary.init(meshLibraryPath.c_str()))
+		{
+			DebugLogError("Couldn't init mesh library.");
+			return false;
+		}
+
+		return true;
+	});
 
-	if (!ArenaLevelLibrary::getInstance().init())
+	libraryInitGraph.addTask("Arena level library", [&arenaLevelLibrary]()
 	{
-		DebugLogError("Couldn't init Arena level library.");
-		return false;
-	}
+		if (!arenaLevelLibrary.init())
+		{
+			DebugLogError("Couldn't init Arena level library.");
+			return false;
+		}
 
-	BinaryAssetLibrary &binaryAssetLibrary = BinaryAssetLibrary::getInstance();
-	if (!binaryAssetLibrary.init(isFloppyDiskVersion))
+		return true;
+	});
+
+	const int binaryAssetJobID = libraryInitGraph.addTask("binary asset library", [&binaryAssetLibrary, isFloppyDiskVersion]()
 	{
-		DebugLogError("Couldn't init binary asset library.");
-		return false;
-	}
+		if (!binaryAssetLibrary.init(isFloppyDiskVersion))
+		{
+			DebugLogError("Couldn't init binary asset library.");
+			return false;
+		}
 
-	if (!TextAssetLibrary::getInstance().init())
+		return true;
+	});
+
+	libraryInitGraph.addTask("text asset library", [&textAssetLibrary]()
 	{
-		DebugLogError("Couldn't init text asset library.");
-		return false;
-	}
+		if (!textAssetLibrary.init())
+		{
+			DebugLogError("Couldn't init text asset library.");
+			return false;
+		}
+
+		return true;
+	});
 
 	const std::string clockLibraryPath = dataFolderPath + "Clocks.txt";
-	if (!ClockLibrary::getInstance().init(clockLibraryPath.c_str()))
+	libraryInitGraph.addTask("clock library", [&clockLibrary, &clockLibraryPath]()
 	{
-		DebugLogError("Couldn't init clock library with path \"" + clockLibraryPath + "\".");
-		return false;
-	}
+		if (!clockLibrary.init(clockLibraryPath.c_str()))
+		{
+			DebugLogError("Couldn't init clock library with path \"" + clockLibraryPath + "\".");
+			return false;
+		}
+
+		return true;
+	});
 
-	SoundLibrary::getInstance().init();
+	libraryInitGraph.addTask("sound library", [&soundLibrary]()
+	{
+		soundLibrary.init();
+		return true;
+	});
 
 	const std::string musicLibraryPath = audioDataPath + "MusicDefinitions.txt";
-	if (!MusicLibrary::getInstance().init(musicLibraryPath.c_str()))
+	libraryInitGraph.addTask("music library", [&musicLibrary, &musicLibraryPath]()
 	{
-		DebugLogError("Couldn't init music library with path \"" + musicLibraryPath + "\".");
-		return false;
-	}
+		if (!musicLibrary.init(musicLibraryPath.c_str()))
+		{
+			DebugLogError("Couldn't init music library with path \"" + musicLibraryPath + "\".");
+			return false;
+		}
 
-	CinematicLibrary::getInstance().init();
+		return true;
+	});
 
-	const ExeData &exeData = binaryAssetLibrary.getExeData();
-	ItemConditionLibrary::getInstance().init(exeData);
-	ItemMaterialLibrary::getInstance().init(exeData);
-	ItemLibrary::getInstance().init(exeData);
-	WeaponAnimationLibrary::getInstance().init(exeData, this->textureManager);
+	libraryInitGraph.addTask("cinematic library", [&cinematicLibrary]()
+	{
+		cinematicLibrary.init();
+		return true;
+	});
 
-	CharacterClassLibrary &charClassLibrary = CharacterClassLibrary::getInstance();
-	charClassLibrary.init(exeData);
-	CharacterRaceLibrary::getInstance().init(exeData);
+	libraryInitGraph.addTask("item condition library", [&itemConditionLibrary, &exeData]()
+	{
+		itemConditionLibrary.init(exeData);
+		return true;
+	}, { binaryAssetJobID });
 
-	EntityAnimationLibrary &entityAnimLibrary = EntityAnimationLibrary::getInstance();
-	entityAnimLibrary.init(binaryAssetLibrary, charClassLibrary, this->textureManager);
-	EntityDefinitionLibrary::getInstance().init(exeData, charClassLibrary, entityAnimLibrary);
+	libraryInitGraph.addTask("item material library", [&itemMaterialLibrary, &exeData]()
+	{
+		itemMaterialLibrary.init(exeData);
+		return true;
+	}, { binaryAssetJobID });
+
+	libraryInitGraph.addTask("item library", [&itemLibrary, &exeData]()
+	{
+		itemLibrary.init(exeData);
+		return true;
+	}, { binaryAssetJobID });
+
+	libraryInitGraph.addTask("weapon animation library", [&weaponAnimLibrary, &exeData, &textureManager]()
+	{
+		weaponAnimLibrary.init(exeData, textureManager);
+		return true;
+	}, { binaryAssetJobID });
+
+	const int charClassJobID = libraryInitGraph.addTask("character class library", [&charClassLibrary, &exeData]()
+	{
+		charClassLibrary.init(exeData);
+		return true;
+	}, { binaryAssetJobID });
+
+	libraryInitGraph.addTask("character race library", [&charRaceLibrary, &exeData]()
+	{
+		charRaceLibrary.init(exeData);
+		return true;
+	}, { binaryAssetJobID });
+
+	const int entityAnimJobID = libraryInitGraph.addTask("entity animation library",
+		[&entityAnimLibrary, &binaryAssetLibrary, &charClassLibrary, &textureManager]()
+	{
+		entityAnimLibrary.init(binaryAssetLibrary, charClassLibrary, textureManager);
+		return true;
+	}, { binaryAssetJobID, charClassJobID });
+
+	libraryInitGraph.addTask("entity definition library", [&entityDefLibrary, &exeData, &charClassLibrary, &entityAnimLibrary]()
+	{
+		entityDefLibrary.init(exeData, charClassLibrary, entityAnimLibrary);
+		return true;
+	}, { charClassJobID, entityAnimJobID });
+
+	if (!libraryInitGraph.run(this->jobSystem))
+	{
+		return false;
+	}
+
+	if (this->options.getMisc_PrefetchCityBlocks())
+	{
+		arenaLevelLibrary.prefetchCityBlockMifs(this->jobSystem);
+	}
 
 	this->sceneManager.init(this->textureManager, this->renderer);
 	this->sceneManager.renderVoxelChunkManager.init(this->renderer);
@@ -756,17 +988,36 @@ void Game::updateDebugInfoText()
 			const std::string renderColorOverdrawRatio = String::fixedPrecision(static_cast<double>(profilerData.totalColorWrites) / static_cast<double>(profilerData.pixelCount), 2);
 			const std::string objectTextureMbCount = String::fixedPrecision(static_cast<double>(profilerData.objectTextureByteCount) / (1024.0 * 1024.0), 2);
 			const std::string uiTextureMbCount = String::fixedPrecision(static_cast<double>(profilerData.uiTextureByteCount) / (1024.0 * 1024.0), 2);
+
+			std::string renderGeometryRate = "N/A";
+			if (profilerData.geometrySeconds > 0.0)
+			{
+				const double trianglesPerSecond = static_cast<double>(profilerData.geometryTriangleCount) / profilerData.geometrySeconds;
+				renderGeometryRate = String::fixedPrecision(trianglesPerSecond / 1000000.0, 2) + "M tris/s per thread";
+			}
+
+			std::string renderThreadBalance;
+			if (!profilerData.threadBusyTimes.empty())
+			{
+				const auto busyTimeMinMax = std::minmax_element(profilerData.threadBusyTimes.begin(), profilerData.threadBusyTimes.end());
+				const auto idleTimeMax = std::max_element(profilerData.threadIdleTimes.begin(), profilerData.threadIdleTimes.end());
+				renderThreadBalance = "\nThread busy: " + String::fixedPrecision(*busyTimeMinMax.first * 1000.0, 2) + "-" +
+					String::fixedPrecision(*busyTimeMinMax.second * 1000.0, 2) + "ms, idle max: " + String::fixedPrecision(*idleTimeMax * 1000.0, 2) + "ms";
+			}
+
 			debugText.append("\nScene: " + renderWidth + "x" + renderHeight + " (" + renderResScale + ")" + '\n' +
-				"Render: " + renderTime + "ms, " + renderThreadCount + " thread" + ((profilerData.threadCount > 1) ? "s" : "") + '\n' +
+				"Render: " + renderTime + "ms, " + renderThreadCount + " thread" + ((profilerData.threadCount > 1) ? "s" : "") + renderThreadBalance + '\n' +
 				"Object textures: " + std::to_string(profilerData.objectTextureCount) + " (" + objectTextureMbCount + "MB)" + '\n' +
 				"UI textures: " + std::to_string(profilerData.uiTextureCount) + " (" + uiTextureMbCount + "MB)" + '\n' +
 				"Materials: " + std::to_string(profilerData.materialCount) + '\n' +
 				"Draw calls: " + renderDrawCallCount + '\n' +
 				"Rendered Tris: " + std::to_string(profilerData.presentedTriangleCount) + '\n' +
+				"Geometry: " + std::to_string(profilerData.geometryTriangleCount) + " tris, " + renderGeometryRate + '\n' +
 				"Lights: " + std::to_string(profilerData.totalLightCount) + '\n' +
 				"Coverage tests: " + renderCoverageTestRatio + "x" + '\n' +
 				"Depth tests: " + renderDepthTestRatio + "x" + '\n' +
-				"Overdraw: " + renderColorOverdrawRatio + "x");
+				"Overdraw: " + renderColorOverdrawRatio + "x" + '\n' +
+				"HiZ rejected: " + std::to_string(profilerData.totalHiZRejectedTriangles) + " tris, " + std::to_string(profilerData.totalHiZRejectedTiles) + " tiles");
 		}
 		else
 		{
@@ -790,7 +1041,9 @@ void Game::updateDebugInfoText()
 
 		debugText.append("\nChunk: " + chunkStr + '\n' +
 			"Chunk pos: " + chunkPosX + ", " + chunkPosY + ", " + chunkPosZ + '\n' +
-			"Dir: " + dirX + ", " + dirY + ", " + dirZ);
+			"Dir: " + dirX + ", " + dirY + ", " + dirZ + '\n' +
+			"Pooled chunks: " + std::to_string(this->sceneManager.getPooledChunkCount()) + ", allocated: " +
+			std::to_string(this->sceneManager.getChunkAllocationCount()));
 
 		if (this->shouldRenderScene)
 		{
@@ -822,7 +1075,8 @@ void Game::loop()
 	this->physicsSystem.SetBodyActivationListener(&physicsBodyActivationListener);
 	this->physicsSystem.SetContactListener(&physicsContactListener);
 
-	JPH::JobSystemThreadPool physicsJobThreadPool(JPH::cMaxPhysicsJobs, JPH::cMaxPhysicsBarriers, Physics::ThreadCount); // @todo: implement own derived JobSystem class
+	PhysicsJobSystem physicsJobSystem;
+	physicsJobSystem.init(JPH::cMaxPhysicsJobs, JPH::cMaxPhysicsBarriers, this->jobSystem);
 
 	// Initialize panel and music to default (bootstrapping the first game frame).
 	this->panel = IntroUiModel::makeStartupPanel(*this);
@@ -920,6 +1174,7 @@ void Game::loop()
 				const int chunkDistance = this->options.getMisc_ChunkDistance();
 				ChunkManager &chunkManager = this->sceneManager.chunkManager;
 				chunkManager.update(oldPlayerChunk, chunkDistance);
+				this->sceneManager.setChunkPoolCapacity(this->options.getMisc_ChunkPoolSize());
 
 				this->gameState.tickGameClock(clampedDeltaTime, *this);
 				this->gameState.tickChasmAnimation(clampedDeltaTime);
@@ -933,9 +1188,14 @@ void Game::loop()
 				this->gameState.tickEntities(clampedDeltaTime, *this);
 				this->gameState.tickCollision(clampedDeltaTime, this->physicsSystem, *this);
 
-				this->player.prePhysicsStep(clampedDeltaTime, *this);
-				this->physicsSystem.Update(static_cast<float>(clampedDeltaTime), frameTimer.physicsSteps, &physicsAllocator, &physicsJobThreadPool);
-				this->player.postPhysicsStep(clampedDeltaTime, *this);
+				frameTimer.updatePhysicsSteps(this->options.getMisc_PhysicsTickRate());
+				const double physicsStepSeconds = frameTimer.physicsStepSeconds;
+				for (int i = 0; i < frameTimer.physicsSteps; i++)
+				{
+					this->player.prePhysicsStep(physicsStepSeconds, *this);
+					this->physicsSystem.Update(static_cast<float>(physicsStepSeconds), 1, &physicsAllocator, &physicsJobSystem);
+					this->player.postPhysicsStep(physicsStepSeconds, *this);
+				}
 
 				if (this->gameState.hasPendingLevelTransitionCalculation())
 				{
@@ -945,11 +1205,12 @@ void Game::loop()
 
 				const WorldDouble3 newPlayerPosition = this->player.getEyePosition();
 				const ChunkInt2 newPlayerChunk = VoxelUtils::worldPointToChunk(newPlayerPosition);
+				const WorldDouble3 interpolatedPlayerPosition = this->player.getInterpolatedEyePosition(frameTimer.physicsInterpolationPercent);
 				const Degrees newPlayerYaw = this->player.angleX;
 				const Degrees newPlayerPitch = this->player.angleY;
 				const double tallPixelRatio = RendererUtils::getTallPixelRatio(this->options.getGraphics_TallPixelCorrection());
 				RenderCamera renderCamera;
-				renderCamera.init(newPlayerPosition, newPlayerYaw, newPlayerPitch, this->options.getGraphics_VerticalFOV(), this->window.getSceneViewAspectRatio(), tallPixelRatio);
+				renderCamera.init(interpolatedPlayerPosition, newPlayerYaw, newPlayerPitch, this->options.getGraphics_VerticalFOV(), this->window.getSceneViewAspectRatio(), tallPixelRatio);
 
 				bool isFloatingOriginChanged = newPlayerChunk != oldPlayerChunk;
 				if (this->options.getMisc_GhostMode())
@@ -961,8 +1222,11 @@ void Game::loop()
 				this->gameState.tickVisibility(renderCamera, *this);
 				this->gameState.tickRendering(clampedDeltaTime, renderCamera, isFloatingOriginChanged, *this);
 
+				// Chunks populated in the background read from level definitions that a scene change can free.
+				this->sceneManager.voxelChunkManager.finishStreaming();
+
 				// Update audio listener orientation.
-				const AudioListenerState listenerState(newPlayerPosition, this->player.forward, this->player.up);
+				const AudioListenerState listenerState(interpolatedPlayerPosition, this->player.forward, this->player.up);
 				this->audioManager.updateListener(listenerState);
 			}
 
@@ -1051,7 +1315,8 @@ void Game::loop()
 				const ObjectTextureID skyBgTextureID = renderSkyManager.getBgTextureID();
 
 				frameSettings.init(Colors::Black, ambientPercent, visibleLightsBufferID, visibleLightCount, screenSpaceAnimPercent, paletteTextureID,
-					lightTableTextureID, ditherTextureID, skyBgTextureID, this->options.getGraphics_RenderThreadsMode(), ditheringMode);
+					lightTableTextureID, ditherTextureID, skyBgTextureID, this->options.getGraphics_RenderThreadsMode(), ditheringMode,
+					this->options.getGraphics_PipelinedRendering());
 			}
 
 			this->panel->populateCommandList(uiCommandList);
@@ -24,6 +24,7 @@
 #include "../World/SceneManager.h"
 
 #include "components/utilities/FPSCounter.h"
+#include "components/utilities/JobSystem.h"
 
 class Surface;
 
@@ -42,6 +43,7 @@ public:
 	TextureManager textureManager; // The texture manager object for loading images from file.
 	JPH::PhysicsSystem physicsSystem; // The Jolt physics system for the scene.
 	JPH::TempAllocatorImpl *physicsTempAllocator; // Available when game loop is active.
+	JobSystem jobSystem; // Worker threads shared by game systems that split their update per chunk, and physics.
 
 	// UI panels for the current interactivity and rendering sets. Needs to be positioned after the
 	// renderer member in this class due to UI texture order of destruction (panels first, then renderer).
@@ -80,7 +82,7 @@ public:
 private:
 	// Listener IDs are optional in case of failed Game construction.
 	std::optional<InputListenerID> applicationExitListenerID, windowResizedListenerID,
-		renderTargetsResetListenerID, takeScreenshotListenerID, debugProfilerListenerID;
+		renderTargetsResetListenerID, lowMemoryListenerID, takeScreenshotListenerID, debugProfilerListenerID;
 
 	bool requestedSubPanelPop;
 	bool running;
@@ -682,6 +682,8 @@ void GameState::applyPendingSceneChange(Game &game, JPH::PhysicsSystem &physicsS
 
 	sceneManager.voxelChunkManager.clear();
 	sceneManager.entityChunkManager.clear(physicsSystem, renderer);
+	sceneManager.chunkDeltaCache.clear();
+	sceneManager.rayCastEntityIndex.clear();
 	sceneManager.voxelBoxCombineChunkManager.recycleAllChunks();
 	sceneManager.voxelFaceEnableChunkManager.recycleAllChunks();
 	sceneManager.voxelFaceCombineChunkManager.recycleAllChunks();
@@ -723,6 +725,7 @@ void GameState::applyPendingSceneChange(Game &game, JPH::PhysicsSystem &physicsS
 	this->tickSky(0.0, game);
 	this->tickVisibility(renderCamera, game);
 	this->tickRendering(0.0, renderCamera, isFloatingOriginChanged, game);
+	sceneManager.voxelChunkManager.finishStreaming();
 
 	if (this->nextMusicFunc)
 	{
@@ -969,6 +972,7 @@ void GameState::tickVoxels(double dt, Game &game)
 	const Span<const ChunkInt2> activeChunkPositions = chunkManager.getActiveChunkPositions();
 	const Span<const ChunkInt2> newChunkPositions = chunkManager.getNewChunkPositions();
 	const Span<const ChunkInt2> freedChunkPositions = chunkManager.getFreedChunkPositions();
+	const Span<const ChunkInt2> streamingChunkPositions = chunkManager.getStreamingChunkPositions();
 
 	const Player &player = game.player;
 
@@ -983,20 +987,22 @@ void GameState::tickVoxels(double dt, Game &game)
 	const MapSubDefinition &mapSubDef = mapDef.getSubDefinition();
 
 	VoxelChunkManager &voxelChunkManager = sceneManager.voxelChunkManager;
-	voxelChunkManager.update(dt, newChunkPositions, freedChunkPositions, player.getEyeCoord(), &levelDef, &levelInfoDef,
-		mapSubDef, levelDefs, levelInfoDefIndices, levelInfoDefs, this->getActiveCeilingScale(), game.audioManager);
+	voxelChunkManager.update(dt, newChunkPositions, freedChunkPositions, streamingChunkPositions, player.getEyeCoord(), &levelDef, &levelInfoDef,
+		mapSubDef, levelDefs, levelInfoDefIndices, levelInfoDefs, this->getActiveCeilingScale(), sceneManager.chunkDeltaCache, game.audioManager);
 
+	// Dependent voxel chunks read voxel chunks and write only their own chunk, so each stage runs per chunk in parallel.
+	JobSystem &jobSystem = game.jobSystem;
 	VoxelBoxCombineChunkManager &voxelBoxCombineChunkManager = sceneManager.voxelBoxCombineChunkManager;
 	voxelBoxCombineChunkManager.updateActiveChunks(newChunkPositions, freedChunkPositions, voxelChunkManager);
-	voxelBoxCombineChunkManager.update(activeChunkPositions, newChunkPositions, voxelChunkManager);
+	voxelBoxCombineChunkManager.update(activeChunkPositions, newChunkPositions, voxelChunkManager, jobSystem);
 
 	VoxelFaceEnableChunkManager &voxelFaceEnableChunkManager = sceneManager.voxelFaceEnableChunkManager;
 	voxelFaceEnableChunkManager.updateActiveChunks(newChunkPositions, freedChunkPositions, voxelChunkManager);
-	voxelFaceEnableChunkManager.update(activeChunkPositions, newChunkPositions, voxelChunkManager);
+	voxelFaceEnableChunkManager.update(activeChunkPositions, newChunkPositions, voxelChunkManager, jobSystem);
 
 	VoxelFaceCombineChunkManager &voxelFaceCombineChunkManager = sceneManager.voxelFaceCombineChunkManager;
 	voxelFaceCombineChunkManager.updateActiveChunks(newChunkPositions, freedChunkPositions, voxelChunkManager);
-	voxelFaceCombineChunkManager.update(activeChunkPositions, newChunkPositions, voxelChunkManager, voxelFaceEnableChunkManager);
+	voxelFaceCombineChunkManager.update(activeChunkPositions, newChunkPositions, voxelChunkManager, voxelFaceEnableChunkManager, jobSystem);
 }
 
 void GameState::tickEntities(double dt, Game &game)
@@ -1045,8 +1051,11 @@ void GameState::tickEntities(double dt, Game &game)
 	EntityChunkManager &entityChunkManager = sceneManager.entityChunkManager;
 	entityChunkManager.update(dt, chunkManager.getActiveChunkPositions(), chunkManager.getNewChunkPositions(),
 		chunkManager.getFreedChunkPositions(), player, &levelDef, &levelInfoDef, mapSubDef, levelDefs, levelInfoDefIndices,
-		levelInfoDefs, entityGenInfo, citizenGenInfo, ceilingScale, game.random, voxelChunkManager, game.audioManager,
-		game.physicsSystem, game.textureManager, game.renderer);
+		levelInfoDefs, entityGenInfo, citizenGenInfo, ceilingScale, game.random, voxelChunkManager, sceneManager.chunkDeltaCache,
+		game.audioManager, game.physicsSystem, game.textureManager, game.renderer);
+
+	// Entities moved, spawned or despawned.
+	sceneManager.rayCastEntityIndex.clear();
 }
 
 void GameState::tickCollision(double dt, JPH::PhysicsSystem &physicsSystem, Game &game)
@@ -29,7 +29,8 @@ namespace
 		{ Options::Key_Graphics_ModernInterface, Options::OptionType_Graphics_ModernInterface },
 		{ Options::Key_Graphics_TallPixelCorrection, Options::OptionType_Graphics_TallPixelCorrection },
 		{ Options::Key_Graphics_RenderThreadsMode, Options::OptionType_Graphics_RenderThreadsMode },
-		{ Options::Key_Graphics_DitheringMode, Options::OptionType_Graphics_DitheringMode }
+		{ Options::Key_Graphics_DitheringMode, Options::OptionType_Graphics_DitheringMode },
+		{ Options::Key_Graphics_PipelinedRendering, Options::OptionType_Graphics_PipelinedRendering }
 	};
 
 	constexpr std::pair<const char*, OptionType> AudioMappings[] =
@@ -59,6 +60,10 @@ namespace
 		{ Options::Key_Misc_ShowIntro, Options::OptionType_Misc_ShowIntro },
 		{ Options::Key_Misc_ShowCompass, Options::OptionType_Misc_ShowCompass },
 		{ Options::Key_Misc_ChunkDistance, Options::OptionType_Misc_ChunkDistance },
+		{ Options::Key_Misc_ChunkPoolSize, Options::OptionType_Misc_ChunkPoolSize },
+		{ Options::Key_Misc_PhysicsTickRate, Options::OptionType_Misc_PhysicsTickRate },
+		{ Options::Key_Misc_PrefetchCityBlocks, Options::OptionType_Misc_PrefetchCityBlocks },
+		{ Options::Key_Misc_EnableAssetCache, Options::OptionType_Misc_EnableAssetCache },
 		{ Options::Key_Misc_StarDensity, Options::OptionType_Misc_StarDensity },
 		{ Options::Key_Misc_PlayerHasLight, Options::OptionType_Misc_PlayerHasLight },
 		{ Options::Key_Misc_EnableValidationLayers, Options::OptionType_Misc_EnableValidationLayers }
@@ -90,6 +90,9 @@ public:
 	static constexpr int MIN_RESAMPLING_MODE = 0;
 	static constexpr int MAX_RESAMPLING_MODE = 3;
 	static constexpr int MIN_CHUNK_DISTANCE = 1;
+	static constexpr int MIN_CHUNK_POOL_SIZE = 0;
+	static constexpr int MIN_PHYSICS_TICK_RATE = 30;
+	static constexpr int MAX_PHYSICS_TICK_RATE = 240;
 	static constexpr int MIN_STAR_DENSITY_MODE = 0;
 	static constexpr int MAX_STAR_DENSITY_MODE = 2;
 	static constexpr int MIN_PROFILER_LEVEL = 0;
@@ -169,6 +172,7 @@ void set##section##_##name(const std::string &value) \
 	OPTION_BOOL(Graphics, TallPixelCorrection)
 	OPTION_INT(Graphics, RenderThreadsMode, MIN_RENDER_THREADS_MODE, MAX_RENDER_THREADS_MODE)
 	OPTION_INT(Graphics, DitheringMode, MIN_DITHERING_MODE, MAX_DITHERING_MODE)
+	OPTION_BOOL(Graphics, PipelinedRendering)
 
 	OPTION_DOUBLE(Audio, MusicVolume, MIN_VOLUME, MAX_VOLUME)
 	OPTION_DOUBLE(Audio, SoundVolume, MIN_VOLUME, MAX_VOLUME)
@@ -189,6 +193,10 @@ void set##section##_##name(const std::string &value) \
 	OPTION_BOOL(Misc, ShowIntro)
 	OPTION_BOOL(Misc, ShowCompass)
 	OPTION_INT(Misc, ChunkDistance, MIN_CHUNK_DISTANCE, std::numeric_limits<int>::max())
+	OPTION_INT(Misc, ChunkPoolSize, MIN_CHUNK_POOL_SIZE, std::numeric_limits<int>::max())
+	OPTION_INT(Misc, PhysicsTickRate, MIN_PHYSICS_TICK_RATE, MAX_PHYSICS_TICK_RATE)
+	OPTION_BOOL(Misc, PrefetchCityBlocks)
+	OPTION_BOOL(Misc, EnableAssetCache)
 	OPTION_INT(Misc, StarDensity, MIN_STAR_DENSITY_MODE, MAX_STAR_DENSITY_MODE)
 	OPTION_BOOL(Misc, PlayerHasLight)
 	OPTION_BOOL(Misc, EnableValidationLayers)
@@ -12,4 +12,7 @@ using WindowResizedCallback = std::function<void(int width, int height)>;
 // When the application switches between desktop and exclusive fullscreen in some APIs like Direct3D.
 using RenderTargetsResetCallback = std::function<void()>;
 
+// When the operating system is running low on memory and caches should be freed.
+using LowMemoryCallback = std::function<void()>;
+
 #endif
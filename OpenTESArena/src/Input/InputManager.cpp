@@ -159,6 +159,18 @@ void InputManager::RenderTargetsResetListenerEntry::reset()
 	this->enabled = false;
 }
 
+void InputManager::LowMemoryListenerEntry::init(const LowMemoryCallback &callback)
+{
+	this->callback = callback;
+	this->enabled = true;
+}
+
+void InputManager::LowMemoryListenerEntry::reset()
+{
+	this->callback = []() { };
+	this->enabled = false;
+}
+
 void InputManager::TextInputListenerEntry::init(const TextInputCallback &callback)
 {
 	this->callback = callback;
@@ -286,6 +298,11 @@ bool InputManager::renderDeviceReset(const SDL_Event &e) const
 	return e.type == SDL_RENDER_DEVICE_RESET;
 }
 
+bool InputManager::lowMemory(const SDL_Event &e) const
+{
+	return e.type == SDL_APP_LOWMEMORY;
+}
+
 bool InputManager::isTextInput(const SDL_Event &e) const
 {
 	return e.type == SDL_TEXTINPUT;
@@ -447,6 +464,12 @@ InputListenerID InputManager::addRenderTargetsResetListener(const RenderTargetsR
 		this->renderTargetsResetListeners, this->freedRenderTargetsResetListenerIndices);
 }
 
+InputListenerID InputManager::addLowMemoryListener(const LowMemoryCallback &callback)
+{
+	return this->addListenerInternal(callback, ListenerType::LowMemory,
+		this->lowMemoryListeners, this->freedLowMemoryListenerIndices);
+}
+
 InputListenerID InputManager::addTextInputListener(const TextInputCallback &callback)
 {
 	return this->addListenerInternal(callback, ListenerType::TextInput,
@@ -516,6 +539,10 @@ void InputManager::removeListener(InputListenerID id)
 		{
 			resetListenerEntry(this->renderTargetsResetListeners, this->freedRenderTargetsResetListenerIndices, index);
 		}
+		else if (listenerType == ListenerType::LowMemory)
+		{
+			resetListenerEntry(this->lowMemoryListeners, this->freedLowMemoryListenerIndices, index);
+		}
 		else if (listenerType == ListenerType::TextInput)
 		{
 			resetListenerEntry(this->textInputListeners, this->freedTextInputListenerIndices, index);
@@ -582,6 +609,10 @@ void InputManager::setListenerEnabled(InputListenerID id, bool enabled)
 	{
 		setEnabled(this->windowResizedListeners, index);
 	}
+	else if (listenerType == ListenerType::LowMemory)
+	{
+		setEnabled(this->lowMemoryListeners, index);
+	}
 	else if (listenerType == ListenerType::TextInput)
 	{
 		setEnabled(this->textInputListeners, index);
@@ -757,6 +788,15 @@ void InputManager::update(Game &game, double dt, Span<const ButtonProxy> buttonP
 		}
 	}
 
+	std::vector<const LowMemoryListenerEntry*> enabledLowMemoryListeners;
+	for (const LowMemoryListenerEntry &entry : this->lowMemoryListeners)
+	{
+		if (entry.enabled)
+		{
+			enabledLowMemoryListeners.emplace_back(&entry);
+		}
+	}
+
 	std::vector<const TextInputListenerEntry*> enabledTextInputListeners;
 	for (const TextInputListenerEntry &entry : this->textInputListeners)
 	{
@@ -969,6 +1009,13 @@ void InputManager::update(Game &game, double dt, Span<const ButtonProxy> buttonP
 		{
 			DebugLogError("Render device reset not implemented.");
 		}
+		else if (this->lowMemory(e))
+		{
+			for (const LowMemoryListenerEntry *entry : enabledLowMemoryListeners)
+			{
+				entry->callback();
+			}
+		}
 		else if (this->isTextInput(e))
 		{
 			const std::string_view text = e.text.text;
@@ -37,6 +37,7 @@ private:
 		ApplicationExit,
 		WindowResized,
 		RenderTargetsReset,
+		LowMemory,
 		TextInput
 	};
 
@@ -122,6 +123,15 @@ private:
 		void reset();
 	};
 
+	struct LowMemoryListenerEntry
+	{
+		LowMemoryCallback callback;
+		bool enabled;
+
+		void init(const LowMemoryCallback &callback);
+		void reset();
+	};
+
 	struct TextInputListenerEntry
 	{
 		TextInputCallback callback;
@@ -142,6 +152,7 @@ private:
 	std::vector<ApplicationExitListenerEntry> applicationExitListeners;
 	std::vector<WindowResizedListenerEntry> windowResizedListeners;
 	std::vector<RenderTargetsResetListenerEntry> renderTargetsResetListeners;
+	std::vector<LowMemoryListenerEntry> lowMemoryListeners;
 	std::vector<TextInputListenerEntry> textInputListeners;
 
 	// Look-up values for valid listener entries, shared by all listener containers.
@@ -156,6 +167,7 @@ private:
 	std::vector<int> freedApplicationExitListenerIndices;
 	std::vector<int> freedWindowResizedListenerIndices;
 	std::vector<int> freedRenderTargetsResetListenerIndices;
+	std::vector<int> freedLowMemoryListenerIndices;
 	std::vector<int> freedTextInputListenerIndices;
 
 	InputListenerID nextListenerID;
@@ -202,6 +214,7 @@ public:
 	bool windowResized(const SDL_Event &e) const;
 	bool renderTargetsReset(const SDL_Event &e) const;
 	bool renderDeviceReset(const SDL_Event &e) const;
+	bool lowMemory(const SDL_Event &e) const;
 	bool isTextInput(const SDL_Event &e) const;
 	Int2 getMousePosition() const;
 	Int2 getMouseDelta() const;
@@ -217,6 +230,7 @@ public:
 	InputListenerID addApplicationExitListener(const ApplicationExitCallback &callback);
 	InputListenerID addWindowResizedListener(const WindowResizedCallback &callback);
 	InputListenerID addRenderTargetsResetListener(const RenderTargetsResetCallback &callback);
+	InputListenerID addLowMemoryListener(const LowMemoryCallback &callback);
 	InputListenerID addTextInputListener(const TextInputCallback &callback);
 
 	void removeListener(InputListenerID id);
@@ -848,24 +848,124 @@ void GameWorldUiView::DEBUG_ColorRaycastPixel(Game &game)
 	const double viewAspectRatio = window.getSceneViewAspectRatio();
 
 	const double ceilingScale = gameState.getActiveCeilingScale();
-	const SceneManager &sceneManager = game.sceneManager;
+	SceneManager &sceneManager = game.sceneManager;
+	const VoxelChunkManager &voxelChunkManager = sceneManager.voxelChunkManager;
+	const EntityChunkManager &entityChunkManager = sceneManager.entityChunkManager;
+	const CollisionChunkManager &collisionChunkManager = sceneManager.collisionChunkManager;
+
+	std::vector<Int2> rayPixels;
+	std::vector<RayCastQuery> rayQueries;
+	for (int y = 0; y < windowDims.y; y += yOffset)
+	{
+		for (int x = 0; x < windowDims.x; x += xOffset)
+		{
+			const Int2 pixel(x, y);
+			const Double3 rayDirection = GameWorldUiModel::screenToWorldRayDirection(game, pixel);
+
+			// Not registering entities with ray cast hits for efficiency since this debug visualization is for voxels.
+			constexpr bool includeEntities = false;
+			RayCastQuery rayQuery;
+			rayQuery.init(rayStart, rayDirection, cameraDirection, includeEntities);
+			rayPixels.emplace_back(pixel);
+			rayQueries.emplace_back(rayQuery);
+		}
+	}
+
+	std::vector<RayCastHit> hits(rayQueries.size());
+	Physics::rayCastBatch(rayQueries, ceilingScale, voxelChunkManager, entityChunkManager, collisionChunkManager,
+		sceneManager.rayCastEntityIndex, hits);
+
+	for (int i = 0; i < static_cast<int>(hits.size()); i++)
+	{
+		const RayCastHit &hit = hits[i];
+		if (hit.t == RayCastHit::NO_HIT_DISTANCE)
+		{
+			continue;
+		}
+
+		const Int2 pixel = rayPixels[i];
+		Color color;
+		switch (hit.type)
+		{
+		case RayCastHitType::Voxel:
+		{
+			constexpr Color colors[] = { Colors::Red, Colors::Green, Colors::Blue, Colors::Cyan, Colors::Yellow };
+			const RayCastVoxelHit &voxelHit = hit.voxelHit;
+			const VoxelInt3 voxel = voxelHit.voxelCoord.voxel;
+			const int colorsIndex = std::clamp<int>(voxel.y, 0, std::size(colors) - 1);
+			DebugAssertIndex(colors, colorsIndex);
+			color = colors[colorsIndex];
+			break;
+		}
+		case RayCastHitType::Entity:
+		{
+			color = Colors::Yellow;
+			break;
+		}
+		}
+
+		DebugNotImplemented();
+		//renderer.drawRect(color, pixel.x, pixel.y, selectionDim, selectionDim);
+	}
+}
+
+// @temp: keep until 3D-DDA ray casting is fully correct (i.e. entire ground is red dots for
+// levels where ceilingScale < 1.0, and same with ceiling blue dots).
+// @todo: As of SDL 2.0.10 which introduced batching, this now behaves like the color is per frame, not per call, which isn't correct, and flushing doesn't help.
+void GameWorldUiView::DEBUG_ColorRaycastPixel(Game &game)
+{
+	const Window &window = game.window;
+	auto &renderer = game.renderer;
+	const int selectionDim = 3;
+	const Int2 windowDims = window.getPixelDimensions();
+
+	constexpr int xOffset = 16;
+	constexpr int yOffset = 16;
+
+	const auto &gameState = game.gameState;
+	if (!gameState.isActiveMapValid())
+	{
+		return;
+	}
+
+	const auto &player = game.player;
+	const CoordDouble3 rayStart = player.getEyeCoord();
+	const Double3 &cameraDirection = player.forward;
+	const double viewAspectRatio = window.getSceneViewAspectRatio();
+
+	const double ceilingScale = gameState.getActiveCeilingScale();
+	SceneManager &sceneManager = game.sceneManager;
 	const VoxelChunkManager &voxelChunkManager = sceneManager.voxelChunkManager;
 	const EntityChunkManager &entityChunkManager = sceneManager.entityChunkManager;
 	const CollisionChunkManager &collisionChunkManager = sceneManager.collisionChunkManager;
 
+	std::vector<Int2> rayPixels;
+	std::vector<RayCastQuery> rayQueries;
 	for (int y = 0; y < windowDims.y; y += yOffset)
 	{
 		for (int x = 0; x < windowDims.x; x += xOffset)
 		{
-			const Double3 rayDirection = GameWorldUiModel::screenToWorldRayDirection(game, Int2(x, y));
+			const Int2 pixel(x, y);
+			const Double3 rayDirection = GameWorldUiModel::screenToWorldRayDirection(game, pixel);
 
 			// Not registering entities with ray cast hits for efficiency since this debug visualization is for voxels.
 			constexpr bool includeEntities = false;
-			RayCastHit hit;
-			const bool success = Physics::rayCast(rayStart, rayDirection, ceilingScale, cameraDirection,
-				includeEntities, voxelChunkManager, entityChunkManager, collisionChunkManager,
-				EntityDefinitionLibrary::getInstance(), hit);
+			RayCastQuery rayQuery;
+			rayQuery.init(rayStart, rayDirection, cameraDirection, includeEntities);
+			rayPixels.emplace_back(pixel);
+			rayQueries.emplace_back(rayQuery);
+		}
+	}
+
+	std::vector<RayCastHit> hits(rayQueries.size());
+	Physics::rayCastBatch(rayQueries, ceilingScale, voxelChunkManager, entityChunkManager, collisionChunkManager,
+		sceneManager.rayCastEntityIndex, hits);
 
+	for (int i = 0; i < static_cast<int>(hits.size()); i++)
+	{
+		const RayCastHit &hit = hits[i];
+		const bool success = hit.t < RayCastHit::NO_HIT_DISTANCE;
+		{
 			if (success)
 			{
 				Color color;
@@ -152,6 +152,12 @@ namespace
 
 		animInst.setStateIndex(defaultStateIndex);
 	}
+
+	WorldDouble3 GetEyePositionFromPhysicsPosition(const WorldDouble3 &physicsPosition)
+	{
+		const double topOfHeadY = physicsPosition.y + (PlayerConstants::TOP_OF_HEAD_HEIGHT * 0.50);
+		return WorldDouble3(physicsPosition.x, topOfHeadY - PlayerConstants::EYE_TO_TOP_OF_HEAD_DISTANCE, physicsPosition.z);
+	}
 }
 
 PlayerGroundState::PlayerGroundState()
@@ -175,6 +181,7 @@ Player::Player()
 {
 	this->physicsCharacter = nullptr;
 	this->physicsCharacterVirtual = nullptr;
+	this->prevPhysicsStepPosition = WorldDouble3::Zero;
 	this->setCameraFrameFromDirection(-Double3::UnitX); // Avoids audio listener issues w/ uninitialized player.
 	this->movementType = PlayerMovementType::Default;
 	this->movementSoundProgress = 0.0;
@@ -442,6 +449,9 @@ void Player::setPhysicsPosition(const WorldDouble3 &position)
 		static_cast<float>(position.z));
 	this->physicsCharacter->SetPosition(physicsPosition);
 	this->physicsCharacterVirtual->SetPosition(physicsPosition);
+
+	// Don't interpolate across a teleport.
+	this->prevPhysicsStepPosition = position;
 }
 
 void Player::setPhysicsPositionRelativeToFeet(const WorldDouble3 &feetPosition)
@@ -477,8 +487,13 @@ void Player::setPhysicsVelocityY(double velocityY)
 WorldDouble3 Player::getEyePosition() const
 {
 	const WorldDouble3 physicsPosition = this->getPhysicsPosition();
-	const double topOfHeadY = physicsPosition.y + (PlayerConstants::TOP_OF_HEAD_HEIGHT * 0.50);
-	return WorldDouble3(physicsPosition.x, topOfHeadY - PlayerConstants::EYE_TO_TOP_OF_HEAD_DISTANCE, physicsPosition.z);
+	return GetEyePositionFromPhysicsPosition(physicsPosition);
+}
+
+WorldDouble3 Player::getInterpolatedEyePosition(double percent) const
+{
+	const WorldDouble3 physicsPosition = this->prevPhysicsStepPosition.lerp(this->getPhysicsPosition(), percent);
+	return GetEyePositionFromPhysicsPosition(physicsPosition);
 }
 
 CoordDouble3 Player::getEyeCoord() const
@@ -738,6 +753,8 @@ void Player::updateGroundState(double dt, Game &game, const JPH::PhysicsSystem &
 
 void Player::prePhysicsStep(double dt, Game &game)
 {
+	this->prevPhysicsStepPosition = this->getPhysicsPosition();
+
 	if (game.options.getMisc_GhostMode())
 	{
 		return;
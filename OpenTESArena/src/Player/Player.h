@@ -84,6 +84,7 @@ struct Player
 	JPH::Character *physicsCharacter;
 	JPH::CharacterVirtual *physicsCharacterVirtual;
 	JPH::CharacterVsCharacterCollisionSimple physicsCharVsCharCollision;
+	WorldDouble3 prevPhysicsStepPosition; // Collider position before the latest physics step, for interpolating the camera.
 
 	// Camera direction
 	Double3 forward;
@@ -159,6 +160,7 @@ struct Player
 	void setPhysicsVelocity(const Double3 &velocity);
 	void setPhysicsVelocityY(double velocityY); // For jumping
 	WorldDouble3 getEyePosition() const;
+	WorldDouble3 getInterpolatedEyePosition(double percent) const; // Between the eye before and after the latest physics step.
 	CoordDouble3 getEyeCoord() const;
 	WorldDouble3 getFeetPosition() const;
 
@@ -1055,7 +1055,7 @@ void PlayerLogic::handleScreenToWorldInteraction(Game &game, const Int2 &nativeP
 	RayCastHit hit;
 	const bool success = Physics::rayCast(rayStart, rayDirection, ceilingScale, cameraDirection,
 		includeEntities, voxelChunkManager, entityChunkManager, collisionChunkManager,
-		EntityDefinitionLibrary::getInstance(), hit);
+		sceneManager.rayCastEntityIndex, hit);
 
 	if (success)
 	{
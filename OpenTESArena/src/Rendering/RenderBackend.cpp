@@ -21,4 +21,8 @@ RendererProfilerData3D::RendererProfilerData3D()
 	this->totalCoverageTests = 0;
 	this->totalDepthTests = 0;
 	this->totalColorWrites = 0;
+	this->totalHiZRejectedTriangles = 0;
+	this->totalHiZRejectedTiles = 0;
+	this->geometryTriangleCount = 0;
+	this->geometrySeconds = 0.0;
 }
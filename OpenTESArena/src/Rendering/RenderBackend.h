@@ -4,6 +4,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <optional>
+#include <vector>
 
 #include "RenderMaterialUtils.h"
 #include "RenderMeshUtils.h"
@@ -46,6 +47,12 @@ struct RendererProfilerData3D
 	int64_t totalCoverageTests;
 	int64_t totalDepthTests;
 	int64_t totalColorWrites;
+	int64_t totalHiZRejectedTriangles; // Culled by coarse depth before any per-pixel work.
+	int64_t totalHiZRejectedTiles;
+	int64_t geometryTriangleCount; // Triangles sent through vertex shading and clipping.
+	double geometrySeconds; // Summed over all render threads.
+	std::vector<double> threadBusySeconds; // Per render thread, time spent working this frame.
+	std::vector<double> threadIdleSeconds; // Per render thread, time spent waiting on other threads this frame.
 
 	RendererProfilerData3D();
 };
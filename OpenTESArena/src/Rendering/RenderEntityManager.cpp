@@ -417,8 +417,7 @@ void RenderEntityManager::loadScene(TextureManager &textureManager, Renderer &re
 	for (int i = 0; i < entityDefLibrary.getDefinitionCount(); i++)
 	{
 		const EntityDefID entityDefID = static_cast<EntityDefID>(i);
-		const EntityDefinition &entityDef = entityDefLibrary.getDefinition(entityDefID);
-		if (!EntityUtils::isSceneManagedResource(entityDef.type))
+		if (!EntityUtils::isSceneManagedResource(entityDefLibrary.getDefinitionType(entityDefID)))
 		{
 			this->loadMaterialsForEntity(entityDefID, textureManager, renderer);
 		}
@@ -13,11 +13,12 @@ RenderFrameSettings::RenderFrameSettings()
 	this->skyBgTextureID = -1;
 	this->renderThreadsMode = -1;
 	this->ditheringMode = static_cast<DitheringMode>(-1);
+	this->enablePipelining = false;
 }
 
 void RenderFrameSettings::init(Color clearColor, double ambientPercent, UniformBufferID visibleLightsBufferID, int visibleLightCount,
 	double screenSpaceAnimPercent, ObjectTextureID paletteTextureID, ObjectTextureID lightTableTextureID, ObjectTextureID ditherTextureID,
-	ObjectTextureID skyBgTextureID, int renderThreadsMode, DitheringMode ditheringMode)
+	ObjectTextureID skyBgTextureID, int renderThreadsMode, DitheringMode ditheringMode, bool enablePipelining)
 {
 	this->clearColor = clearColor;
 	this->ambientPercent = ambientPercent;
@@ -30,4 +31,5 @@ void RenderFrameSettings::init(Color clearColor, double ambientPercent, UniformB
 	this->skyBgTextureID = skyBgTextureID;
 	this->renderThreadsMode = renderThreadsMode;
 	this->ditheringMode = ditheringMode;
+	this->enablePipelining = enablePipelining;
 }
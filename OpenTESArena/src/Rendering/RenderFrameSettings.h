@@ -21,12 +21,14 @@ struct RenderFrameSettings
 	ObjectTextureID paletteTextureID, lightTableTextureID, ditherTextureID, skyBgTextureID;
 	int renderThreadsMode;
 	DitheringMode ditheringMode;
+	bool enablePipelining; // Rasterize on a background thread while the next frame is simulated (software renderer only).
 
 	RenderFrameSettings();
 
 	void init(Color clearColor, double ambientPercent, UniformBufferID visibleLightsBufferID, int visibleLightCount, 
 		double screenSpaceAnimPercent, ObjectTextureID paletteTextureID, ObjectTextureID lightTableTextureID,
-		ObjectTextureID ditherTextureID, ObjectTextureID skyBgTextureID, int renderThreadsMode, DitheringMode ditheringMode);
+		ObjectTextureID ditherTextureID, ObjectTextureID skyBgTextureID, int renderThreadsMode, DitheringMode ditheringMode,
+		bool enablePipelining);
 };
 
 #endif
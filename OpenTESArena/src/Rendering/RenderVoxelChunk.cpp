@@ -7,6 +7,41 @@
 RenderVoxelCombinedFaceDrawCallEntry::RenderVoxelCombinedFaceDrawCallEntry()
 {
 	this->transformIndex = -1;
+	this->vertexBufferIndex = -1;
+	this->isBatched = false;
+}
+
+RenderVoxelCombinedFaceBatch::RenderVoxelCombinedFaceBatch()
+{
+	this->regionIndex = -1;
+	this->touchedRegionMask = 0;
+}
+
+void RenderVoxelCombinedFaceBatch::freeBuffers(Renderer &renderer)
+{
+	if (this->drawCall.positionBufferID >= 0)
+	{
+		renderer.freeVertexPositionBuffer(this->drawCall.positionBufferID);
+		this->drawCall.positionBufferID = -1;
+	}
+
+	if (this->drawCall.normalBufferID >= 0)
+	{
+		renderer.freeVertexAttributeBuffer(this->drawCall.normalBufferID);
+		this->drawCall.normalBufferID = -1;
+	}
+
+	if (this->drawCall.texCoordBufferID >= 0)
+	{
+		renderer.freeVertexAttributeBuffer(this->drawCall.texCoordBufferID);
+		this->drawCall.texCoordBufferID = -1;
+	}
+
+	if (this->drawCall.indexBufferID >= 0)
+	{
+		renderer.freeIndexBuffer(this->drawCall.indexBufferID);
+		this->drawCall.indexBufferID = -1;
+	}
 }
 
 RenderVoxelNonCombinedDrawCallEntry::RenderVoxelNonCombinedDrawCallEntry()
@@ -26,6 +61,9 @@ void RenderVoxelChunk::init(const ChunkInt2 &position, int height)
 {
 	Chunk::init(position, height);
 
+	this->combinedFaceBatchTransformIndex = -1;
+	this->dirtyCombinedFaceBatchRegions = 0;
+
 	this->meshInstMappings.emplace(VoxelChunk::AIR_SHAPE_DEF_ID, RenderVoxelChunk::AIR_MESH_INST_ID);
 
 	// Add empty mesh instance for air.
@@ -78,6 +116,11 @@ void RenderVoxelChunk::freeBuffers(Renderer &renderer)
 		meshInst.freeBuffers(renderer);
 	}
 
+	for (RenderVoxelCombinedFaceBatch &batch : this->combinedFaceBatches)
+	{
+		batch.freeBuffers(renderer);
+	}
+
 	for (RenderVoxelNonCombinedDrawCallEntry &entry : this->nonCombinedDrawCallEntries)
 	{
 		renderer.freeUniformBuffer(entry.transformBufferID);
@@ -115,6 +158,9 @@ void RenderVoxelChunk::clear()
 	this->meshInsts.clear();
 	this->meshInstMappings.clear();
 	this->combinedFaceDrawCallEntries.clear();
+	this->combinedFaceBatches.clear();
+	this->combinedFaceBatchTransformIndex = -1;
+	this->dirtyCombinedFaceBatchRegions = 0;
 	this->nonCombinedDrawCallEntries.clear();
 	this->doorDrawCallsEntries.clear();
 	this->doorMaterialInstEntries.clear();
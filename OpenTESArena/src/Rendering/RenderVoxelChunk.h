@@ -1,6 +1,7 @@
 #ifndef RENDER_VOXEL_CHUNK_H
 #define RENDER_VOXEL_CHUNK_H
 
+#include <cstdint>
 #include <unordered_map>
 #include <vector>
 
@@ -20,12 +21,27 @@ class Renderer;
 struct RenderVoxelCombinedFaceDrawCallEntry
 {
 	VoxelInt3 min, max;
-	int transformIndex; // Allocated from transform heap, points to model matrix.
+	int transformIndex; // Allocated from transform heap, points to model matrix. -1 if batched.
+	int vertexBufferIndex; // Model space quad shared with other combined faces of the same size.
+	bool isBatched; // Drawn by a combined face batch instead of its own draw call.
 	RenderDrawCall drawCall;
 
 	RenderVoxelCombinedFaceDrawCallEntry();
 };
 
+// Combined faces in one region of a chunk that share a material, pre-transformed into chunk space so they
+// are drawn with one draw call. Owns its vertex and index buffers.
+struct RenderVoxelCombinedFaceBatch
+{
+	int regionIndex; // Region containing the min voxel of every batched face.
+	uint32_t touchedRegionMask; // Bit per region any batched face overlaps, for frustum culling.
+	RenderDrawCall drawCall;
+
+	RenderVoxelCombinedFaceBatch();
+
+	void freeBuffers(Renderer &renderer);
+};
+
 struct RenderVoxelNonCombinedDrawCallEntry
 {
 	VoxelInt3 voxel;
@@ -69,6 +85,10 @@ struct RenderVoxelChunk final : public Chunk
 	// - RecyclablePool::emplace() would check that the given key is not used
 	std::unordered_map<VoxelFaceCombineResultID, RenderVoxelCombinedFaceDrawCallEntry> combinedFaceDrawCallEntries;
 
+	std::vector<RenderVoxelCombinedFaceBatch> combinedFaceBatches;
+	int combinedFaceBatchTransformIndex; // Chunk origin, shared by all combined face batches.
+	uint32_t dirtyCombinedFaceBatchRegions; // Bit per region whose batches need rebuilding.
+
 	std::vector<RenderVoxelNonCombinedDrawCallEntry> nonCombinedDrawCallEntries; // One draw call + transform per non-combined voxel. Owned by this chunk.
 	std::vector<RenderVoxelDoorDrawCallsEntry> doorDrawCallsEntries; // Draw calls + transforms for door voxel. Owned by this chunk.
 	
@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <bit>
 #include <numeric>
 #include <optional>
 
@@ -280,6 +281,53 @@ namespace
 			static_cast<WEDouble>(worldVoxel.z));
 	}
 
+	// Combined face batches are split by the quadtree nodes on this frustum culling level so they can still be culled.
+	constexpr int COMBINED_FACE_BATCH_TREE_LEVEL_INDEX = 2;
+	constexpr int COMBINED_FACE_BATCH_REGIONS_PER_SIDE = VoxelFrustumCullingChunk::NODES_PER_SIDE[COMBINED_FACE_BATCH_TREE_LEVEL_INDEX];
+	constexpr int COMBINED_FACE_BATCH_REGION_SIZE = Chunk::WIDTH / COMBINED_FACE_BATCH_REGIONS_PER_SIDE;
+	static_assert((COMBINED_FACE_BATCH_REGIONS_PER_SIDE * COMBINED_FACE_BATCH_REGIONS_PER_SIDE) <= 32);
+
+	// Keeps a batch under the software renderer's triangle limit for one draw call mesh.
+	constexpr int MAX_COMBINED_FACE_BATCH_QUADS = 512;
+
+	int GetCombinedFaceBatchRegionIndex(const VoxelInt3 &voxel)
+	{
+		const int regionX = voxel.x / COMBINED_FACE_BATCH_REGION_SIZE;
+		const int regionZ = voxel.z / COMBINED_FACE_BATCH_REGION_SIZE;
+		return regionX + (regionZ * COMBINED_FACE_BATCH_REGIONS_PER_SIDE);
+	}
+
+	uint32_t GetCombinedFaceBatchRegionMask(const VoxelInt3 &minVoxel, const VoxelInt3 &maxVoxel)
+	{
+		uint32_t mask = 0;
+		for (int regionZ = minVoxel.z / COMBINED_FACE_BATCH_REGION_SIZE; regionZ <= (maxVoxel.z / COMBINED_FACE_BATCH_REGION_SIZE); regionZ++)
+		{
+			for (int regionX = minVoxel.x / COMBINED_FACE_BATCH_REGION_SIZE; regionX <= (maxVoxel.x / COMBINED_FACE_BATCH_REGION_SIZE); regionX++)
+			{
+				mask |= 1u << (regionX + (regionZ * COMBINED_FACE_BATCH_REGIONS_PER_SIDE));
+			}
+		}
+
+		return mask;
+	}
+
+	bool IsCombinedFaceBatchVisible(const RenderVoxelCombinedFaceBatch &batch, const VoxelFrustumCullingChunk &voxelFrustumCullingChunk)
+	{
+		const int globalNodeOffset = VoxelFrustumCullingChunk::GLOBAL_NODE_OFFSETS[COMBINED_FACE_BATCH_TREE_LEVEL_INDEX];
+		for (uint32_t mask = batch.touchedRegionMask; mask != 0; mask &= mask - 1)
+		{
+			const int regionIndex = std::countr_zero(mask);
+			const int globalNodeIndex = globalNodeOffset + regionIndex;
+			DebugAssertIndex(voxelFrustumCullingChunk.internalNodeVisibilityTypes, globalNodeIndex);
+			if (voxelFrustumCullingChunk.internalNodeVisibilityTypes[globalNodeIndex] != VisibilityType::Outside)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
 	Matrix4d MakeDoorFaceModelMatrix(ArenaDoorType doorType, int doorFaceIndex, WorldDouble3 meshPosition, WorldDouble3 floatingOriginPoint,
 		double ceilingScale, double animPercent)
 	{
@@ -596,17 +644,6 @@ void RenderVoxelChunkManager::updateChunkCombinedVoxelDrawCalls(RenderVoxelChunk
 		const VoxelInt3 maxVoxel = faceCombineResult.max;
 		const VoxelFacing3D facing = faceCombineResult.facing;
 
-		int transformIndex = renderChunk.transformHeap.alloc();
-		if (transformIndex < 0)
-		{
-			DebugLogErrorFormat("Couldn't allocate combined face transform starting at (%s) in chunk (%s).", minVoxel.toString().c_str(), chunkPos.toString().c_str());
-		}
-
-		const WorldDouble3 meshPosition = MakeVoxelMeshPosition(chunkPos, minVoxel, ceilingScale);
-		const WorldDouble3 floatingMeshPosition = meshPosition - floatingOriginPoint;
-		Matrix4d &modelMatrix = renderChunk.transformHeap.pool.values[transformIndex];
-		modelMatrix = Matrix4d::translation(floatingMeshPosition.x, floatingMeshPosition.y, floatingMeshPosition.z);
-
 		const VoxelTraitsDefID traitsDefID = voxelChunk.traitsDefIDs.get(minVoxel.x, minVoxel.y, minVoxel.z);
 		const VoxelTraitsDefinition &traitsDef = voxelChunk.traitsDefs[traitsDefID];
 		const ArenaVoxelType voxelType = traitsDef.type;
@@ -630,14 +667,17 @@ void RenderVoxelChunkManager::updateChunkCombinedVoxelDrawCalls(RenderVoxelChunk
 		});
 
 		RenderVoxelCombinedFaceVertexBuffer *combinedFaceVertexBuffer = nullptr;
+		int combinedFaceVertexBufferIndex = -1;
 		if (vertexBufferIter != this->combinedFaceVertexBuffers.end())
 		{
 			combinedFaceVertexBuffer = &(*vertexBufferIter);
+			combinedFaceVertexBufferIndex = static_cast<int>(std::distance(this->combinedFaceVertexBuffers.begin(), vertexBufferIter));
 		}
 		else
 		{
 			this->combinedFaceVertexBuffers.emplace_back(std::move(RenderVoxelCombinedFaceVertexBuffer()));
 			combinedFaceVertexBuffer = &this->combinedFaceVertexBuffers.back();
+			combinedFaceVertexBufferIndex = static_cast<int>(this->combinedFaceVertexBuffers.size()) - 1;
 
 			const int faceIndexBufferIndex = meshDef.findIndexBufferIndexWithFacing(facing);
 			DebugAssert(faceIndexBufferIndex >= 0);
@@ -713,6 +753,10 @@ void RenderVoxelChunkManager::updateChunkCombinedVoxelDrawCalls(RenderVoxelChunk
 			renderer.populateVertexPositionBuffer(combinedFaceVertexBuffer->positionBufferID, quadVertexPositions);
 			renderer.populateVertexAttributeBuffer(combinedFaceVertexBuffer->normalBufferID, quadVertexNormals);
 			renderer.populateVertexAttributeBuffer(combinedFaceVertexBuffer->texCoordBufferID, quadVertexTexCoords);
+
+			std::copy(std::begin(quadVertexPositions), std::end(quadVertexPositions), std::begin(combinedFaceVertexBuffer->positions));
+			std::copy(std::begin(quadVertexNormals), std::end(quadVertexNormals), std::begin(combinedFaceVertexBuffer->normals));
+			std::copy(std::begin(quadVertexTexCoords), std::end(quadVertexTexCoords), std::begin(combinedFaceVertexBuffer->texCoords));
 		}
 
 		VoxelChasmDefID chasmDefID;
@@ -826,10 +870,34 @@ void RenderVoxelChunkManager::updateChunkCombinedVoxelDrawCalls(RenderVoxelChunk
 			}
 		}
 
+		// Faces with their own material instance (i.e. fading) can't share a draw call.
+		const bool isBatched = (materialInstID < 0) || (materialInstID == this->lavaChasmMaterialInstID);
+
+		int transformIndex = -1;
+		if (isBatched)
+		{
+			renderChunk.dirtyCombinedFaceBatchRegions |= 1u << GetCombinedFaceBatchRegionIndex(minVoxel);
+		}
+		else
+		{
+			transformIndex = renderChunk.transformHeap.alloc();
+			if (transformIndex < 0)
+			{
+				DebugLogErrorFormat("Couldn't allocate combined face transform starting at (%s) in chunk (%s).", minVoxel.toString().c_str(), chunkPos.toString().c_str());
+			}
+
+			const WorldDouble3 meshPosition = MakeVoxelMeshPosition(chunkPos, minVoxel, ceilingScale);
+			const WorldDouble3 floatingMeshPosition = meshPosition - floatingOriginPoint;
+			Matrix4d &modelMatrix = renderChunk.transformHeap.pool.values[transformIndex];
+			modelMatrix = Matrix4d::translation(floatingMeshPosition.x, floatingMeshPosition.y, floatingMeshPosition.z);
+		}
+
 		RenderVoxelCombinedFaceDrawCallEntry combinedFaceDrawCallEntry;
 		combinedFaceDrawCallEntry.min = minVoxel;
 		combinedFaceDrawCallEntry.max = maxVoxel;
 		combinedFaceDrawCallEntry.transformIndex = transformIndex;
+		combinedFaceDrawCallEntry.vertexBufferIndex = combinedFaceVertexBufferIndex;
+		combinedFaceDrawCallEntry.isBatched = isBatched;
 
 		RenderDrawCall &drawCall = combinedFaceDrawCallEntry.drawCall;
 		drawCall.transformBufferID = transformBufferID;
@@ -1275,7 +1343,14 @@ void RenderVoxelChunkManager::clearChunkCombinedVoxelDrawCalls(RenderVoxelChunk
 		}
 
 		RenderVoxelCombinedFaceDrawCallEntry &drawCallEntry = iter->second;
-		renderChunk.transformHeap.free(drawCallEntry.transformIndex);
+		if (drawCallEntry.isBatched)
+		{
+			renderChunk.dirtyCombinedFaceBatchRegions |= 1u << GetCombinedFaceBatchRegionIndex(drawCallEntry.min);
+		}
+		else
+		{
+			renderChunk.transformHeap.free(drawCallEntry.transformIndex);
+		}
 
 		drawCallEntriesPool.erase(iter);
 	}
@@ -1307,6 +1382,167 @@ void RenderVoxelChunkManager::clearChunkNonCombinedVoxelDrawCalls(RenderVoxelChu
 	}
 }
 
+void RenderVoxelChunkManager::updateChunkCombinedFaceBatches(RenderVoxelChunk &renderChunk, double ceilingScale, Renderer &renderer)
+{
+	const uint32_t dirtyRegions = renderChunk.dirtyCombinedFaceBatchRegions;
+	if (dirtyRegions == 0)
+	{
+		return;
+	}
+
+	std::vector<RenderVoxelCombinedFaceBatch> &batches = renderChunk.combinedFaceBatches;
+	for (int i = static_cast<int>(batches.size()) - 1; i >= 0; i--)
+	{
+		RenderVoxelCombinedFaceBatch &batch = batches[i];
+		if ((dirtyRegions & (1u << batch.regionIndex)) != 0)
+		{
+			batch.freeBuffers(renderer);
+			batches.erase(batches.begin() + i);
+		}
+	}
+
+	std::vector<const RenderVoxelCombinedFaceDrawCallEntry*> &entries = this->combinedFaceBatchEntriesCache;
+	entries.clear();
+	for (const std::pair<const VoxelFaceCombineResultID, RenderVoxelCombinedFaceDrawCallEntry> &pair : renderChunk.combinedFaceDrawCallEntries)
+	{
+		const RenderVoxelCombinedFaceDrawCallEntry &entry = pair.second;
+		if (entry.isBatched && ((dirtyRegions & (1u << GetCombinedFaceBatchRegionIndex(entry.min))) != 0))
+		{
+			entries.emplace_back(&entry);
+		}
+	}
+
+	// Group by region then material so each run becomes one batch.
+	std::sort(entries.begin(), entries.end(),
+		[](const RenderVoxelCombinedFaceDrawCallEntry *a, const RenderVoxelCombinedFaceDrawCallEntry *b)
+	{
+		const int aRegionIndex = GetCombinedFaceBatchRegionIndex(a->min);
+		const int bRegionIndex = GetCombinedFaceBatchRegionIndex(b->min);
+		if (aRegionIndex != bRegionIndex)
+		{
+			return aRegionIndex < bRegionIndex;
+		}
+
+		if (a->drawCall.materialID != b->drawCall.materialID)
+		{
+			return a->drawCall.materialID < b->drawCall.materialID;
+		}
+
+		return a->drawCall.materialInstID < b->drawCall.materialInstID;
+	});
+
+	const int entryCount = static_cast<int>(entries.size());
+	int startIndex = 0;
+	while (startIndex < entryCount)
+	{
+		const RenderVoxelCombinedFaceDrawCallEntry &firstEntry = *entries[startIndex];
+		const int regionIndex = GetCombinedFaceBatchRegionIndex(firstEntry.min);
+
+		int endIndex = startIndex + 1;
+		while ((endIndex < entryCount) && ((endIndex - startIndex) < MAX_COMBINED_FACE_BATCH_QUADS))
+		{
+			const RenderVoxelCombinedFaceDrawCallEntry &entry = *entries[endIndex];
+			const bool isSameBatch = (GetCombinedFaceBatchRegionIndex(entry.min) == regionIndex) &&
+				(entry.drawCall.materialID == firstEntry.drawCall.materialID) &&
+				(entry.drawCall.materialInstID == firstEntry.drawCall.materialInstID);
+			if (!isSameBatch)
+			{
+				break;
+			}
+
+			endIndex++;
+		}
+
+		this->addCombinedFaceBatch(renderChunk, Span<const RenderVoxelCombinedFaceDrawCallEntry* const>(entries.data() + startIndex, endIndex - startIndex),
+			ceilingScale, renderer);
+		startIndex = endIndex;
+	}
+
+	renderChunk.dirtyCombinedFaceBatchRegions = 0;
+}
+
+void RenderVoxelChunkManager::addCombinedFaceBatch(RenderVoxelChunk &renderChunk, Span<const RenderVoxelCombinedFaceDrawCallEntry* const> entries,
+	double ceilingScale, Renderer &renderer)
+{
+	DebugAssert(entries.getCount() > 0);
+	const ChunkInt2 chunkPos = renderChunk.position;
+	const RenderDrawCall &firstDrawCall = entries[0]->drawCall;
+
+	constexpr int verticesPerQuad = MeshUtils::VERTICES_PER_QUAD;
+	constexpr int indicesPerQuad = MeshUtils::INDICES_PER_QUAD;
+	const int quadCount = entries.getCount();
+	const int vertexCount = quadCount * verticesPerQuad;
+	const int indexCount = quadCount * indicesPerQuad;
+
+	std::vector<double> &positions = this->combinedFaceBatchPositionsCache;
+	std::vector<double> &normals = this->combinedFaceBatchNormalsCache;
+	std::vector<double> &texCoords = this->combinedFaceBatchTexCoordsCache;
+	std::vector<int32_t> &indices = this->combinedFaceBatchIndicesCache;
+	positions.resize(vertexCount * MeshUtils::POSITION_COMPONENTS_PER_VERTEX);
+	normals.resize(vertexCount * MeshUtils::NORMAL_COMPONENTS_PER_VERTEX);
+	texCoords.resize(vertexCount * MeshUtils::TEX_COORD_COMPONENTS_PER_VERTEX);
+	indices.resize(indexCount);
+
+	RenderVoxelCombinedFaceBatch batch;
+	batch.regionIndex = GetCombinedFaceBatchRegionIndex(entries[0]->min);
+
+	for (int quadIndex = 0; quadIndex < quadCount; quadIndex++)
+	{
+		const RenderVoxelCombinedFaceDrawCallEntry &entry = *entries[quadIndex];
+		DebugAssertIndex(this->combinedFaceVertexBuffers, entry.vertexBufferIndex);
+		const RenderVoxelCombinedFaceVertexBuffer &vertexBuffer = this->combinedFaceVertexBuffers[entry.vertexBufferIndex];
+		batch.touchedRegionMask |= GetCombinedFaceBatchRegionMask(entry.min, entry.max);
+
+		// Model space quad moved to its voxel in chunk space.
+		const double offsetX = static_cast<double>(entry.min.x);
+		const double offsetY = static_cast<double>(entry.min.y) * ceilingScale;
+		const double offsetZ = static_cast<double>(entry.min.z);
+		for (int vertexIndex = 0; vertexIndex < verticesPerQuad; vertexIndex++)
+		{
+			const int srcPositionIndex = vertexIndex * MeshUtils::POSITION_COMPONENTS_PER_VERTEX;
+			const int dstPositionIndex = ((quadIndex * verticesPerQuad) + vertexIndex) * MeshUtils::POSITION_COMPONENTS_PER_VERTEX;
+			positions[dstPositionIndex] = vertexBuffer.positions[srcPositionIndex] + offsetX;
+			positions[dstPositionIndex + 1] = vertexBuffer.positions[srcPositionIndex + 1] + offsetY;
+			positions[dstPositionIndex + 2] = vertexBuffer.positions[srcPositionIndex + 2] + offsetZ;
+		}
+
+		std::copy(std::begin(vertexBuffer.normals), std::end(vertexBuffer.normals),
+			normals.begin() + (quadIndex * verticesPerQuad * MeshUtils::NORMAL_COMPONENTS_PER_VERTEX));
+		std::copy(std::begin(vertexBuffer.texCoords), std::end(vertexBuffer.texCoords),
+			texCoords.begin() + (quadIndex * verticesPerQuad * MeshUtils::TEX_COORD_COMPONENTS_PER_VERTEX));
+
+		for (int i = 0; i < indicesPerQuad; i++)
+		{
+			indices[(quadIndex * indicesPerQuad) + i] = MeshUtils::DefaultQuadVertexIndices[i] + (quadIndex * verticesPerQuad);
+		}
+	}
+
+	RenderDrawCall &drawCall = batch.drawCall;
+	drawCall.transformBufferID = renderChunk.transformHeap.uniformBufferID;
+	drawCall.transformIndex = renderChunk.combinedFaceBatchTransformIndex;
+	drawCall.positionBufferID = renderer.createVertexPositionBuffer(vertexCount, MeshUtils::POSITION_COMPONENTS_PER_VERTEX);
+	drawCall.normalBufferID = renderer.createVertexAttributeBuffer(vertexCount, MeshUtils::NORMAL_COMPONENTS_PER_VERTEX);
+	drawCall.texCoordBufferID = renderer.createVertexAttributeBuffer(vertexCount, MeshUtils::TEX_COORD_COMPONENTS_PER_VERTEX);
+	drawCall.indexBufferID = renderer.createIndexBuffer(indexCount);
+	drawCall.materialID = firstDrawCall.materialID;
+	drawCall.materialInstID = firstDrawCall.materialInstID;
+	drawCall.multipassType = RenderMultipassType::None;
+
+	if ((drawCall.positionBufferID < 0) || (drawCall.normalBufferID < 0) || (drawCall.texCoordBufferID < 0) || (drawCall.indexBufferID < 0))
+	{
+		DebugLogErrorFormat("Couldn't allocate combined face batch buffers for %d quad(s) in chunk (%s).", quadCount, chunkPos.toString().c_str());
+		batch.freeBuffers(renderer);
+		return;
+	}
+
+	renderer.populateVertexPositionBuffer(drawCall.positionBufferID, positions);
+	renderer.populateVertexAttributeBuffer(drawCall.normalBufferID, normals);
+	renderer.populateVertexAttributeBuffer(drawCall.texCoordBufferID, texCoords);
+	renderer.populateIndexBuffer(drawCall.indexBufferID, indices);
+
+	renderChunk.combinedFaceBatches.emplace_back(std::move(batch));
+}
+
 void RenderVoxelChunkManager::rebuildDrawCallsList(const VoxelFrustumCullingChunkManager &voxelFrustumCullingChunkManager)
 {
 	this->drawCallsCache.clear();
@@ -1324,9 +1560,21 @@ void RenderVoxelChunkManager::rebuildDrawCallsList(const VoxelFrustumCullingChun
 		}
 
 		// Add draw calls that are at least partially in the camera frustum.
+		for (const RenderVoxelCombinedFaceBatch &batch : renderChunk.combinedFaceBatches)
+		{
+			if (IsCombinedFaceBatchVisible(batch, voxelFrustumCullingChunk))
+			{
+				this->drawCallsCache.emplace_back(batch.drawCall);
+			}
+		}
+
 		for (const std::pair<VoxelFaceCombineResultID, RenderVoxelCombinedFaceDrawCallEntry> &pair : renderChunk.combinedFaceDrawCallEntries)
 		{
 			const RenderVoxelCombinedFaceDrawCallEntry &combinedFaceDrawCallEntry = pair.second;
+			if (combinedFaceDrawCallEntry.isBatched)
+			{
+				continue;
+			}
 
 			bool isCombinedFaceVisible = false;
 			for (WEInt z = combinedFaceDrawCallEntry.min.z; z <= combinedFaceDrawCallEntry.max.z; z++)
@@ -1411,14 +1659,14 @@ void RenderVoxelChunkManager::updateActiveChunks(Span<const ChunkInt2> newChunkP
 	{
 		const VoxelChunk &voxelChunk = voxelChunkManager.getChunkAtPosition(chunkPos);
 
-		const int spawnIndex = this->spawnChunk();
+		const int spawnIndex = this->spawnChunk(chunkPos);
 		RenderVoxelChunk &renderChunk = this->getChunkAtIndex(spawnIndex);
 		renderChunk.init(chunkPos, voxelChunk.height);
 	}
 
-	// Free any unneeded chunks for memory savings in case the chunk distance was once large
-	// and is now small. This is significant even for chunk distance 2->1, or 25->9 chunks.
-	this->chunkPool.clear();
+	// Keep recycled chunks warm for the next chunk border crossing, only freeing the excess in case the
+	// chunk distance was once large and is now small. This is significant even for chunk distance 2->1.
+	this->trimChunkPool();
 }
 
 void RenderVoxelChunkManager::update(Span<const ChunkInt2> activeChunkPositions, Span<const ChunkInt2> newChunkPositions,
@@ -1439,6 +1687,14 @@ void RenderVoxelChunkManager::update(Span<const ChunkInt2> activeChunkPositions,
 		{
 			DebugLogErrorFormat("Couldn't create model matrix uniform buffer ID for chunk (%s).", chunkPos.toString().c_str());
 		}
+
+		renderChunk.combinedFaceBatchTransformIndex = renderChunk.transformHeap.alloc();
+		if (renderChunk.combinedFaceBatchTransformIndex >= 0)
+		{
+			const WorldDouble3 floatingChunkPosition = MakeVoxelMeshPosition(chunkPos, VoxelInt3::Zero, ceilingScale) - floatingOriginPoint;
+			Matrix4d &modelMatrix = renderChunk.transformHeap.pool.values[renderChunk.combinedFaceBatchTransformIndex];
+			modelMatrix = Matrix4d::translation(floatingChunkPosition.x, floatingChunkPosition.y, floatingChunkPosition.z);
+		}
 	}
 
 	for (const ChunkInt2 chunkPos : activeChunkPositions)
@@ -1460,9 +1716,21 @@ void RenderVoxelChunkManager::update(Span<const ChunkInt2> activeChunkPositions,
 		if (isFloatingOriginChanged)
 		{
 			// Need to refresh all voxel transforms when floating origin changes.
+			if (renderChunk.combinedFaceBatchTransformIndex >= 0)
+			{
+				const WorldDouble3 floatingChunkPosition = MakeVoxelMeshPosition(chunkPos, VoxelInt3::Zero, ceilingScale) - floatingOriginPoint;
+				Matrix4d &modelMatrix = transformHeap.pool.values[renderChunk.combinedFaceBatchTransformIndex];
+				modelMatrix = Matrix4d::translation(floatingChunkPosition.x, floatingChunkPosition.y, floatingChunkPosition.z);
+			}
+
 			for (const auto &pair : renderChunk.combinedFaceDrawCallEntries)
 			{
 				const RenderVoxelCombinedFaceDrawCallEntry &entry = pair.second;
+				if (entry.isBatched)
+				{
+					continue;
+				}
+
 				const WorldDouble3 meshPosition = MakeVoxelMeshPosition(chunkPos, entry.min, ceilingScale);
 				const WorldDouble3 floatingMeshPosition = meshPosition - floatingOriginPoint;
 				Matrix4d &modelMatrix = transformHeap.pool.values[entry.transformIndex];
@@ -1566,6 +1834,8 @@ void RenderVoxelChunkManager::update(Span<const ChunkInt2> activeChunkPositions,
 		this->updateChunkDoorVoxelDrawCalls(renderChunk, dirtyDoorAnimInstVoxels, floatingOriginPoint, voxelChunk, voxelChunkManager, ceilingScale, renderer);
 		this->updateChunkDoorVoxelDrawCalls(renderChunk, dirtyDoorVisInstVoxels, floatingOriginPoint, voxelChunk, voxelChunkManager, ceilingScale, renderer);
 
+		this->updateChunkCombinedFaceBatches(renderChunk, ceilingScale, renderer);
+
 		Span<const Matrix4d> chunkModelMatrices(transformHeap.pool.values.get(), transformHeap.pool.capacity);
 		renderer.populateUniformBufferMatrix4s(transformHeap.uniformBufferID, chunkModelMatrices);
 	}
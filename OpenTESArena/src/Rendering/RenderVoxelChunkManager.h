@@ -10,6 +10,7 @@
 #include "RenderShaderUtils.h"
 #include "RenderVoxelChunk.h"
 #include "../Voxels/VoxelChasmDefinition.h"
+#include "../World/MeshUtils.h"
 #include "../World/SpecializedChunkManager.h"
 
 #include "components/utilities/Buffer.h"
@@ -72,6 +73,11 @@ struct RenderVoxelCombinedFaceVertexBuffer
 	VertexAttributeBufferID normalBufferID;
 	VertexAttributeBufferID texCoordBufferID;
 
+	// Copies of the quad's vertices for building combined face batches.
+	double positions[MeshUtils::VERTICES_PER_QUAD * MeshUtils::POSITION_COMPONENTS_PER_VERTEX];
+	double normals[MeshUtils::VERTICES_PER_QUAD * MeshUtils::NORMAL_COMPONENTS_PER_VERTEX];
+	double texCoords[MeshUtils::VERTICES_PER_QUAD * MeshUtils::TEX_COORD_COMPONENTS_PER_VERTEX];
+
 	RenderVoxelCombinedFaceVertexBuffer();
 };
 
@@ -96,6 +102,11 @@ private:
 	// All accumulated draw calls from scene components each frame. This is sent to the renderer.
 	std::vector<RenderDrawCall> drawCallsCache;
 
+	// Scratch space for rebuilding combined face batches.
+	std::vector<const RenderVoxelCombinedFaceDrawCallEntry*> combinedFaceBatchEntriesCache;
+	std::vector<double> combinedFaceBatchPositionsCache, combinedFaceBatchNormalsCache, combinedFaceBatchTexCoordsCache;
+	std::vector<int32_t> combinedFaceBatchIndicesCache;
+
 	ObjectTextureID getTextureID(const TextureAsset &textureAsset) const;
 	ObjectTextureID getChasmFloorTextureID(VoxelChasmDefID chasmDefID) const;
 	ObjectTextureID getChasmWallTextureID(VoxelChasmDefID chasmDefID) const;
@@ -112,6 +123,11 @@ private:
 		const VoxelChunk &voxelChunk, const VoxelChunkManager &voxelChunkManager, double ceilingScale, Renderer &renderer);
 
 	void clearChunkCombinedVoxelDrawCalls(RenderVoxelChunk &renderChunk, Span<const VoxelFaceCombineResultID> dirtyFaceCombineResultIDs);
+
+	// Merges batchable combined faces in dirty regions of the chunk into one draw call per material.
+	void updateChunkCombinedFaceBatches(RenderVoxelChunk &renderChunk, double ceilingScale, Renderer &renderer);
+	void addCombinedFaceBatch(RenderVoxelChunk &renderChunk, Span<const RenderVoxelCombinedFaceDrawCallEntry* const> entries,
+		double ceilingScale, Renderer &renderer);
 	void clearChunkNonCombinedVoxelDrawCalls(RenderVoxelChunk &renderChunk, Span<const VoxelInt3> dirtyVoxelPositions, Renderer &renderer);
 
 	void rebuildDrawCallsList(const VoxelFrustumCullingChunkManager &voxelFrustumCullingChunkManager);
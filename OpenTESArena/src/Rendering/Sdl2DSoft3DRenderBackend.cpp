@@ -444,7 +444,18 @@ void Sdl2DSoft3DRenderBackend::submitFrame(const RenderCommandList &renderComman
 			return;
 		}
 
-		this->renderer3D.submitFrame(renderCommandList, camera, frameSettings, outputBuffer);
+		bool hasGameWorldImage = true;
+		if (frameSettings.enablePipelining)
+		{
+			// Present the previous scene frame and let this one rasterize while the next frame is simulated.
+			hasGameWorldImage = this->renderer3D.tryCopyPipelinedFrame(outputBuffer);
+			this->renderer3D.submitFramePipelined(renderCommandList, camera, frameSettings);
+		}
+		else
+		{
+			this->renderer3D.submitFrame(renderCommandList, camera, frameSettings, outputBuffer);
+		}
+
 		SDL_UnlockTexture(this->gameWorldTexture);
 
 		const Int2 viewDims = this->window->getSceneViewDimensions();
@@ -454,7 +465,10 @@ void Sdl2DSoft3DRenderBackend::submitFrame(const RenderCommandList &renderComman
 		gameWorldDrawRect.y = 0;
 		gameWorldDrawRect.w = viewDims.x;
 		gameWorldDrawRect.h = viewDims.y;
-		SDL_RenderCopy(this->renderer, this->gameWorldTexture, nullptr, &gameWorldDrawRect);
+		if (hasGameWorldImage)
+		{
+			SDL_RenderCopy(this->renderer, this->gameWorldTexture, nullptr, &gameWorldDrawRect);
+		}
 	}
 
 	for (int entryIndex = 0; entryIndex < uiCommandList.entryCount; entryIndex++)
@@ -76,7 +76,7 @@ public:
 	void setMaterialInstanceTexCoordAnimPercent(RenderMaterialInstanceID id, double value) override;
 
 	// Renders a frame to the target window. Currently this is blocking and should be safe to present
-	// the frame upon returning.
+	// the frame upon returning. With pipelining enabled the game world shown is the one submitted last frame.
 	void submitFrame(const RenderCommandList &renderCommandList, const UiCommandList &uiCommandList,
 		const RenderCamera &camera, const RenderFrameSettings &frameSettings) override;
 };
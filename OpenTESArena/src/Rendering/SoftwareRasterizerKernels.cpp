@@ -0,0 +1,235 @@
+#if defined(__x86_64__) || defined(_M_X64)
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#endif
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+#include "SoftwareRasterizerKernels.h"
+#include "SoftwareRasterizerKernelsImpl.h"
+
+namespace
+{
+#if defined(__x86_64__) || defined(_M_X64)
+	template<typename T>
+	struct LanesSse2;
+
+	template<>
+	struct LanesSse2<float>
+	{
+		using Vec = __m128;
+		using Mask = __m128;
+		static constexpr int COUNT = 4;
+
+		static Vec set1(float value) { return _mm_set1_ps(value); }
+		static Vec laneOffsets() { return _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f); }
+		static Vec load(const float *ptr) { return _mm_loadu_ps(ptr); }
+		static void store(float *ptr, Vec value) { _mm_storeu_ps(ptr, value); }
+		static Vec add(Vec a, Vec b) { return _mm_add_ps(a, b); }
+		static Vec sub(Vec a, Vec b) { return _mm_sub_ps(a, b); }
+		static Vec mul(Vec a, Vec b) { return _mm_mul_ps(a, b); }
+		static Vec div(Vec a, Vec b) { return _mm_div_ps(a, b); }
+		static Mask cmpGE(Vec a, Vec b) { return _mm_cmpge_ps(a, b); }
+		static Mask cmpLT(Vec a, Vec b) { return _mm_cmplt_ps(a, b); }
+		static Mask maskAnd(Mask a, Mask b) { return _mm_and_ps(a, b); }
+
+		static void storeMask(uint8_t *ptr, Mask mask)
+		{
+			const int bits = _mm_movemask_ps(mask);
+			for (int i = 0; i < COUNT; i++)
+			{
+				ptr[i] = (bits >> i) & 1;
+			}
+		}
+	};
+
+	template<>
+	struct LanesSse2<double>
+	{
+		using Vec = __m128d;
+		using Mask = __m128d;
+		static constexpr int COUNT = 2;
+
+		static Vec set1(double value) { return _mm_set1_pd(value); }
+		static Vec laneOffsets() { return _mm_setr_pd(0.0, 1.0); }
+		static Vec load(const double *ptr) { return _mm_loadu_pd(ptr); }
+		static void store(double *ptr, Vec value) { _mm_storeu_pd(ptr, value); }
+		static Vec add(Vec a, Vec b) { return _mm_add_pd(a, b); }
+		static Vec sub(Vec a, Vec b) { return _mm_sub_pd(a, b); }
+		static Vec mul(Vec a, Vec b) { return _mm_mul_pd(a, b); }
+		static Vec div(Vec a, Vec b) { return _mm_div_pd(a, b); }
+		static Mask cmpGE(Vec a, Vec b) { return _mm_cmpge_pd(a, b); }
+		static Mask cmpLT(Vec a, Vec b) { return _mm_cmplt_pd(a, b); }
+		static Mask maskAnd(Mask a, Mask b) { return _mm_and_pd(a, b); }
+
+		static void storeMask(uint8_t *ptr, Mask mask)
+		{
+			const int bits = _mm_movemask_pd(mask);
+			ptr[0] = bits & 1;
+			ptr[1] = (bits >> 1) & 1;
+		}
+	};
+
+	using LanesBaseline = LanesSse2<RasterizerReal>;
+	constexpr const char *BASELINE_NAME = "SSE2";
+#elif defined(__aarch64__) || defined(_M_ARM64)
+	template<typename T>
+	struct LanesNeon;
+
+	template<>
+	struct LanesNeon<float>
+	{
+		using Vec = float32x4_t;
+		using Mask = uint32x4_t;
+		static constexpr int COUNT = 4;
+
+		static Vec set1(float value) { return vdupq_n_f32(value); }
+		static Vec laneOffsets() { const float offsets[COUNT] = { 0.0f, 1.0f, 2.0f, 3.0f }; return vld1q_f32(offsets); }
+		static Vec load(const float *ptr) { return vld1q_f32(ptr); }
+		static void store(float *ptr, Vec value) { vst1q_f32(ptr, value); }
+		static Vec add(Vec a, Vec b) { return vaddq_f32(a, b); }
+		static Vec sub(Vec a, Vec b) { return vsubq_f32(a, b); }
+		static Vec mul(Vec a, Vec b) { return vmulq_f32(a, b); }
+		static Vec div(Vec a, Vec b) { return vdivq_f32(a, b); }
+		static Mask cmpGE(Vec a, Vec b) { return vcgeq_f32(a, b); }
+		static Mask cmpLT(Vec a, Vec b) { return vcltq_f32(a, b); }
+		static Mask maskAnd(Mask a, Mask b) { return vandq_u32(a, b); }
+
+		static void storeMask(uint8_t *ptr, Mask mask)
+		{
+			// Narrow 0xFFFFFFFF lanes to 0x01 bytes.
+			const uint16x4_t narrow16 = vmovn_u32(mask);
+			const uint8x8_t narrow8 = vmovn_u16(vcombine_u16(narrow16, narrow16));
+			const uint8x8_t bytes = vand_u8(narrow8, vdup_n_u8(1));
+			ptr[0] = vget_lane_u8(bytes, 0);
+			ptr[1] = vget_lane_u8(bytes, 1);
+			ptr[2] = vget_lane_u8(bytes, 2);
+			ptr[3] = vget_lane_u8(bytes, 3);
+		}
+	};
+
+	template<>
+	struct LanesNeon<double>
+	{
+		using Vec = float64x2_t;
+		using Mask = uint64x2_t;
+		static constexpr int COUNT = 2;
+
+		static Vec set1(double value) { return vdupq_n_f64(value); }
+		static Vec laneOffsets() { const double offsets[COUNT] = { 0.0, 1.0 }; return vld1q_f64(offsets); }
+		static Vec load(const double *ptr) { return vld1q_f64(ptr); }
+		static void store(double *ptr, Vec value) { vst1q_f64(ptr, value); }
+		static Vec add(Vec a, Vec b) { return vaddq_f64(a, b); }
+		static Vec sub(Vec a, Vec b) { return vsubq_f64(a, b); }
+		static Vec mul(Vec a, Vec b) { return vmulq_f64(a, b); }
+		static Vec div(Vec a, Vec b) { return vdivq_f64(a, b); }
+		static Mask cmpGE(Vec a, Vec b) { return vcgeq_f64(a, b); }
+		static Mask cmpLT(Vec a, Vec b) { return vcltq_f64(a, b); }
+		static Mask maskAnd(Mask a, Mask b) { return vandq_u64(a, b); }
+
+		static void storeMask(uint8_t *ptr, Mask mask)
+		{
+			ptr[0] = static_cast<uint8_t>(vgetq_lane_u64(mask, 0) & 1);
+			ptr[1] = static_cast<uint8_t>(vgetq_lane_u64(mask, 1) & 1);
+		}
+	};
+
+	using LanesBaseline = LanesNeon<RasterizerReal>;
+	constexpr const char *BASELINE_NAME = "NEON";
+#else
+	using LanesBaseline = LanesScalar<RasterizerReal>;
+	constexpr const char *BASELINE_NAME = "Scalar";
+#endif
+
+	constexpr RasterizerKernels ScalarKernels =
+	{
+		"Scalar",
+		RowSetup<LanesScalar<RasterizerReal>>,
+		RowResolve
+	};
+
+	constexpr RasterizerKernels BaselineKernels =
+	{
+		BASELINE_NAME,
+		RowSetup<LanesBaseline>,
+		RowResolve
+	};
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+	constexpr RasterizerKernels Avx2Kernels =
+	{
+		"AVX2",
+		SoftwareRasterizerKernels::rowSetupAvx2,
+		SoftwareRasterizerKernels::rowResolveAvx2
+	};
+#endif
+}
+
+const RasterizerKernels &SoftwareRasterizerKernels::getScalar()
+{
+	return ScalarKernels;
+}
+
+const RasterizerKernels &SoftwareRasterizerKernels::getBaseline()
+{
+	return BaselineKernels;
+}
+
+const RasterizerKernels *SoftwareRasterizerKernels::getAvx2()
+{
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+	return &Avx2Kernels;
+#else
+	return nullptr;
+#endif
+}
+
+bool SoftwareRasterizerKernels::isAvx2Supported()
+{
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+	// Also checks that the OS saves YMM registers.
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("avx2") != 0;
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+	int cpuInfo[4];
+	__cpuid(cpuInfo, 0);
+	if (cpuInfo[0] < 7)
+	{
+		return false;
+	}
+
+	__cpuid(cpuInfo, 1);
+	const bool hasOsxsave = (cpuInfo[2] & (1 << 27)) != 0;
+	const bool hasAvx = (cpuInfo[2] & (1 << 28)) != 0;
+	if (!hasOsxsave || !hasAvx)
+	{
+		return false;
+	}
+
+	// XMM and YMM state must be enabled by the OS.
+	const unsigned long long xcr0 = _xgetbv(0);
+	if ((xcr0 & 0x6) != 0x6)
+	{
+		return false;
+	}
+
+	__cpuidex(cpuInfo, 7, 0);
+	return (cpuInfo[1] & (1 << 5)) != 0;
+#else
+	return false;
+#endif
+}
+
+const RasterizerKernels &SoftwareRasterizerKernels::select()
+{
+	const RasterizerKernels *avx2Kernels = SoftwareRasterizerKernels::getAvx2();
+	if ((avx2Kernels != nullptr) && SoftwareRasterizerKernels::isAvx2Supported())
+	{
+		return *avx2Kernels;
+	}
+
+	return SoftwareRasterizerKernels::getBaseline();
+}
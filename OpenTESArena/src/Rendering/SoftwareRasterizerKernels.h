@@ -0,0 +1,113 @@
+#ifndef SOFTWARE_RASTERIZER_KERNELS_H
+#define SOFTWARE_RASTERIZER_KERNELS_H
+
+#include <cstdint>
+
+// Row kernels for the software renderer's inner rasterization loop. Each ISA gets its own implementation
+// which is selected once at runtime, so a generic build can still use AVX2 when the CPU supports it.
+// This header is included by the AVX2 translation unit, so it must not pull in any inline code that could
+// be compiled with AVX2 enabled and then picked by the linker for non-AVX2 callers.
+
+// Precision of per-pixel rasterizer math and the depth buffer. Vertex processing and clipping stay in double.
+// Float doubles the SIMD lane width and halves depth buffer memory traffic.
+#ifdef HAVE_SOFTWARE_RASTERIZER_FLOAT
+using RasterizerReal = float;
+#else
+using RasterizerReal = double;
+#endif
+
+// Per-triangle values the row kernels interpolate with. Screen space values are in pixels.
+struct RasterizerRowTriangle
+{
+	RasterizerReal screenSpace0X, screenSpace0Y;
+	RasterizerReal screenSpace1X, screenSpace1Y;
+	RasterizerReal screenSpace2X, screenSpace2Y;
+	RasterizerReal screenSpace01X, screenSpace01Y;
+	RasterizerReal screenSpace02X, screenSpace02Y;
+	RasterizerReal screenSpace01PerpX, screenSpace01PerpY;
+	RasterizerReal screenSpace12PerpX, screenSpace12PerpY;
+	RasterizerReal screenSpace20PerpX, screenSpace20PerpY;
+	RasterizerReal barycentricDot00, barycentricDot01, barycentricDot11;
+	RasterizerReal barycentricDenominatorRecip;
+	RasterizerReal ndc0Z, ndc1Z, ndc2Z;
+	RasterizerReal clip0WRecip, clip1WRecip, clip2WRecip;
+	RasterizerReal uv0XDivW, uv0YDivW;
+	RasterizerReal uv1XDivW, uv1YDivW;
+	RasterizerReal uv2XDivW, uv2YDivW;
+};
+
+// One horizontal span of pixels in a rasterizer bin.
+struct RasterizerRowSpan
+{
+	int pixelCount;
+	RasterizerReal pixelCenterXStart; // Screen space X of the first pixel's center.
+	RasterizerReal pixelCenterY;
+	const RasterizerReal *depthBuffer; // Start of span in the depth buffer, null if depth reads are disabled.
+};
+
+// Per-pixel results of coverage, barycentric, depth and perspective texture coordinate evaluation.
+struct RasterizerRowSetupOutput
+{
+	uint8_t *coverageTests;
+	uint8_t *depthTests;
+	RasterizerReal *barycentricUs;
+	RasterizerReal *barycentricVs;
+	RasterizerReal *barycentricWs;
+	RasterizerReal *depths;
+	RasterizerReal *clipWRecips;
+	RasterizerReal *perspectiveTexCoordUs;
+	RasterizerReal *perspectiveTexCoordVs;
+};
+
+// Shaded pixels of a span waiting to be written to the frame buffer.
+struct RasterizerRowResolveInput
+{
+	int pixelCount;
+	const uint8_t *validPixels;
+	const uint8_t *shadedTexels;
+	const RasterizerReal *depths;
+	const uint32_t *paletteColors;
+};
+
+struct RasterizerRowResolveOutput
+{
+	uint8_t *paletteIndexBuffer;
+	uint32_t *colorBuffer;
+	RasterizerReal *depthBuffer; // Null if depth writes are disabled.
+};
+
+using RasterizerRowSetupFunc = void(*)(const RasterizerRowTriangle &triangle, const RasterizerRowSpan &span, const RasterizerRowSetupOutput &output);
+using RasterizerRowResolveFunc = int(*)(const RasterizerRowResolveInput &input, const RasterizerRowResolveOutput &output); // Returns pixels written.
+
+struct RasterizerKernels
+{
+	const char *name;
+	RasterizerRowSetupFunc rowSetup;
+	RasterizerRowResolveFunc rowResolve;
+};
+
+namespace SoftwareRasterizerKernels
+{
+	// Portable C++ loops, always available.
+	const RasterizerKernels &getScalar();
+
+	// Best kernels the target architecture guarantees (SSE2 on x86-64, NEON on AArch64), otherwise scalar.
+	const RasterizerKernels &getBaseline();
+
+	// Null if not compiled for x86.
+	const RasterizerKernels *getAvx2();
+
+	bool isAvx2Supported();
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+	// Defined in the translation unit compiled with AVX2 enabled. Only reachable through getAvx2() once
+	// isAvx2Supported() has been checked.
+	void rowSetupAvx2(const RasterizerRowTriangle &triangle, const RasterizerRowSpan &span, const RasterizerRowSetupOutput &output);
+	int rowResolveAvx2(const RasterizerRowResolveInput &input, const RasterizerRowResolveOutput &output);
+#endif
+
+	// Picks the fastest kernels the running CPU supports.
+	const RasterizerKernels &select();
+}
+
+#endif
@@ -0,0 +1,136 @@
+// Compiled with AVX2 enabled (see CMakeLists.txt). Nothing in here may be called unless
+// SoftwareRasterizerKernels::isAvx2Supported() is true.
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+
+#include <immintrin.h>
+
+#include "SoftwareRasterizerKernels.h"
+#include "SoftwareRasterizerKernelsImpl.h"
+
+namespace
+{
+	template<typename T>
+	struct LanesAvx2;
+
+	template<>
+	struct LanesAvx2<float>
+	{
+		using Vec = __m256;
+		using Mask = __m256;
+		static constexpr int COUNT = 8;
+
+		static Vec set1(float value) { return _mm256_set1_ps(value); }
+		static Vec laneOffsets() { return _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f); }
+		static Vec load(const float *ptr) { return _mm256_loadu_ps(ptr); }
+		static void store(float *ptr, Vec value) { _mm256_storeu_ps(ptr, value); }
+		static Vec add(Vec a, Vec b) { return _mm256_add_ps(a, b); }
+		static Vec sub(Vec a, Vec b) { return _mm256_sub_ps(a, b); }
+		static Vec mul(Vec a, Vec b) { return _mm256_mul_ps(a, b); }
+		static Vec div(Vec a, Vec b) { return _mm256_div_ps(a, b); }
+		static Mask cmpGE(Vec a, Vec b) { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+		static Mask cmpLT(Vec a, Vec b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+		static Mask maskAnd(Mask a, Mask b) { return _mm256_and_ps(a, b); }
+
+		static void storeMask(uint8_t *ptr, Mask mask)
+		{
+			// Pack 32-bit lane masks down to one 0/1 byte per lane.
+			const __m256i lanes = _mm256_srli_epi32(_mm256_castps_si256(mask), 31);
+			const __m128i packed16 = _mm_packus_epi32(_mm256_castsi256_si128(lanes), _mm256_extracti128_si256(lanes, 1));
+			const __m128i packed8 = _mm_packus_epi16(packed16, packed16);
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(ptr), packed8);
+		}
+	};
+
+	template<>
+	struct LanesAvx2<double>
+	{
+		using Vec = __m256d;
+		using Mask = __m256d;
+		static constexpr int COUNT = 4;
+
+		static Vec set1(double value) { return _mm256_set1_pd(value); }
+		static Vec laneOffsets() { return _mm256_setr_pd(0.0, 1.0, 2.0, 3.0); }
+		static Vec load(const double *ptr) { return _mm256_loadu_pd(ptr); }
+		static void store(double *ptr, Vec value) { _mm256_storeu_pd(ptr, value); }
+		static Vec add(Vec a, Vec b) { return _mm256_add_pd(a, b); }
+		static Vec sub(Vec a, Vec b) { return _mm256_sub_pd(a, b); }
+		static Vec mul(Vec a, Vec b) { return _mm256_mul_pd(a, b); }
+		static Vec div(Vec a, Vec b) { return _mm256_div_pd(a, b); }
+		static Mask cmpGE(Vec a, Vec b) { return _mm256_cmp_pd(a, b, _CMP_GE_OQ); }
+		static Mask cmpLT(Vec a, Vec b) { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+		static Mask maskAnd(Mask a, Mask b) { return _mm256_and_pd(a, b); }
+
+		static void storeMask(uint8_t *ptr, Mask mask)
+		{
+			const int bits = _mm256_movemask_pd(mask);
+			ptr[0] = bits & 1;
+			ptr[1] = (bits >> 1) & 1;
+			ptr[2] = (bits >> 2) & 1;
+			ptr[3] = (bits >> 3) & 1;
+		}
+	};
+
+	using LanesNative = LanesAvx2<RasterizerReal>;
+}
+
+void SoftwareRasterizerKernels::rowSetupAvx2(const RasterizerRowTriangle &triangle, const RasterizerRowSpan &span,
+	const RasterizerRowSetupOutput &output)
+{
+	RowSetup<LanesNative>(triangle, span, output);
+}
+
+int SoftwareRasterizerKernels::rowResolveAvx2(const RasterizerRowResolveInput &input, const RasterizerRowResolveOutput &output)
+{
+	constexpr int pixelsPerIteration = 8;
+	const int vectorEndIndex = input.pixelCount - (input.pixelCount % pixelsPerIteration);
+	const __m128i zero128 = _mm_setzero_si128();
+	const __m256i zero256 = _mm256_setzero_si256();
+	const int *paletteColors = reinterpret_cast<const int*>(input.paletteColors);
+
+	int writeCount = 0;
+	for (int i = 0; i < vectorEndIndex; i += pixelsPerIteration)
+	{
+		const __m128i validBytes = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(input.validPixels + i));
+		const __m128i validByteMask = _mm_cmpgt_epi8(validBytes, zero128);
+		int validBits = _mm_movemask_epi8(validByteMask) & 0xFF;
+		if (validBits == 0)
+		{
+			continue;
+		}
+
+		for (; validBits != 0; validBits &= validBits - 1)
+		{
+			writeCount++;
+		}
+
+		// Palette indices are blended in-register so invalid pixels keep their old value.
+		const __m128i shadedTexels = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(input.shadedTexels + i));
+		__m128i *paletteIndexDst = reinterpret_cast<__m128i*>(output.paletteIndexBuffer + i);
+		const __m128i prevPaletteIndices = _mm_loadl_epi64(paletteIndexDst);
+		_mm_storel_epi64(paletteIndexDst, _mm_blendv_epi8(prevPaletteIndices, shadedTexels, validByteMask));
+
+		// Gather palette colors, only for valid lanes.
+		const __m256i texelIndices = _mm256_cvtepu8_epi32(shadedTexels);
+		const __m256i validDwordMask = _mm256_cmpgt_epi32(_mm256_cvtepu8_epi32(validBytes), zero256);
+		const __m256i colors = _mm256_mask_i32gather_epi32(zero256, paletteColors, texelIndices, validDwordMask, 4);
+		_mm256_maskstore_epi32(reinterpret_cast<int*>(output.colorBuffer + i), validDwordMask, colors);
+
+		if (output.depthBuffer != nullptr)
+		{
+#ifdef HAVE_SOFTWARE_RASTERIZER_FLOAT
+			_mm256_maskstore_ps(output.depthBuffer + i, validDwordMask, _mm256_loadu_ps(input.depths + i));
+#else
+			const __m256i validQwordMaskLow = _mm256_cmpgt_epi64(_mm256_cvtepu8_epi64(validBytes), zero256);
+			const __m256i validQwordMaskHigh = _mm256_cmpgt_epi64(_mm256_cvtepu8_epi64(_mm_srli_si128(validBytes, 4)), zero256);
+			_mm256_maskstore_pd(output.depthBuffer + i, validQwordMaskLow, _mm256_loadu_pd(input.depths + i));
+			_mm256_maskstore_pd(output.depthBuffer + i + 4, validQwordMaskHigh, _mm256_loadu_pd(input.depths + i + 4));
+#endif
+		}
+	}
+
+	writeCount += RowResolveRange(input, output, vectorEndIndex, input.pixelCount);
+	return writeCount;
+}
+
+#endif
@@ -0,0 +1,166 @@
+#ifndef SOFTWARE_RASTERIZER_KERNELS_IMPL_H
+#define SOFTWARE_RASTERIZER_KERNELS_IMPL_H
+
+#include <cstdint>
+
+#include "SoftwareRasterizerKernels.h"
+
+// Kernel bodies shared by every ISA. Each ISA provides a "lanes" type with the vector operations below and
+// instantiates these templates in its own translation unit. Everything is in an anonymous namespace so an
+// AVX2 instantiation can never be merged with a baseline one at link time.
+namespace
+{
+	template<typename T>
+	struct LanesScalar
+	{
+		using Vec = T;
+		using Mask = bool;
+		static constexpr int COUNT = 1;
+
+		static Vec set1(T value) { return value; }
+		static Vec laneOffsets() { return static_cast<T>(0.0); }
+		static Vec load(const T *ptr) { return *ptr; }
+		static void store(T *ptr, Vec value) { *ptr = value; }
+		static Vec add(Vec a, Vec b) { return a + b; }
+		static Vec sub(Vec a, Vec b) { return a - b; }
+		static Vec mul(Vec a, Vec b) { return a * b; }
+		static Vec div(Vec a, Vec b) { return a / b; }
+		static Mask cmpGE(Vec a, Vec b) { return a >= b; }
+		static Mask cmpLT(Vec a, Vec b) { return a < b; }
+		static Mask maskAnd(Mask a, Mask b) { return a && b; }
+		static void storeMask(uint8_t *ptr, Mask mask) { *ptr = mask ? 1 : 0; }
+	};
+
+	// Evaluates pixels [startIndex, endIndex) of the span, endIndex - startIndex must be a multiple of the lane count.
+	template<typename Lanes>
+	void RowSetupRange(const RasterizerRowTriangle &triangle, const RasterizerRowSpan &span, const RasterizerRowSetupOutput &output,
+		int startIndex, int endIndex)
+	{
+		using Vec = typename Lanes::Vec;
+		using Mask = typename Lanes::Mask;
+
+		// Row-constant terms of the edge and barycentric dot products.
+		const RasterizerReal screenSpace0CurrentY = span.pixelCenterY - triangle.screenSpace0Y;
+		const Vec coverageDot0Y = Lanes::set1(screenSpace0CurrentY * triangle.screenSpace01PerpY);
+		const Vec coverageDot1Y = Lanes::set1((span.pixelCenterY - triangle.screenSpace1Y) * triangle.screenSpace12PerpY);
+		const Vec coverageDot2Y = Lanes::set1((span.pixelCenterY - triangle.screenSpace2Y) * triangle.screenSpace20PerpY);
+		const Vec barycentricDot20Y = Lanes::set1(screenSpace0CurrentY * triangle.screenSpace01Y);
+		const Vec barycentricDot21Y = Lanes::set1(screenSpace0CurrentY * triangle.screenSpace02Y);
+
+		const Vec zero = Lanes::set1(static_cast<RasterizerReal>(0.0));
+		const Vec one = Lanes::set1(static_cast<RasterizerReal>(1.0));
+		const Vec laneOffsets = Lanes::laneOffsets();
+		const Vec screenSpace0X = Lanes::set1(triangle.screenSpace0X);
+		const Vec screenSpace1X = Lanes::set1(triangle.screenSpace1X);
+		const Vec screenSpace2X = Lanes::set1(triangle.screenSpace2X);
+		const Vec screenSpace01X = Lanes::set1(triangle.screenSpace01X);
+		const Vec screenSpace02X = Lanes::set1(triangle.screenSpace02X);
+		const Vec screenSpace01PerpX = Lanes::set1(triangle.screenSpace01PerpX);
+		const Vec screenSpace12PerpX = Lanes::set1(triangle.screenSpace12PerpX);
+		const Vec screenSpace20PerpX = Lanes::set1(triangle.screenSpace20PerpX);
+		const Vec barycentricDot00 = Lanes::set1(triangle.barycentricDot00);
+		const Vec barycentricDot01 = Lanes::set1(triangle.barycentricDot01);
+		const Vec barycentricDot11 = Lanes::set1(triangle.barycentricDot11);
+		const Vec barycentricDenominatorRecip = Lanes::set1(triangle.barycentricDenominatorRecip);
+		const Vec ndc0Z = Lanes::set1(triangle.ndc0Z);
+		const Vec ndc1Z = Lanes::set1(triangle.ndc1Z);
+		const Vec ndc2Z = Lanes::set1(triangle.ndc2Z);
+		const Vec clip0WRecip = Lanes::set1(triangle.clip0WRecip);
+		const Vec clip1WRecip = Lanes::set1(triangle.clip1WRecip);
+		const Vec clip2WRecip = Lanes::set1(triangle.clip2WRecip);
+		const Vec uv0XDivW = Lanes::set1(triangle.uv0XDivW);
+		const Vec uv0YDivW = Lanes::set1(triangle.uv0YDivW);
+		const Vec uv1XDivW = Lanes::set1(triangle.uv1XDivW);
+		const Vec uv1YDivW = Lanes::set1(triangle.uv1YDivW);
+		const Vec uv2XDivW = Lanes::set1(triangle.uv2XDivW);
+		const Vec uv2YDivW = Lanes::set1(triangle.uv2YDivW);
+
+		for (int i = startIndex; i < endIndex; i += Lanes::COUNT)
+		{
+			const Vec pixelCenterX = Lanes::add(Lanes::set1(span.pixelCenterXStart + static_cast<RasterizerReal>(i)), laneOffsets);
+
+			// Coverage test (is pixel center in triangle?).
+			const Vec pixelCenterDot0 = Lanes::add(Lanes::mul(Lanes::sub(pixelCenterX, screenSpace0X), screenSpace01PerpX), coverageDot0Y);
+			const Vec pixelCenterDot1 = Lanes::add(Lanes::mul(Lanes::sub(pixelCenterX, screenSpace1X), screenSpace12PerpX), coverageDot1Y);
+			const Vec pixelCenterDot2 = Lanes::add(Lanes::mul(Lanes::sub(pixelCenterX, screenSpace2X), screenSpace20PerpX), coverageDot2Y);
+			const Mask isPixelCenterCovered = Lanes::maskAnd(Lanes::maskAnd(Lanes::cmpGE(pixelCenterDot0, zero),
+				Lanes::cmpGE(pixelCenterDot1, zero)), Lanes::cmpGE(pixelCenterDot2, zero));
+			Lanes::storeMask(output.coverageTests + i, isPixelCenterCovered);
+
+			// Barycentric coordinates and depth.
+			const Vec screenSpace0CurrentX = Lanes::sub(pixelCenterX, screenSpace0X);
+			const Vec barycentricDot20 = Lanes::add(Lanes::mul(screenSpace0CurrentX, screenSpace01X), barycentricDot20Y);
+			const Vec barycentricDot21 = Lanes::add(Lanes::mul(screenSpace0CurrentX, screenSpace02X), barycentricDot21Y);
+			const Vec vNumerator = Lanes::sub(Lanes::mul(barycentricDot11, barycentricDot20), Lanes::mul(barycentricDot01, barycentricDot21));
+			const Vec wNumerator = Lanes::sub(Lanes::mul(barycentricDot00, barycentricDot21), Lanes::mul(barycentricDot01, barycentricDot20));
+			const Vec v = Lanes::mul(vNumerator, barycentricDenominatorRecip);
+			const Vec w = Lanes::mul(wNumerator, barycentricDenominatorRecip);
+			const Vec u = Lanes::sub(Lanes::sub(one, v), w);
+			const Vec ndcZDepth = Lanes::add(Lanes::add(Lanes::mul(ndc0Z, u), Lanes::mul(ndc1Z, v)), Lanes::mul(ndc2Z, w));
+			Lanes::store(output.barycentricUs + i, u);
+			Lanes::store(output.barycentricVs + i, v);
+			Lanes::store(output.barycentricWs + i, w);
+			Lanes::store(output.depths + i, ndcZDepth);
+
+			// Depth test (is pixel center closer than depth buffer?).
+			if (span.depthBuffer != nullptr)
+			{
+				const Vec prevDepth = Lanes::load(span.depthBuffer + i);
+				Lanes::storeMask(output.depthTests + i, Lanes::cmpLT(ndcZDepth, prevDepth));
+			}
+			else
+			{
+				for (int j = 0; j < Lanes::COUNT; j++)
+				{
+					output.depthTests[i + j] = 1;
+				}
+			}
+
+			// Perspective-correct texture coordinates.
+			const Vec clipW = Lanes::add(Lanes::add(Lanes::mul(clip0WRecip, u), Lanes::mul(clip1WRecip, v)), Lanes::mul(clip2WRecip, w));
+			const Vec clipWRecip = Lanes::div(one, clipW);
+			const Vec texCoordUDivW = Lanes::add(Lanes::add(Lanes::mul(uv0XDivW, u), Lanes::mul(uv1XDivW, v)), Lanes::mul(uv2XDivW, w));
+			const Vec texCoordVDivW = Lanes::add(Lanes::add(Lanes::mul(uv0YDivW, u), Lanes::mul(uv1YDivW, v)), Lanes::mul(uv2YDivW, w));
+			Lanes::store(output.clipWRecips + i, clipWRecip);
+			Lanes::store(output.perspectiveTexCoordUs + i, Lanes::mul(texCoordUDivW, clipWRecip));
+			Lanes::store(output.perspectiveTexCoordVs + i, Lanes::mul(texCoordVDivW, clipWRecip));
+		}
+	}
+
+	template<typename Lanes>
+	void RowSetup(const RasterizerRowTriangle &triangle, const RasterizerRowSpan &span, const RasterizerRowSetupOutput &output)
+	{
+		const int vectorEndIndex = span.pixelCount - (span.pixelCount % Lanes::COUNT);
+		RowSetupRange<Lanes>(triangle, span, output, 0, vectorEndIndex);
+		RowSetupRange<LanesScalar<RasterizerReal>>(triangle, span, output, vectorEndIndex, span.pixelCount);
+	}
+
+	inline int RowResolveRange(const RasterizerRowResolveInput &input, const RasterizerRowResolveOutput &output, int startIndex, int endIndex)
+	{
+		int writeCount = 0;
+		for (int i = startIndex; i < endIndex; i++)
+		{
+			if (input.validPixels[i] != 0)
+			{
+				const uint8_t shadedTexel = input.shadedTexels[i];
+				output.paletteIndexBuffer[i] = shadedTexel;
+				output.colorBuffer[i] = input.paletteColors[shadedTexel];
+				writeCount++;
+
+				if (output.depthBuffer != nullptr)
+				{
+					output.depthBuffer[i] = input.depths[i];
+				}
+			}
+		}
+
+		return writeCount;
+	}
+
+	inline int RowResolve(const RasterizerRowResolveInput &input, const RasterizerRowResolveOutput &output)
+	{
+		return RowResolveRange(input, output, 0, input.pixelCount);
+	}
+}
+
+#endif
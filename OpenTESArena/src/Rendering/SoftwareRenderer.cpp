@@ -1,12 +1,16 @@
 #include <algorithm>
-#include <condition_variable>
+#include <atomic>
+#include <bit>
+#include <chrono>
 #include <cmath>
+#include <condition_variable>
 #include <cstdlib>
 #include <cstring>
 #include <deque>
 #include <limits>
 #include <mutex>
 #include <thread>
+#include <vector>
 
 #include "ArenaRenderUtils.h"
 #include "RenderBackend.h"
@@ -29,6 +33,8 @@
 #include "../World/ChunkUtils.h"
 
 #include "components/debug/Debug.h"
+#include "components/utilities/BumpAllocator.h"
+#include "components/utilities/JobSystem.h"
 
 // Loop unroll utils.
 namespace
@@ -799,10 +805,25 @@ namespace
 	};
 
 	int g_totalDrawCallCount = 0;
-
-	void PopulateDrawCallGlobals(int totalDrawCallCount)
+	const SoftwareVertexPositionBufferPool *g_positionBuffers;
+	const SoftwareVertexAttributeBufferPool *g_attributeBuffers;
+	const SoftwareIndexBufferPool *g_indexBuffers;
+	const SoftwareUniformBufferPool *g_uniformBuffers;
+	const SoftwareMaterialPool *g_materials;
+	const SoftwareMaterialInstancePool *g_materialInsts;
+
+	void PopulateDrawCallGlobals(int totalDrawCallCount, const SoftwareVertexPositionBufferPool *positionBuffers,
+		const SoftwareVertexAttributeBufferPool *attributeBuffers, const SoftwareIndexBufferPool *indexBuffers,
+		const SoftwareUniformBufferPool *uniformBuffers, const SoftwareMaterialPool *materials,
+		const SoftwareMaterialInstancePool *materialInsts)
 	{
 		g_totalDrawCallCount = totalDrawCallCount;
+		g_positionBuffers = positionBuffers;
+		g_attributeBuffers = attributeBuffers;
+		g_indexBuffers = indexBuffers;
+		g_uniformBuffers = uniformBuffers;
+		g_materials = materials;
+		g_materialInsts = materialInsts;
 	}
 
 	void PopulateMeshTransform(TransformCache &cache, const Matrix4d &modelMatrix)
@@ -833,30 +854,30 @@ namespace
 	struct RasterizerTriangle
 	{
 		// The rasterizer prefers vertices in AoS layout.
-		double clip0X, clip0Y, clip0Z, clip0W;
-		double clip1X, clip1Y, clip1Z, clip1W;
-		double clip2X, clip2Y, clip2Z, clip2W;
-		double clip0WRecip;
-		double clip1WRecip;
-		double clip2WRecip;
-		double ndc0X, ndc0Y, ndc0Z;
-		double ndc1X, ndc1Y, ndc1Z;
-		double ndc2X, ndc2Y, ndc2Z;
-		double screenSpace0X, screenSpace0Y;
-		double screenSpace1X, screenSpace1Y;
-		double screenSpace2X, screenSpace2Y;
-		double screenSpace01X, screenSpace01Y;
-		double screenSpace12X, screenSpace12Y;
-		double screenSpace20X, screenSpace20Y;
-		double screenSpace01PerpX, screenSpace01PerpY;
-		double screenSpace12PerpX, screenSpace12PerpY;
-		double screenSpace20PerpX, screenSpace20PerpY;
-		double uv0X, uv0Y;
-		double uv1X, uv1Y;
-		double uv2X, uv2Y;
-		double uv0XDivW, uv0YDivW;
-		double uv1XDivW, uv1YDivW;
-		double uv2XDivW, uv2YDivW;
+		RasterizerReal clip0X, clip0Y, clip0Z, clip0W;
+		RasterizerReal clip1X, clip1Y, clip1Z, clip1W;
+		RasterizerReal clip2X, clip2Y, clip2Z, clip2W;
+		RasterizerReal clip0WRecip;
+		RasterizerReal clip1WRecip;
+		RasterizerReal clip2WRecip;
+		RasterizerReal ndc0X, ndc0Y, ndc0Z;
+		RasterizerReal ndc1X, ndc1Y, ndc1Z;
+		RasterizerReal ndc2X, ndc2Y, ndc2Z;
+		RasterizerReal screenSpace0X, screenSpace0Y;
+		RasterizerReal screenSpace1X, screenSpace1Y;
+		RasterizerReal screenSpace2X, screenSpace2Y;
+		RasterizerReal screenSpace01X, screenSpace01Y;
+		RasterizerReal screenSpace12X, screenSpace12Y;
+		RasterizerReal screenSpace20X, screenSpace20Y;
+		RasterizerReal screenSpace01PerpX, screenSpace01PerpY;
+		RasterizerReal screenSpace12PerpX, screenSpace12PerpY;
+		RasterizerReal screenSpace20PerpX, screenSpace20PerpY;
+		RasterizerReal uv0X, uv0Y;
+		RasterizerReal uv1X, uv1Y;
+		RasterizerReal uv2X, uv2Y;
+		RasterizerReal uv0XDivW, uv0YDivW;
+		RasterizerReal uv1XDivW, uv1YDivW;
+		RasterizerReal uv2XDivW, uv2YDivW;
 	};
 
 	double NdcXToScreenSpace(double ndcX, double frameWidth)
@@ -1013,11 +1034,12 @@ namespace
 	double g_frameBufferHeightRealRecip;
 	DitheringMode g_ditheringMode;
 	uint8_t *g_paletteIndexBuffer;
-	double *g_depthBuffer;
+	RasterizerReal *g_depthBuffer;
 	uint32_t *g_colorBuffer;
 	SoftwareObjectTexturePool *g_objectTextures;
+	const RasterizerKernels *g_rasterizerKernels = nullptr; // Chosen for the running CPU at init.
 
-	void PopulateRasterizerGlobals(int frameBufferWidth, int frameBufferHeight, uint8_t *paletteIndexBuffer, double *depthBuffer,
+	void PopulateRasterizerGlobals(int frameBufferWidth, int frameBufferHeight, uint8_t *paletteIndexBuffer, RasterizerReal *depthBuffer,
 		DitheringMode ditheringMode, uint32_t *colorBuffer, SoftwareObjectTexturePool *objectTextures)
 	{
 		g_frameBufferWidth = frameBufferWidth;
@@ -1039,23 +1061,27 @@ namespace
 	std::atomic<int64_t> g_totalDepthTests = 0;
 	std::atomic<int64_t> g_totalColorWrites = 0;
 
+	// For measuring coarse occlusion culling.
+	std::atomic<int64_t> g_totalHiZRejectedTriangles = 0;
+	std::atomic<int64_t> g_totalHiZRejectedTiles = 0;
+
 	void ClearFrameBufferOperationCounts()
 	{
 		g_totalCoverageTests = 0;
 		g_totalDepthTests = 0;
 		g_totalColorWrites = 0;
+		g_totalHiZRejectedTriangles = 0;
+		g_totalHiZRejectedTiles = 0;
 	}
 }
 
 // Vertex shaders.
 namespace
 {
+	// Each lane's model-view-projection matrix, so one vertex shader call can cover triangles from several draw calls.
 	template<int N>
-	void VertexShader_BasicN(const TransformCache &__restrict transformCache, const double *__restrict vertexXs, const double *__restrict vertexYs,
-		const double *__restrict vertexZs, const double *__restrict vertexWs, double *__restrict outVertexXs, double *__restrict outVertexYs,
-		double *__restrict outVertexZs, double *__restrict outVertexWs)
+	struct TransformLanes
 	{
-		// Read in each mesh's transforms.
 		double modelViewProjMatrixXXs[N];
 		double modelViewProjMatrixXYs[N];
 		double modelViewProjMatrixXZs[N];
@@ -1072,85 +1098,58 @@ namespace
 		double modelViewProjMatrixWYs[N];
 		double modelViewProjMatrixWZs[N];
 		double modelViewProjMatrixWWs[N];
-		for (int i = 0; i < N; i++)
+
+		void gather(const TransformCache *__restrict transformCaches, const int *__restrict transformIndices)
 		{
-			// @todo: this isn't taking meshIndex anymore
-			modelViewProjMatrixXXs[i] = transformCache.modelViewProjMatrixXX;
-			modelViewProjMatrixXYs[i] = transformCache.modelViewProjMatrixXY;
-			modelViewProjMatrixXZs[i] = transformCache.modelViewProjMatrixXZ;
-			modelViewProjMatrixXWs[i] = transformCache.modelViewProjMatrixXW;
-			modelViewProjMatrixYXs[i] = transformCache.modelViewProjMatrixYX;
-			modelViewProjMatrixYYs[i] = transformCache.modelViewProjMatrixYY;
-			modelViewProjMatrixYZs[i] = transformCache.modelViewProjMatrixYZ;
-			modelViewProjMatrixYWs[i] = transformCache.modelViewProjMatrixYW;
-			modelViewProjMatrixZXs[i] = transformCache.modelViewProjMatrixZX;
-			modelViewProjMatrixZYs[i] = transformCache.modelViewProjMatrixZY;
-			modelViewProjMatrixZZs[i] = transformCache.modelViewProjMatrixZZ;
-			modelViewProjMatrixZWs[i] = transformCache.modelViewProjMatrixZW;
-			modelViewProjMatrixWXs[i] = transformCache.modelViewProjMatrixWX;
-			modelViewProjMatrixWYs[i] = transformCache.modelViewProjMatrixWY;
-			modelViewProjMatrixWZs[i] = transformCache.modelViewProjMatrixWZ;
-			modelViewProjMatrixWWs[i] = transformCache.modelViewProjMatrixWW;
+			for (int i = 0; i < N; i++)
+			{
+				const TransformCache &transformCache = transformCaches[transformIndices[i]];
+				modelViewProjMatrixXXs[i] = transformCache.modelViewProjMatrixXX;
+				modelViewProjMatrixXYs[i] = transformCache.modelViewProjMatrixXY;
+				modelViewProjMatrixXZs[i] = transformCache.modelViewProjMatrixXZ;
+				modelViewProjMatrixXWs[i] = transformCache.modelViewProjMatrixXW;
+				modelViewProjMatrixYXs[i] = transformCache.modelViewProjMatrixYX;
+				modelViewProjMatrixYYs[i] = transformCache.modelViewProjMatrixYY;
+				modelViewProjMatrixYZs[i] = transformCache.modelViewProjMatrixYZ;
+				modelViewProjMatrixYWs[i] = transformCache.modelViewProjMatrixYW;
+				modelViewProjMatrixZXs[i] = transformCache.modelViewProjMatrixZX;
+				modelViewProjMatrixZYs[i] = transformCache.modelViewProjMatrixZY;
+				modelViewProjMatrixZZs[i] = transformCache.modelViewProjMatrixZZ;
+				modelViewProjMatrixZWs[i] = transformCache.modelViewProjMatrixZW;
+				modelViewProjMatrixWXs[i] = transformCache.modelViewProjMatrixWX;
+				modelViewProjMatrixWYs[i] = transformCache.modelViewProjMatrixWY;
+				modelViewProjMatrixWZs[i] = transformCache.modelViewProjMatrixWZ;
+				modelViewProjMatrixWWs[i] = transformCache.modelViewProjMatrixWW;
+			}
 		}
+	};
 
+	template<int N>
+	void VertexShader_BasicN(const TransformLanes<N> &__restrict transformLanes, const double *__restrict vertexXs, const double *__restrict vertexYs,
+		const double *__restrict vertexZs, const double *__restrict vertexWs, double *__restrict outVertexXs, double *__restrict outVertexYs,
+		double *__restrict outVertexZs, double *__restrict outVertexWs)
+	{
 		// Apply model-view-projection matrix.
 		Matrix4_MultiplyVectorN<N>(
-			modelViewProjMatrixXXs, modelViewProjMatrixXYs, modelViewProjMatrixXZs, modelViewProjMatrixXWs,
-			modelViewProjMatrixYXs, modelViewProjMatrixYYs, modelViewProjMatrixYZs, modelViewProjMatrixYWs,
-			modelViewProjMatrixZXs, modelViewProjMatrixZYs, modelViewProjMatrixZZs, modelViewProjMatrixZWs,
-			modelViewProjMatrixWXs, modelViewProjMatrixWYs, modelViewProjMatrixWZs, modelViewProjMatrixWWs,
+			transformLanes.modelViewProjMatrixXXs, transformLanes.modelViewProjMatrixXYs, transformLanes.modelViewProjMatrixXZs, transformLanes.modelViewProjMatrixXWs,
+			transformLanes.modelViewProjMatrixYXs, transformLanes.modelViewProjMatrixYYs, transformLanes.modelViewProjMatrixYZs, transformLanes.modelViewProjMatrixYWs,
+			transformLanes.modelViewProjMatrixZXs, transformLanes.modelViewProjMatrixZYs, transformLanes.modelViewProjMatrixZZs, transformLanes.modelViewProjMatrixZWs,
+			transformLanes.modelViewProjMatrixWXs, transformLanes.modelViewProjMatrixWYs, transformLanes.modelViewProjMatrixWZs, transformLanes.modelViewProjMatrixWWs,
 			vertexXs, vertexYs, vertexZs, vertexWs,
 			outVertexXs, outVertexYs, outVertexZs, outVertexWs);
 	}
 
 	template<int N>
-	void VertexShader_EntityN(const TransformCache &__restrict transformCache, const double *__restrict vertexXs, const double *__restrict vertexYs,
+	void VertexShader_EntityN(const TransformLanes<N> &__restrict transformLanes, const double *__restrict vertexXs, const double *__restrict vertexYs,
 		const double *__restrict vertexZs, const double *__restrict vertexWs, double *__restrict outVertexXs, double *__restrict outVertexYs,
 		double *__restrict outVertexZs, double *__restrict outVertexWs)
 	{
-		double modelViewProjMatrixXXs[N];
-		double modelViewProjMatrixXYs[N];
-		double modelViewProjMatrixXZs[N];
-		double modelViewProjMatrixXWs[N];
-		double modelViewProjMatrixYXs[N];
-		double modelViewProjMatrixYYs[N];
-		double modelViewProjMatrixYZs[N];
-		double modelViewProjMatrixYWs[N];
-		double modelViewProjMatrixZXs[N];
-		double modelViewProjMatrixZYs[N];
-		double modelViewProjMatrixZZs[N];
-		double modelViewProjMatrixZWs[N];
-		double modelViewProjMatrixWXs[N];
-		double modelViewProjMatrixWYs[N];
-		double modelViewProjMatrixWZs[N];
-		double modelViewProjMatrixWWs[N];
-		for (int i = 0; i < N; i++)
-		{
-			// @todo: this isn't taking meshIndex anymore
-			modelViewProjMatrixXXs[i] = transformCache.modelViewProjMatrixXX;
-			modelViewProjMatrixXYs[i] = transformCache.modelViewProjMatrixXY;
-			modelViewProjMatrixXZs[i] = transformCache.modelViewProjMatrixXZ;
-			modelViewProjMatrixXWs[i] = transformCache.modelViewProjMatrixXW;
-			modelViewProjMatrixYXs[i] = transformCache.modelViewProjMatrixYX;
-			modelViewProjMatrixYYs[i] = transformCache.modelViewProjMatrixYY;
-			modelViewProjMatrixYZs[i] = transformCache.modelViewProjMatrixYZ;
-			modelViewProjMatrixYWs[i] = transformCache.modelViewProjMatrixYW;
-			modelViewProjMatrixZXs[i] = transformCache.modelViewProjMatrixZX;
-			modelViewProjMatrixZYs[i] = transformCache.modelViewProjMatrixZY;
-			modelViewProjMatrixZZs[i] = transformCache.modelViewProjMatrixZZ;
-			modelViewProjMatrixZWs[i] = transformCache.modelViewProjMatrixZW;
-			modelViewProjMatrixWXs[i] = transformCache.modelViewProjMatrixWX;
-			modelViewProjMatrixWYs[i] = transformCache.modelViewProjMatrixWY;
-			modelViewProjMatrixWZs[i] = transformCache.modelViewProjMatrixWZ;
-			modelViewProjMatrixWWs[i] = transformCache.modelViewProjMatrixWW;
-		}
-
 		// Apply model-view-projection matrix.
 		Matrix4_MultiplyVectorN<N>(
-			modelViewProjMatrixXXs, modelViewProjMatrixXYs, modelViewProjMatrixXZs, modelViewProjMatrixXWs,
-			modelViewProjMatrixYXs, modelViewProjMatrixYYs, modelViewProjMatrixYZs, modelViewProjMatrixYWs,
-			modelViewProjMatrixZXs, modelViewProjMatrixZYs, modelViewProjMatrixZZs, modelViewProjMatrixZWs,
-			modelViewProjMatrixWXs, modelViewProjMatrixWYs, modelViewProjMatrixWZs, modelViewProjMatrixWWs,
+			transformLanes.modelViewProjMatrixXXs, transformLanes.modelViewProjMatrixXYs, transformLanes.modelViewProjMatrixXZs, transformLanes.modelViewProjMatrixXWs,
+			transformLanes.modelViewProjMatrixYXs, transformLanes.modelViewProjMatrixYYs, transformLanes.modelViewProjMatrixYZs, transformLanes.modelViewProjMatrixYWs,
+			transformLanes.modelViewProjMatrixZXs, transformLanes.modelViewProjMatrixZYs, transformLanes.modelViewProjMatrixZZs, transformLanes.modelViewProjMatrixZWs,
+			transformLanes.modelViewProjMatrixWXs, transformLanes.modelViewProjMatrixWYs, transformLanes.modelViewProjMatrixWZs, transformLanes.modelViewProjMatrixWWs,
 			vertexXs, vertexYs, vertexZs, vertexWs,
 			outVertexXs, outVertexYs, outVertexZs, outVertexWs);
 	}
@@ -1164,7 +1163,7 @@ namespace
 		const uint8_t *texels;
 		int width, height;
 		int widthMinusOne, heightMinusOne;
-		double widthReal, heightReal;
+		RasterizerReal widthReal, heightReal;
 
 		FragmentShaderTexture()
 		{
@@ -1184,8 +1183,8 @@ namespace
 			this->height = height;
 			this->widthMinusOne = width - 1;
 			this->heightMinusOne = height - 1;
-			this->widthReal = static_cast<double>(width);
-			this->heightReal = static_cast<double>(height);
+			this->widthReal = static_cast<RasterizerReal>(width);
+			this->heightReal = static_cast<RasterizerReal>(height);
 		}
 	};
 
@@ -1363,9 +1362,12 @@ namespace
 	constexpr int MAX_VERTEX_SHADING_CACHE_TRIANGLES = MAX_DRAW_CALL_MESH_TRIANGLES * 2; // The most unshaded triangles that can be cached for the vertex shader loop.
 	constexpr int MAX_CLIPPED_MESH_TRIANGLES = 4096; // The most triangles a processed clip space mesh can have when passed to the rasterizer.
 	constexpr int MAX_CLIPPED_TRIANGLE_TRIANGLES = 64; // The most triangles a triangle can generate after being clipped by all clip planes.
+	static_assert(MathUtils::isMultipleOf(MAX_VERTEX_SHADING_CACHE_TRIANGLES, TYPICAL_LOOP_UNROLL));
+	static_assert(MAX_CLIPPED_MESH_TRIANGLES >= MAX_CLIPPED_TRIANGLE_TRIANGLES);
 
 	// One per group of mesh process caches, for improving number crunching efficiency with vertex shading by
-	// keeping the triangle count much higher than the average 2 per draw call.
+	// keeping the triangle count much higher than the average 2 per draw call. Holds the triangles of a run
+	// of consecutive draw calls that share a vertex shader.
 	struct VertexShaderInputCache
 	{
 		double unshadedV0Xs[MAX_VERTEX_SHADING_CACHE_TRIANGLES];
@@ -1386,30 +1388,41 @@ namespace
 		double uv1Ys[MAX_VERTEX_SHADING_CACHE_TRIANGLES];
 		double uv2Xs[MAX_VERTEX_SHADING_CACHE_TRIANGLES];
 		double uv2Ys[MAX_VERTEX_SHADING_CACHE_TRIANGLES];
+		int drawCallIndices[MAX_VERTEX_SHADING_CACHE_TRIANGLES]; // Worker draw call each triangle came from.
+		VertexShaderType vertexShaderType;
 		int triangleCount;
 	};
 
 	// Vertex shader results to be iterated over during clipping.
 	struct VertexShaderOutputCache
 	{
-		double shadedV0XYZWArray[MAX_DRAW_CALL_MESH_TRIANGLES][4];
-		double shadedV1XYZWArray[MAX_DRAW_CALL_MESH_TRIANGLES][4];
-		double shadedV2XYZWArray[MAX_DRAW_CALL_MESH_TRIANGLES][4];
-		double uv0XYArray[MAX_DRAW_CALL_MESH_TRIANGLES][2];
-		double uv1XYArray[MAX_DRAW_CALL_MESH_TRIANGLES][2];
-		double uv2XYArray[MAX_DRAW_CALL_MESH_TRIANGLES][2];
-		int triangleWriteCount; // This should match the draw call triangle count.
+		double shadedV0Xs[MAX_VERTEX_SHADING_CACHE_TRIANGLES];
+		double shadedV0Ys[MAX_VERTEX_SHADING_CACHE_TRIANGLES];
+		double shadedV0Zs[MAX_VERTEX_SHADING_CACHE_TRIANGLES];
+		double shadedV0Ws[MAX_VERTEX_SHADING_CACHE_TRIANGLES];
+		double shadedV1Xs[MAX_VERTEX_SHADING_CACHE_TRIANGLES];
+		double shadedV1Ys[MAX_VERTEX_SHADING_CACHE_TRIANGLES];
+		double shadedV1Zs[MAX_VERTEX_SHADING_CACHE_TRIANGLES];
+		double shadedV1Ws[MAX_VERTEX_SHADING_CACHE_TRIANGLES];
+		double shadedV2Xs[MAX_VERTEX_SHADING_CACHE_TRIANGLES];
+		double shadedV2Ys[MAX_VERTEX_SHADING_CACHE_TRIANGLES];
+		double shadedV2Zs[MAX_VERTEX_SHADING_CACHE_TRIANGLES];
+		double shadedV2Ws[MAX_VERTEX_SHADING_CACHE_TRIANGLES];
+		uint8_t clipOrMasks[MAX_VERTEX_SHADING_CACHE_TRIANGLES]; // Zero if all vertices are inside the frustum.
+		uint8_t clipAndMasks[MAX_VERTEX_SHADING_CACHE_TRIANGLES]; // Non-zero if all vertices are outside the same clip plane.
+		int triangleWriteCount; // This should match the vertex shader input triangle count.
 	};
 
 	struct ClippingOutputCache
 	{
-		// Triangles generated by clipping the current mesh. These are sent to the rasterizer.
+		// Triangles generated by clipping the current run of meshes. These are sent to the rasterizer.
 		double clipSpaceMeshV0XYZWArray[MAX_CLIPPED_MESH_TRIANGLES][4];
 		double clipSpaceMeshV1XYZWArray[MAX_CLIPPED_MESH_TRIANGLES][4];
 		double clipSpaceMeshV2XYZWArray[MAX_CLIPPED_MESH_TRIANGLES][4];
 		double clipSpaceMeshUV0XYArray[MAX_CLIPPED_MESH_TRIANGLES][2];
 		double clipSpaceMeshUV1XYArray[MAX_CLIPPED_MESH_TRIANGLES][2];
 		double clipSpaceMeshUV2XYArray[MAX_CLIPPED_MESH_TRIANGLES][2];
+		int clipSpaceMeshDrawCallIndices[MAX_CLIPPED_MESH_TRIANGLES];
 		int clipSpaceMeshTriangleCount; // Number of triangles in these clip space meshes to be rasterized.
 
 		// Triangles generated by clipping the current triangle against clipping planes.
@@ -1423,64 +1436,90 @@ namespace
 
 	std::atomic<int> g_totalPresentedTriangleCount = 0; // Triangles the rasterizer spends any time attempting to shade pixels for.
 
+	// For measuring geometry throughput (triangles per second per thread).
+	std::atomic<int64_t> g_totalGeometryTriangleCount = 0; // Triangles sent through the vertex shader.
+	std::atomic<double> g_totalGeometrySeconds = 0.0; // Summed over all geometry jobs.
+
 	void ClearTriangleTotalCounts()
 	{
 		g_totalPresentedTriangleCount = 0;
+		g_totalGeometryTriangleCount = 0;
+		g_totalGeometrySeconds = 0.0;
 	}
 
-	// Handles the vertex/attribute/index buffer lookups for more efficient processing later.
-	void ProcessMeshBufferLookups(const DrawCallCache &drawCallCache, VertexShaderInputCache &vertexShaderInputCache)
+	// Handles the vertex/attribute/index buffer lookups for more efficient processing later. Appends draw call meshes
+	// until one doesn't fit or needs a different vertex shader. Returns the index of the first draw call not consumed.
+	int ProcessMeshBufferLookups(const DrawCallCache *drawCallCaches, int startDrawCallIndex, int endDrawCallIndex,
+		VertexShaderInputCache &vertexShaderInputCache)
 	{
+		DebugAssert(startDrawCallIndex < endDrawCallIndex);
+		const VertexShaderType vertexShaderType = drawCallCaches[startDrawCallIndex].vertexShaderType;
+		vertexShaderInputCache.vertexShaderType = vertexShaderType;
 		vertexShaderInputCache.triangleCount = 0;
 
 		// Append vertices and texture coordinates into big arrays. The incoming meshes are likely tiny like 2 triangles each,
 		// so this makes the total triangle loop longer for ease of number crunching.
-		const double *positionsPtr = drawCallCache.positionBuffer->positions.begin();
-		const double *texCoordsPtr = drawCallCache.texCoordBuffer->attributes.begin();
-		const SoftwareIndexBuffer &indexBuffer = *drawCallCache.indexBuffer;
-		const int32_t *indicesPtr = indexBuffer.indices.begin();
-		const int meshTriangleCount = indexBuffer.triangleCount;
-		DebugAssert(meshTriangleCount <= MAX_DRAW_CALL_MESH_TRIANGLES);
-
+		int drawCallIndex = startDrawCallIndex;
 		int writeIndex = 0;
-		DebugAssert((writeIndex + meshTriangleCount) <= MAX_VERTEX_SHADING_CACHE_TRIANGLES);
-		for (int triangleIndex = 0; triangleIndex < meshTriangleCount; triangleIndex++)
-		{
-			constexpr int indicesPerTriangle = 3;
-			constexpr int positionComponentsPerVertex = 3;
-			constexpr int texCoordComponentsPerVertex = 2;
-			const int indexBufferBase = triangleIndex * indicesPerTriangle;
-			const int32_t index0 = indicesPtr[indexBufferBase];
-			const int32_t index1 = indicesPtr[indexBufferBase + 1];
-			const int32_t index2 = indicesPtr[indexBufferBase + 2];
-			const int32_t v0Index = index0 * positionComponentsPerVertex;
-			const int32_t v1Index = index1 * positionComponentsPerVertex;
-			const int32_t v2Index = index2 * positionComponentsPerVertex;
-			const int32_t uv0Index = index0 * texCoordComponentsPerVertex;
-			const int32_t uv1Index = index1 * texCoordComponentsPerVertex;
-			const int32_t uv2Index = index2 * texCoordComponentsPerVertex;
-			vertexShaderInputCache.unshadedV0Xs[writeIndex] = positionsPtr[v0Index];
-			vertexShaderInputCache.unshadedV0Ys[writeIndex] = positionsPtr[v0Index + 1];
-			vertexShaderInputCache.unshadedV0Zs[writeIndex] = positionsPtr[v0Index + 2];
-			vertexShaderInputCache.unshadedV0Ws[writeIndex] = 1.0;
-			vertexShaderInputCache.unshadedV1Xs[writeIndex] = positionsPtr[v1Index];
-			vertexShaderInputCache.unshadedV1Ys[writeIndex] = positionsPtr[v1Index + 1];
-			vertexShaderInputCache.unshadedV1Zs[writeIndex] = positionsPtr[v1Index + 2];
-			vertexShaderInputCache.unshadedV1Ws[writeIndex] = 1.0;
-			vertexShaderInputCache.unshadedV2Xs[writeIndex] = positionsPtr[v2Index];
-			vertexShaderInputCache.unshadedV2Ys[writeIndex] = positionsPtr[v2Index + 1];
-			vertexShaderInputCache.unshadedV2Zs[writeIndex] = positionsPtr[v2Index + 2];
-			vertexShaderInputCache.unshadedV2Ws[writeIndex] = 1.0;
-			vertexShaderInputCache.uv0Xs[writeIndex] = texCoordsPtr[uv0Index];
-			vertexShaderInputCache.uv0Ys[writeIndex] = texCoordsPtr[uv0Index + 1];
-			vertexShaderInputCache.uv1Xs[writeIndex] = texCoordsPtr[uv1Index];
-			vertexShaderInputCache.uv1Ys[writeIndex] = texCoordsPtr[uv1Index + 1];
-			vertexShaderInputCache.uv2Xs[writeIndex] = texCoordsPtr[uv2Index];
-			vertexShaderInputCache.uv2Ys[writeIndex] = texCoordsPtr[uv2Index + 1];
-			writeIndex++;
-		}
-
-		vertexShaderInputCache.triangleCount = meshTriangleCount;
+		while (drawCallIndex < endDrawCallIndex)
+		{
+			const DrawCallCache &drawCallCache = drawCallCaches[drawCallIndex];
+			const SoftwareIndexBuffer &indexBuffer = *drawCallCache.indexBuffer;
+			const int meshTriangleCount = indexBuffer.triangleCount;
+			DebugAssert(meshTriangleCount <= MAX_DRAW_CALL_MESH_TRIANGLES);
+
+			const bool isSameVertexShader = drawCallCache.vertexShaderType == vertexShaderType;
+			const bool canFitMesh = (writeIndex + meshTriangleCount) <= MAX_VERTEX_SHADING_CACHE_TRIANGLES;
+			if (!isSameVertexShader || !canFitMesh)
+			{
+				break;
+			}
+
+			const double *positionsPtr = drawCallCache.positionBuffer->positions.begin();
+			const double *texCoordsPtr = drawCallCache.texCoordBuffer->attributes.begin();
+			const int32_t *indicesPtr = indexBuffer.indices.begin();
+			for (int triangleIndex = 0; triangleIndex < meshTriangleCount; triangleIndex++)
+			{
+				constexpr int indicesPerTriangle = 3;
+				constexpr int positionComponentsPerVertex = 3;
+				constexpr int texCoordComponentsPerVertex = 2;
+				const int indexBufferBase = triangleIndex * indicesPerTriangle;
+				const int32_t index0 = indicesPtr[indexBufferBase];
+				const int32_t index1 = indicesPtr[indexBufferBase + 1];
+				const int32_t index2 = indicesPtr[indexBufferBase + 2];
+				const int32_t v0Index = index0 * positionComponentsPerVertex;
+				const int32_t v1Index = index1 * positionComponentsPerVertex;
+				const int32_t v2Index = index2 * positionComponentsPerVertex;
+				const int32_t uv0Index = index0 * texCoordComponentsPerVertex;
+				const int32_t uv1Index = index1 * texCoordComponentsPerVertex;
+				const int32_t uv2Index = index2 * texCoordComponentsPerVertex;
+				vertexShaderInputCache.unshadedV0Xs[writeIndex] = positionsPtr[v0Index];
+				vertexShaderInputCache.unshadedV0Ys[writeIndex] = positionsPtr[v0Index + 1];
+				vertexShaderInputCache.unshadedV0Zs[writeIndex] = positionsPtr[v0Index + 2];
+				vertexShaderInputCache.unshadedV0Ws[writeIndex] = 1.0;
+				vertexShaderInputCache.unshadedV1Xs[writeIndex] = positionsPtr[v1Index];
+				vertexShaderInputCache.unshadedV1Ys[writeIndex] = positionsPtr[v1Index + 1];
+				vertexShaderInputCache.unshadedV1Zs[writeIndex] = positionsPtr[v1Index + 2];
+				vertexShaderInputCache.unshadedV1Ws[writeIndex] = 1.0;
+				vertexShaderInputCache.unshadedV2Xs[writeIndex] = positionsPtr[v2Index];
+				vertexShaderInputCache.unshadedV2Ys[writeIndex] = positionsPtr[v2Index + 1];
+				vertexShaderInputCache.unshadedV2Zs[writeIndex] = positionsPtr[v2Index + 2];
+				vertexShaderInputCache.unshadedV2Ws[writeIndex] = 1.0;
+				vertexShaderInputCache.uv0Xs[writeIndex] = texCoordsPtr[uv0Index];
+				vertexShaderInputCache.uv0Ys[writeIndex] = texCoordsPtr[uv0Index + 1];
+				vertexShaderInputCache.uv1Xs[writeIndex] = texCoordsPtr[uv1Index];
+				vertexShaderInputCache.uv1Ys[writeIndex] = texCoordsPtr[uv1Index + 1];
+				vertexShaderInputCache.uv2Xs[writeIndex] = texCoordsPtr[uv2Index];
+				vertexShaderInputCache.uv2Ys[writeIndex] = texCoordsPtr[uv2Index + 1];
+				vertexShaderInputCache.drawCallIndices[writeIndex] = drawCallIndex;
+				writeIndex++;
+			}
+
+			drawCallIndex++;
+		}
+
+		vertexShaderInputCache.triangleCount = writeIndex;
+		return drawCallIndex;
 	}
 
 	void CalculateVertexShaderTransforms(TransformCache &transformCache)
@@ -1500,101 +1539,140 @@ namespace
 			&transformCache.modelViewProjMatrixWX, &transformCache.modelViewProjMatrixWY, &transformCache.modelViewProjMatrixWZ, &transformCache.modelViewProjMatrixWW);
 	}
 
-	// Converts the mesh's world space vertices to clip space.
+	// Which clip planes each vertex is outside of, using the same comparisons as ProcessClippingWithPlane().
+	template<int N>
+	void CalculateClipPlaneMasksN(const double *__restrict xs, const double *__restrict ys, const double *__restrict zs,
+		const double *__restrict ws, uint8_t *__restrict outMasks)
+	{
+		for (int i = 0; i < N; i++)
+		{
+			const double x = xs[i];
+			const double y = ys[i];
+			const double z = zs[i];
+			const double w = ws[i];
+			outMasks[i] = static_cast<uint8_t>(
+				(((x + w) >= 0.0) ? 0 : 0x01) | (((w - x) >= 0.0) ? 0 : 0x02) |
+				(((y + w) >= 0.0) ? 0 : 0x04) | (((w - y) >= 0.0) ? 0 : 0x08) |
+				(((z + w) >= 0.0) ? 0 : 0x10) | (((w - z) >= 0.0) ? 0 : 0x20));
+		}
+	}
+
+	// Converts N triangles' world space vertices to clip space, one draw call transform per lane.
+	template<VertexShaderType vertexShaderType, int N>
+	void ProcessVertexShadersN(const TransformCache *transformCaches, const VertexShaderInputCache &vertexShaderInputCache,
+		int triangleIndex, VertexShaderOutputCache &vertexShaderOutputCache)
+	{
+		TransformLanes<N> transformLanes;
+		transformLanes.gather(transformCaches, vertexShaderInputCache.drawCallIndices + triangleIndex);
+
+		double *shadedV0Xs = vertexShaderOutputCache.shadedV0Xs + triangleIndex;
+		double *shadedV0Ys = vertexShaderOutputCache.shadedV0Ys + triangleIndex;
+		double *shadedV0Zs = vertexShaderOutputCache.shadedV0Zs + triangleIndex;
+		double *shadedV0Ws = vertexShaderOutputCache.shadedV0Ws + triangleIndex;
+		double *shadedV1Xs = vertexShaderOutputCache.shadedV1Xs + triangleIndex;
+		double *shadedV1Ys = vertexShaderOutputCache.shadedV1Ys + triangleIndex;
+		double *shadedV1Zs = vertexShaderOutputCache.shadedV1Zs + triangleIndex;
+		double *shadedV1Ws = vertexShaderOutputCache.shadedV1Ws + triangleIndex;
+		double *shadedV2Xs = vertexShaderOutputCache.shadedV2Xs + triangleIndex;
+		double *shadedV2Ys = vertexShaderOutputCache.shadedV2Ys + triangleIndex;
+		double *shadedV2Zs = vertexShaderOutputCache.shadedV2Zs + triangleIndex;
+		double *shadedV2Ws = vertexShaderOutputCache.shadedV2Ws + triangleIndex;
+		for (int i = 0; i < N; i++)
+		{
+			shadedV0Xs[i] = 0.0;
+			shadedV0Ys[i] = 0.0;
+			shadedV0Zs[i] = 0.0;
+			shadedV0Ws[i] = 0.0;
+			shadedV1Xs[i] = 0.0;
+			shadedV1Ys[i] = 0.0;
+			shadedV1Zs[i] = 0.0;
+			shadedV1Ws[i] = 0.0;
+			shadedV2Xs[i] = 0.0;
+			shadedV2Ys[i] = 0.0;
+			shadedV2Zs[i] = 0.0;
+			shadedV2Ws[i] = 0.0;
+		}
+
+		const double *unshadedV0Xs = vertexShaderInputCache.unshadedV0Xs + triangleIndex;
+		const double *unshadedV0Ys = vertexShaderInputCache.unshadedV0Ys + triangleIndex;
+		const double *unshadedV0Zs = vertexShaderInputCache.unshadedV0Zs + triangleIndex;
+		const double *unshadedV0Ws = vertexShaderInputCache.unshadedV0Ws + triangleIndex;
+		const double *unshadedV1Xs = vertexShaderInputCache.unshadedV1Xs + triangleIndex;
+		const double *unshadedV1Ys = vertexShaderInputCache.unshadedV1Ys + triangleIndex;
+		const double *unshadedV1Zs = vertexShaderInputCache.unshadedV1Zs + triangleIndex;
+		const double *unshadedV1Ws = vertexShaderInputCache.unshadedV1Ws + triangleIndex;
+		const double *unshadedV2Xs = vertexShaderInputCache.unshadedV2Xs + triangleIndex;
+		const double *unshadedV2Ys = vertexShaderInputCache.unshadedV2Ys + triangleIndex;
+		const double *unshadedV2Zs = vertexShaderInputCache.unshadedV2Zs + triangleIndex;
+		const double *unshadedV2Ws = vertexShaderInputCache.unshadedV2Ws + triangleIndex;
+
+		if constexpr (vertexShaderType == VertexShaderType::Basic)
+		{
+			VertexShader_BasicN<N>(transformLanes, unshadedV0Xs, unshadedV0Ys, unshadedV0Zs, unshadedV0Ws, shadedV0Xs, shadedV0Ys, shadedV0Zs, shadedV0Ws);
+			VertexShader_BasicN<N>(transformLanes, unshadedV1Xs, unshadedV1Ys, unshadedV1Zs, unshadedV1Ws, shadedV1Xs, shadedV1Ys, shadedV1Zs, shadedV1Ws);
+			VertexShader_BasicN<N>(transformLanes, unshadedV2Xs, unshadedV2Ys, unshadedV2Zs, unshadedV2Ws, shadedV2Xs, shadedV2Ys, shadedV2Zs, shadedV2Ws);
+		}
+		else if (vertexShaderType == VertexShaderType::Entity)
+		{
+			VertexShader_EntityN<N>(transformLanes, unshadedV0Xs, unshadedV0Ys, unshadedV0Zs, unshadedV0Ws, shadedV0Xs, shadedV0Ys, shadedV0Zs, shadedV0Ws);
+			VertexShader_EntityN<N>(transformLanes, unshadedV1Xs, unshadedV1Ys, unshadedV1Zs, unshadedV1Ws, shadedV1Xs, shadedV1Ys, shadedV1Zs, shadedV1Ws);
+			VertexShader_EntityN<N>(transformLanes, unshadedV2Xs, unshadedV2Ys, unshadedV2Zs, unshadedV2Ws, shadedV2Xs, shadedV2Ys, shadedV2Zs, shadedV2Ws);
+		}
+
+		// Classify against the frustum now so most triangles can skip the clipping loop.
+		uint8_t v0ClipMasks[N];
+		uint8_t v1ClipMasks[N];
+		uint8_t v2ClipMasks[N];
+		CalculateClipPlaneMasksN<N>(shadedV0Xs, shadedV0Ys, shadedV0Zs, shadedV0Ws, v0ClipMasks);
+		CalculateClipPlaneMasksN<N>(shadedV1Xs, shadedV1Ys, shadedV1Zs, shadedV1Ws, v1ClipMasks);
+		CalculateClipPlaneMasksN<N>(shadedV2Xs, shadedV2Ys, shadedV2Zs, shadedV2Ws, v2ClipMasks);
+
+		uint8_t *clipOrMasks = vertexShaderOutputCache.clipOrMasks + triangleIndex;
+		uint8_t *clipAndMasks = vertexShaderOutputCache.clipAndMasks + triangleIndex;
+		for (int i = 0; i < N; i++)
+		{
+			clipOrMasks[i] = v0ClipMasks[i] | v1ClipMasks[i] | v2ClipMasks[i];
+			clipAndMasks[i] = v0ClipMasks[i] & v1ClipMasks[i] & v2ClipMasks[i];
+		}
+	}
+
 	template<VertexShaderType vertexShaderType>
-	void ProcessVertexShadersInternal(const TransformCache &transformCache, const VertexShaderInputCache &vertexShaderInputCache,
+	void ProcessVertexShadersInternal(const TransformCache *transformCaches, const VertexShaderInputCache &vertexShaderInputCache,
 		VertexShaderOutputCache &vertexShaderOutputCache)
 	{
-		vertexShaderOutputCache.triangleWriteCount = 0;
-
-		// Run vertex shaders on each triangle and store the results for clipping.
+		// Run vertex shaders on each triangle and store the results for clipping. Lanes can belong to different draw calls.
 		const int triangleCount = vertexShaderInputCache.triangleCount;
+		const int unrollAdjustedTriangleCount = GetUnrollAdjustedLoopCount(triangleCount, TYPICAL_LOOP_UNROLL);
 		int triangleIndex = 0;
-		while (triangleIndex < triangleCount)
+		while (triangleIndex < unrollAdjustedTriangleCount)
 		{
-			const double unshadedV0Xs[1] = { vertexShaderInputCache.unshadedV0Xs[triangleIndex] };
-			const double unshadedV0Ys[1] = { vertexShaderInputCache.unshadedV0Ys[triangleIndex] };
-			const double unshadedV0Zs[1] = { vertexShaderInputCache.unshadedV0Zs[triangleIndex] };
-			const double unshadedV0Ws[1] = { vertexShaderInputCache.unshadedV0Ws[triangleIndex] };
-			const double unshadedV1Xs[1] = { vertexShaderInputCache.unshadedV1Xs[triangleIndex] };
-			const double unshadedV1Ys[1] = { vertexShaderInputCache.unshadedV1Ys[triangleIndex] };
-			const double unshadedV1Zs[1] = { vertexShaderInputCache.unshadedV1Zs[triangleIndex] };
-			const double unshadedV1Ws[1] = { vertexShaderInputCache.unshadedV1Ws[triangleIndex] };
-			const double unshadedV2Xs[1] = { vertexShaderInputCache.unshadedV2Xs[triangleIndex] };
-			const double unshadedV2Ys[1] = { vertexShaderInputCache.unshadedV2Ys[triangleIndex] };
-			const double unshadedV2Zs[1] = { vertexShaderInputCache.unshadedV2Zs[triangleIndex] };
-			const double unshadedV2Ws[1] = { vertexShaderInputCache.unshadedV2Ws[triangleIndex] };
-			double shadedV0Xs[1] = { 0.0 };
-			double shadedV0Ys[1] = { 0.0 };
-			double shadedV0Zs[1] = { 0.0 };
-			double shadedV0Ws[1] = { 0.0 };
-			double shadedV1Xs[1] = { 0.0 };
-			double shadedV1Ys[1] = { 0.0 };
-			double shadedV1Zs[1] = { 0.0 };
-			double shadedV1Ws[1] = { 0.0 };
-			double shadedV2Xs[1] = { 0.0 };
-			double shadedV2Ys[1] = { 0.0 };
-			double shadedV2Zs[1] = { 0.0 };
-			double shadedV2Ws[1] = { 0.0 };
-
-			if constexpr (vertexShaderType == VertexShaderType::Basic)
-			{
-				VertexShader_BasicN<1>(transformCache, unshadedV0Xs, unshadedV0Ys, unshadedV0Zs, unshadedV0Ws, shadedV0Xs, shadedV0Ys, shadedV0Zs, shadedV0Ws);
-				VertexShader_BasicN<1>(transformCache, unshadedV1Xs, unshadedV1Ys, unshadedV1Zs, unshadedV1Ws, shadedV1Xs, shadedV1Ys, shadedV1Zs, shadedV1Ws);
-				VertexShader_BasicN<1>(transformCache, unshadedV2Xs, unshadedV2Ys, unshadedV2Zs, unshadedV2Ws, shadedV2Xs, shadedV2Ys, shadedV2Zs, shadedV2Ws);
-			}
-			else if (vertexShaderType == VertexShaderType::Entity)
-			{
-				VertexShader_EntityN<1>(transformCache, unshadedV0Xs, unshadedV0Ys, unshadedV0Zs, unshadedV0Ws, shadedV0Xs, shadedV0Ys, shadedV0Zs, shadedV0Ws);
-				VertexShader_EntityN<1>(transformCache, unshadedV1Xs, unshadedV1Ys, unshadedV1Zs, unshadedV1Ws, shadedV1Xs, shadedV1Ys, shadedV1Zs, shadedV1Ws);
-				VertexShader_EntityN<1>(transformCache, unshadedV2Xs, unshadedV2Ys, unshadedV2Zs, unshadedV2Ws, shadedV2Xs, shadedV2Ys, shadedV2Zs, shadedV2Ws);
-			}
+			ProcessVertexShadersN<vertexShaderType, TYPICAL_LOOP_UNROLL>(transformCaches, vertexShaderInputCache, triangleIndex, vertexShaderOutputCache);
+			triangleIndex += TYPICAL_LOOP_UNROLL;
+		}
 
-			int &writeIndex = vertexShaderOutputCache.triangleWriteCount;
-			DebugAssert(writeIndex < MAX_DRAW_CALL_MESH_TRIANGLES);
-
-			auto &resultV0XYZW = vertexShaderOutputCache.shadedV0XYZWArray[writeIndex];
-			auto &resultV1XYZW = vertexShaderOutputCache.shadedV1XYZWArray[writeIndex];
-			auto &resultV2XYZW = vertexShaderOutputCache.shadedV2XYZWArray[writeIndex];
-			auto &resultUV0XY = vertexShaderOutputCache.uv0XYArray[writeIndex];
-			auto &resultUV1XY = vertexShaderOutputCache.uv1XYArray[writeIndex];
-			auto &resultUV2XY = vertexShaderOutputCache.uv2XYArray[writeIndex];
-			resultV0XYZW[0] = shadedV0Xs[0];
-			resultV0XYZW[1] = shadedV0Ys[0];
-			resultV0XYZW[2] = shadedV0Zs[0];
-			resultV0XYZW[3] = shadedV0Ws[0];
-			resultV1XYZW[0] = shadedV1Xs[0];
-			resultV1XYZW[1] = shadedV1Ys[0];
-			resultV1XYZW[2] = shadedV1Zs[0];
-			resultV1XYZW[3] = shadedV1Ws[0];
-			resultV2XYZW[0] = shadedV2Xs[0];
-			resultV2XYZW[1] = shadedV2Ys[0];
-			resultV2XYZW[2] = shadedV2Zs[0];
-			resultV2XYZW[3] = shadedV2Ws[0];
-			resultUV0XY[0] = vertexShaderInputCache.uv0Xs[triangleIndex];
-			resultUV0XY[1] = vertexShaderInputCache.uv0Ys[triangleIndex];
-			resultUV1XY[0] = vertexShaderInputCache.uv1Xs[triangleIndex];
-			resultUV1XY[1] = vertexShaderInputCache.uv1Ys[triangleIndex];
-			resultUV2XY[0] = vertexShaderInputCache.uv2Xs[triangleIndex];
-			resultUV2XY[1] = vertexShaderInputCache.uv2Ys[triangleIndex];
-			writeIndex++;
+		while (triangleIndex < triangleCount)
+		{
+			ProcessVertexShadersN<vertexShaderType, 1>(transformCaches, vertexShaderInputCache, triangleIndex, vertexShaderOutputCache);
 			triangleIndex++;
 		}
+
+		vertexShaderOutputCache.triangleWriteCount = triangleCount;
 	}
 
-	// Operates on the current sequence of draw call meshes with the chosen vertex shader then writes results
+	// Operates on the current run of draw call meshes with their vertex shader then writes results
 	// to a cache for mesh clipping.
-	void ProcessVertexShaders(VertexShaderType vertexShaderType, const TransformCache &transformCache, const VertexShaderInputCache &vertexShaderInputCache,
+	void ProcessVertexShaders(const TransformCache *transformCaches, const VertexShaderInputCache &vertexShaderInputCache,
 		VertexShaderOutputCache &vertexShaderOutputCache)
 	{
 		// Dispatch based on vertex shader.
+		const VertexShaderType vertexShaderType = vertexShaderInputCache.vertexShaderType;
 		switch (vertexShaderType)
 		{
 		case VertexShaderType::Basic:
-			ProcessVertexShadersInternal<VertexShaderType::Basic>(transformCache, vertexShaderInputCache, vertexShaderOutputCache);
+			ProcessVertexShadersInternal<VertexShaderType::Basic>(transformCaches, vertexShaderInputCache, vertexShaderOutputCache);
 			break;
 		case VertexShaderType::Entity:
-			ProcessVertexShadersInternal<VertexShaderType::Entity>(transformCache, vertexShaderInputCache, vertexShaderOutputCache);
+			ProcessVertexShadersInternal<VertexShaderType::Entity>(transformCaches, vertexShaderInputCache, vertexShaderOutputCache);
 			break;
 		default:
 			DebugNotImplementedMsg(std::to_string(static_cast<int>(vertexShaderType)));
@@ -1875,42 +1953,72 @@ namespace
 		}
 	}
 
-	// Clips triangles to the frustum then writes out clip space triangle indices for the rasterizer to iterate.
-	void ProcessClipping(const DrawCallCache &drawCallCache, const VertexShaderOutputCache &vertexShaderOutputCache, ClippingOutputCache &clippingOutputCache)
+	void WriteClipSpaceMeshTriangle(const double (&v0XYZW)[4], const double (&v1XYZW)[4], const double (&v2XYZW)[4],
+		const double (&uv0XY)[2], const double (&uv1XY)[2], const double (&uv2XY)[2], int drawCallIndex, ClippingOutputCache &clippingOutputCache)
+	{
+		int &clipSpaceMeshTriangleCount = clippingOutputCache.clipSpaceMeshTriangleCount;
+		const int dstIndex = clipSpaceMeshTriangleCount;
+		DebugAssert(dstIndex < MAX_CLIPPED_MESH_TRIANGLES);
+
+		auto &clipSpaceMeshV0XYZW = clippingOutputCache.clipSpaceMeshV0XYZWArray[dstIndex];
+		auto &clipSpaceMeshV1XYZW = clippingOutputCache.clipSpaceMeshV1XYZWArray[dstIndex];
+		auto &clipSpaceMeshV2XYZW = clippingOutputCache.clipSpaceMeshV2XYZWArray[dstIndex];
+		auto &clipSpaceMeshUV0XY = clippingOutputCache.clipSpaceMeshUV0XYArray[dstIndex];
+		auto &clipSpaceMeshUV1XY = clippingOutputCache.clipSpaceMeshUV1XYArray[dstIndex];
+		auto &clipSpaceMeshUV2XY = clippingOutputCache.clipSpaceMeshUV2XYArray[dstIndex];
+		clipSpaceMeshV0XYZW[0] = v0XYZW[0];
+		clipSpaceMeshV0XYZW[1] = v0XYZW[1];
+		clipSpaceMeshV0XYZW[2] = v0XYZW[2];
+		clipSpaceMeshV0XYZW[3] = v0XYZW[3];
+		clipSpaceMeshV1XYZW[0] = v1XYZW[0];
+		clipSpaceMeshV1XYZW[1] = v1XYZW[1];
+		clipSpaceMeshV1XYZW[2] = v1XYZW[2];
+		clipSpaceMeshV1XYZW[3] = v1XYZW[3];
+		clipSpaceMeshV2XYZW[0] = v2XYZW[0];
+		clipSpaceMeshV2XYZW[1] = v2XYZW[1];
+		clipSpaceMeshV2XYZW[2] = v2XYZW[2];
+		clipSpaceMeshV2XYZW[3] = v2XYZW[3];
+		clipSpaceMeshUV0XY[0] = uv0XY[0];
+		clipSpaceMeshUV0XY[1] = uv0XY[1];
+		clipSpaceMeshUV1XY[0] = uv1XY[0];
+		clipSpaceMeshUV1XY[1] = uv1XY[1];
+		clipSpaceMeshUV2XY[0] = uv2XY[0];
+		clipSpaceMeshUV2XY[1] = uv2XY[1];
+		clippingOutputCache.clipSpaceMeshDrawCallIndices[dstIndex] = drawCallIndex;
+		clipSpaceMeshTriangleCount++;
+	}
+
+	// Clips triangles to the frustum then writes out clip space triangles for the rasterizer to iterate. Stops early
+	// if the clip space mesh might not fit the next triangle's clip results. Returns the next triangle to clip.
+	int ProcessClipping(int startTriangleIndex, const VertexShaderInputCache &vertexShaderInputCache,
+		const VertexShaderOutputCache &vertexShaderOutputCache, ClippingOutputCache &clippingOutputCache)
 	{
-		const auto &shadedV0XYZWs = vertexShaderOutputCache.shadedV0XYZWArray;
-		const auto &shadedV1XYZWs = vertexShaderOutputCache.shadedV1XYZWArray;
-		const auto &shadedV2XYZWs = vertexShaderOutputCache.shadedV2XYZWArray;
-		const auto &uv0XYs = vertexShaderOutputCache.uv0XYArray;
-		const auto &uv1XYs = vertexShaderOutputCache.uv1XYArray;
-		const auto &uv2XYs = vertexShaderOutputCache.uv2XYArray;
 		auto &clipSpaceTriangleV0XYZWs = clippingOutputCache.clipSpaceTriangleV0XYZWArray;
 		auto &clipSpaceTriangleV1XYZWs = clippingOutputCache.clipSpaceTriangleV1XYZWArray;
 		auto &clipSpaceTriangleV2XYZWs = clippingOutputCache.clipSpaceTriangleV2XYZWArray;
 		auto &clipSpaceTriangleUV0XYs = clippingOutputCache.clipSpaceTriangleUV0XYArray;
 		auto &clipSpaceTriangleUV1XYs = clippingOutputCache.clipSpaceTriangleUV1XYArray;
 		auto &clipSpaceTriangleUV2XYs = clippingOutputCache.clipSpaceTriangleUV2XYArray;
-		auto &clipSpaceMeshV0XYZWs = clippingOutputCache.clipSpaceMeshV0XYZWArray;
-		auto &clipSpaceMeshV1XYZWs = clippingOutputCache.clipSpaceMeshV1XYZWArray;
-		auto &clipSpaceMeshV2XYZWs = clippingOutputCache.clipSpaceMeshV2XYZWArray;
-		auto &clipSpaceMeshUV0XYs = clippingOutputCache.clipSpaceMeshUV0XYArray;
-		auto &clipSpaceMeshUV1XYs = clippingOutputCache.clipSpaceMeshUV1XYArray;
-		auto &clipSpaceMeshUV2XYs = clippingOutputCache.clipSpaceMeshUV2XYArray;
-		int &clipSpaceMeshTriangleCount = clippingOutputCache.clipSpaceMeshTriangleCount;
 
 		// Reset clip space cache. Skip zeroing the mesh arrays for performance.
-		clipSpaceMeshTriangleCount = 0;
+		clippingOutputCache.clipSpaceMeshTriangleCount = 0;
 
 		// Clip each vertex-shaded triangle and save them in a cache for rasterization.
-		const int triangleCount = drawCallCache.indexBuffer->triangleCount;
-		for (int triangleIndex = 0; triangleIndex < triangleCount; triangleIndex++)
-		{
-			const auto &shadedV0XYZW = shadedV0XYZWs[triangleIndex];
-			const auto &shadedV1XYZW = shadedV1XYZWs[triangleIndex];
-			const auto &shadedV2XYZW = shadedV2XYZWs[triangleIndex];
-			const auto &uv0XY = uv0XYs[triangleIndex];
-			const auto &uv1XY = uv1XYs[triangleIndex];
-			const auto &uv2XY = uv2XYs[triangleIndex];
+		const int triangleCount = vertexShaderOutputCache.triangleWriteCount;
+		int triangleIndex = startTriangleIndex;
+		for (; triangleIndex < triangleCount; triangleIndex++)
+		{
+			if ((clippingOutputCache.clipSpaceMeshTriangleCount + MAX_CLIPPED_TRIANGLE_TRIANGLES) > MAX_CLIPPED_MESH_TRIANGLES)
+			{
+				break;
+			}
+
+			if (vertexShaderOutputCache.clipAndMasks[triangleIndex] != 0)
+			{
+				// All vertices outside the same plane, nothing to rasterize.
+				continue;
+			}
+
 			auto &firstClipSpaceTriangleV0XYZW = clipSpaceTriangleV0XYZWs[0];
 			auto &firstClipSpaceTriangleV1XYZW = clipSpaceTriangleV1XYZWs[0];
 			auto &firstClipSpaceTriangleV2XYZW = clipSpaceTriangleV2XYZWs[0];
@@ -1919,24 +2027,33 @@ namespace
 			auto &firstClipSpaceTriangleUV2XY = clipSpaceTriangleUV2XYs[0];
 
 			// Initialize clipping loop with the vertex-shaded triangle.
-			firstClipSpaceTriangleV0XYZW[0] = shadedV0XYZW[0];
-			firstClipSpaceTriangleV0XYZW[1] = shadedV0XYZW[1];
-			firstClipSpaceTriangleV0XYZW[2] = shadedV0XYZW[2];
-			firstClipSpaceTriangleV0XYZW[3] = shadedV0XYZW[3];
-			firstClipSpaceTriangleV1XYZW[0] = shadedV1XYZW[0];
-			firstClipSpaceTriangleV1XYZW[1] = shadedV1XYZW[1];
-			firstClipSpaceTriangleV1XYZW[2] = shadedV1XYZW[2];
-			firstClipSpaceTriangleV1XYZW[3] = shadedV1XYZW[3];
-			firstClipSpaceTriangleV2XYZW[0] = shadedV2XYZW[0];
-			firstClipSpaceTriangleV2XYZW[1] = shadedV2XYZW[1];
-			firstClipSpaceTriangleV2XYZW[2] = shadedV2XYZW[2];
-			firstClipSpaceTriangleV2XYZW[3] = shadedV2XYZW[3];
-			firstClipSpaceTriangleUV0XY[0] = uv0XY[0];
-			firstClipSpaceTriangleUV0XY[1] = uv0XY[1];
-			firstClipSpaceTriangleUV1XY[0] = uv1XY[0];
-			firstClipSpaceTriangleUV1XY[1] = uv1XY[1];
-			firstClipSpaceTriangleUV2XY[0] = uv2XY[0];
-			firstClipSpaceTriangleUV2XY[1] = uv2XY[1];
+			firstClipSpaceTriangleV0XYZW[0] = vertexShaderOutputCache.shadedV0Xs[triangleIndex];
+			firstClipSpaceTriangleV0XYZW[1] = vertexShaderOutputCache.shadedV0Ys[triangleIndex];
+			firstClipSpaceTriangleV0XYZW[2] = vertexShaderOutputCache.shadedV0Zs[triangleIndex];
+			firstClipSpaceTriangleV0XYZW[3] = vertexShaderOutputCache.shadedV0Ws[triangleIndex];
+			firstClipSpaceTriangleV1XYZW[0] = vertexShaderOutputCache.shadedV1Xs[triangleIndex];
+			firstClipSpaceTriangleV1XYZW[1] = vertexShaderOutputCache.shadedV1Ys[triangleIndex];
+			firstClipSpaceTriangleV1XYZW[2] = vertexShaderOutputCache.shadedV1Zs[triangleIndex];
+			firstClipSpaceTriangleV1XYZW[3] = vertexShaderOutputCache.shadedV1Ws[triangleIndex];
+			firstClipSpaceTriangleV2XYZW[0] = vertexShaderOutputCache.shadedV2Xs[triangleIndex];
+			firstClipSpaceTriangleV2XYZW[1] = vertexShaderOutputCache.shadedV2Ys[triangleIndex];
+			firstClipSpaceTriangleV2XYZW[2] = vertexShaderOutputCache.shadedV2Zs[triangleIndex];
+			firstClipSpaceTriangleV2XYZW[3] = vertexShaderOutputCache.shadedV2Ws[triangleIndex];
+			firstClipSpaceTriangleUV0XY[0] = vertexShaderInputCache.uv0Xs[triangleIndex];
+			firstClipSpaceTriangleUV0XY[1] = vertexShaderInputCache.uv0Ys[triangleIndex];
+			firstClipSpaceTriangleUV1XY[0] = vertexShaderInputCache.uv1Xs[triangleIndex];
+			firstClipSpaceTriangleUV1XY[1] = vertexShaderInputCache.uv1Ys[triangleIndex];
+			firstClipSpaceTriangleUV2XY[0] = vertexShaderInputCache.uv2Xs[triangleIndex];
+			firstClipSpaceTriangleUV2XY[1] = vertexShaderInputCache.uv2Ys[triangleIndex];
+
+			const int drawCallIndex = vertexShaderInputCache.drawCallIndices[triangleIndex];
+			if (vertexShaderOutputCache.clipOrMasks[triangleIndex] == 0)
+			{
+				// Entirely inside the frustum, the common case.
+				WriteClipSpaceMeshTriangle(firstClipSpaceTriangleV0XYZW, firstClipSpaceTriangleV1XYZW, firstClipSpaceTriangleV2XYZW,
+					firstClipSpaceTriangleUV0XY, firstClipSpaceTriangleUV1XY, firstClipSpaceTriangleUV2XY, drawCallIndex, clippingOutputCache);
+				continue;
+			}
 
 			int clipListSize = 1; // Triangles to process based on this vertex-shaded triangle.
 			int clipListFrontIndex = 0;
@@ -1950,47 +2067,14 @@ namespace
 			ProcessClippingWithPlane<5>(clippingOutputCache, clipListSize, clipListFrontIndex);
 
 			// Add the clip results to the mesh, skipping the incomplete triangles the front index advanced beyond.
-			const int resultTriangleCount = clipListSize - clipListFrontIndex;
-			for (int resultTriangleIndex = 0; resultTriangleIndex < resultTriangleCount; resultTriangleIndex++)
+			for (int srcIndex = clipListFrontIndex; srcIndex < clipListSize; srcIndex++)
 			{
-				const int srcIndex = clipListFrontIndex + resultTriangleIndex;
-				const auto &clipSpaceTriangleV0XYZW = clipSpaceTriangleV0XYZWs[srcIndex];
-				const auto &clipSpaceTriangleV1XYZW = clipSpaceTriangleV1XYZWs[srcIndex];
-				const auto &clipSpaceTriangleV2XYZW = clipSpaceTriangleV2XYZWs[srcIndex];
-				const auto &clipSpaceTriangleUV0XY = clipSpaceTriangleUV0XYs[srcIndex];
-				const auto &clipSpaceTriangleUV1XY = clipSpaceTriangleUV1XYs[srcIndex];
-				const auto &clipSpaceTriangleUV2XY = clipSpaceTriangleUV2XYs[srcIndex];
-
-				const int dstIndex = clipSpaceMeshTriangleCount + resultTriangleIndex;
-				auto &clipSpaceMeshV0XYZW = clipSpaceMeshV0XYZWs[dstIndex];
-				auto &clipSpaceMeshV1XYZW = clipSpaceMeshV1XYZWs[dstIndex];
-				auto &clipSpaceMeshV2XYZW = clipSpaceMeshV2XYZWs[dstIndex];
-				auto &clipSpaceMeshUV0XY = clipSpaceMeshUV0XYs[dstIndex];
-				auto &clipSpaceMeshUV1XY = clipSpaceMeshUV1XYs[dstIndex];
-				auto &clipSpaceMeshUV2XY = clipSpaceMeshUV2XYs[dstIndex];
-
-				clipSpaceMeshV0XYZW[0] = clipSpaceTriangleV0XYZW[0];
-				clipSpaceMeshV0XYZW[1] = clipSpaceTriangleV0XYZW[1];
-				clipSpaceMeshV0XYZW[2] = clipSpaceTriangleV0XYZW[2];
-				clipSpaceMeshV0XYZW[3] = clipSpaceTriangleV0XYZW[3];
-				clipSpaceMeshV1XYZW[0] = clipSpaceTriangleV1XYZW[0];
-				clipSpaceMeshV1XYZW[1] = clipSpaceTriangleV1XYZW[1];
-				clipSpaceMeshV1XYZW[2] = clipSpaceTriangleV1XYZW[2];
-				clipSpaceMeshV1XYZW[3] = clipSpaceTriangleV1XYZW[3];
-				clipSpaceMeshV2XYZW[0] = clipSpaceTriangleV2XYZW[0];
-				clipSpaceMeshV2XYZW[1] = clipSpaceTriangleV2XYZW[1];
-				clipSpaceMeshV2XYZW[2] = clipSpaceTriangleV2XYZW[2];
-				clipSpaceMeshV2XYZW[3] = clipSpaceTriangleV2XYZW[3];
-				clipSpaceMeshUV0XY[0] = clipSpaceTriangleUV0XY[0];
-				clipSpaceMeshUV0XY[1] = clipSpaceTriangleUV0XY[1];
-				clipSpaceMeshUV1XY[0] = clipSpaceTriangleUV1XY[0];
-				clipSpaceMeshUV1XY[1] = clipSpaceTriangleUV1XY[1];
-				clipSpaceMeshUV2XY[0] = clipSpaceTriangleUV2XY[0];
-				clipSpaceMeshUV2XY[1] = clipSpaceTriangleUV2XY[1];
+				WriteClipSpaceMeshTriangle(clipSpaceTriangleV0XYZWs[srcIndex], clipSpaceTriangleV1XYZWs[srcIndex], clipSpaceTriangleV2XYZWs[srcIndex],
+					clipSpaceTriangleUV0XYs[srcIndex], clipSpaceTriangleUV1XYs[srcIndex], clipSpaceTriangleUV2XYs[srcIndex], drawCallIndex, clippingOutputCache);
 			}
-
-			clipSpaceMeshTriangleCount += resultTriangleCount;
 		}
+
+		return triangleIndex;
 	}
 }
 
@@ -2002,45 +2086,184 @@ namespace
 	struct RasterizerWorkItem
 	{
 		int binX, binY, binIndex;
+		int triangleCount; // Triangles binned by all workers, used as the estimated cost.
 
 		RasterizerWorkItem()
 		{
 			this->binX = -1;
 			this->binY = -1;
 			this->binIndex = -1;
+			this->triangleCount = 0;
 		}
 
-		RasterizerWorkItem(int binX, int binY, int binIndex)
+		RasterizerWorkItem(int binX, int binY, int binIndex, int triangleCount)
 		{
 			this->binX = binX;
 			this->binY = binY;
 			this->binIndex = binIndex;
+			this->triangleCount = triangleCount;
+		}
+	};
+
+	// A worker's contiguous range of scheduled rasterizer work items for one rasterization pass. The owner pops
+	// from the front and idle workers steal from the back. Both ends share one atomic so no item is taken twice.
+	class RasterizerWorkQueue
+	{
+	private:
+		std::atomic<uint64_t> range; // Front index in the low 32 bits, end index in the high 32 bits.
+
+		static uint64_t makeRange(uint32_t frontIndex, uint32_t endIndex)
+		{
+			return static_cast<uint64_t>(frontIndex) | (static_cast<uint64_t>(endIndex) << 32);
+		}
+	public:
+		RasterizerWorkQueue()
+		{
+			this->range = 0;
+		}
+
+		void reset(int frontIndex, int endIndex)
+		{
+			DebugAssert(frontIndex >= 0);
+			DebugAssert(frontIndex <= endIndex);
+			this->range.store(RasterizerWorkQueue::makeRange(frontIndex, endIndex), std::memory_order_relaxed);
+		}
+
+		bool tryPopFront(int *outIndex)
+		{
+			uint64_t curRange = this->range.load(std::memory_order_relaxed);
+			while (true)
+			{
+				const uint32_t frontIndex = static_cast<uint32_t>(curRange);
+				const uint32_t endIndex = static_cast<uint32_t>(curRange >> 32);
+				if (frontIndex >= endIndex)
+				{
+					return false;
+				}
+
+				if (this->range.compare_exchange_weak(curRange, RasterizerWorkQueue::makeRange(frontIndex + 1, endIndex), std::memory_order_relaxed))
+				{
+					*outIndex = static_cast<int>(frontIndex);
+					return true;
+				}
+			}
+		}
+
+		bool trySteal(int *outIndex)
+		{
+			uint64_t curRange = this->range.load(std::memory_order_relaxed);
+			while (true)
+			{
+				const uint32_t frontIndex = static_cast<uint32_t>(curRange);
+				const uint32_t endIndex = static_cast<uint32_t>(curRange >> 32);
+				if (frontIndex >= endIndex)
+				{
+					return false;
+				}
+
+				if (this->range.compare_exchange_weak(curRange, RasterizerWorkQueue::makeRange(frontIndex, endIndex - 1), std::memory_order_relaxed))
+				{
+					*outIndex = static_cast<int>(endIndex - 1);
+					return true;
+				}
+			}
+		}
+	};
+
+	// A triangle touching a bin, plus its bounding box in bin pixels.
+	struct RasterizerBinTriangle
+	{
+		int workerDrawCallIndex;
+		int triangleIndex; // Points into this worker's triangles to rasterize.
+		int binPixelAlignedXStart, binPixelAlignedXEnd;
+		int binPixelAlignedYStart, binPixelAlignedYEnd;
+	};
+
+	// Fixed-size block of a bin's triangle list. Allocated from the owning worker's per-frame arena so a bin
+	// only costs memory for the triangles that actually land in it.
+	struct RasterizerBinChunk
+	{
+		static constexpr int TRIANGLE_COUNT = 128;
+
+		RasterizerBinTriangle triangles[TRIANGLE_COUNT];
+		int triangleCount;
+		RasterizerBinChunk *next;
+
+		// Index one past the end of the run of same-draw-call triangles starting at the given index.
+		int getDrawCallRunEndIndex(int startIndex) const
+		{
+			DebugAssert(startIndex < this->triangleCount);
+			const int workerDrawCallIndex = this->triangles[startIndex].workerDrawCallIndex;
+
+			int endIndex = startIndex + 1;
+			while ((endIndex < this->triangleCount) && (this->triangles[endIndex].workerDrawCallIndex == workerDrawCallIndex))
+			{
+				endIndex++;
+			}
+
+			return endIndex;
 		}
 	};
 
-	// A selection of triangle indices in a mesh tied to one of the worker's draw calls.
+	// Consecutive triangles in a bin chunk from one of the worker's draw calls.
 	struct RasterizerBinEntry
 	{
 		int workerDrawCallIndex;
-		int triangleIndicesStartIndex, triangleIndicesCount; // Range of indices in the bin's indices to rasterize.
+		const RasterizerBinTriangle *triangles;
+		int triangleCount;
 
 		RasterizerBinEntry()
 		{
-			this->clear();
+			this->workerDrawCallIndex = -1;
+			this->triangles = nullptr;
+			this->triangleCount = 0;
+		}
+	};
+
+	// Grow-only arena for bin chunks, reset every time the bins are emptied. Blocks are kept between frames so
+	// steady-state rendering doesn't allocate.
+	class RasterizerBinArena
+	{
+	private:
+		static constexpr int BLOCK_CHUNK_COUNT = 64;
+
+		std::vector<BumpAllocator> blocks;
+		int blockIndex;
+	public:
+		RasterizerBinArena()
+		{
+			this->blockIndex = 0;
 		}
 
-		void clear()
+		RasterizerBinChunk *allocChunk()
 		{
-			this->workerDrawCallIndex = -1;
-			this->triangleIndicesStartIndex = -1;
-			this->triangleIndicesCount = 0;
+			while ((this->blockIndex < static_cast<int>(this->blocks.size())) && !this->blocks[this->blockIndex].canAlloc<RasterizerBinChunk>())
+			{
+				this->blockIndex++;
+			}
+
+			if (this->blockIndex == static_cast<int>(this->blocks.size()))
+			{
+				// Extra chunk's worth of bytes covers alignment padding.
+				constexpr int blockByteCount = static_cast<int>(sizeof(RasterizerBinChunk) * (BLOCK_CHUNK_COUNT + 1));
+				this->blocks.emplace_back(blockByteCount);
+			}
+
+			BumpAllocator &block = this->blocks[this->blockIndex];
+			RasterizerBinChunk *chunk = block.alloc<RasterizerBinChunk>();
+			chunk->triangleCount = 0;
+			chunk->next = nullptr;
+			return chunk;
 		}
 
-		void init(int workerDrawCallIndex, int triangleIndicesStartIndex)
+		void clear()
 		{
-			this->workerDrawCallIndex = workerDrawCallIndex;
-			this->triangleIndicesStartIndex = triangleIndicesStartIndex;
-			this->triangleIndicesCount = 0;
+			for (BumpAllocator &block : this->blocks)
+			{
+				block.clear();
+			}
+
+			this->blockIndex = 0;
 		}
 	};
 }
@@ -2049,17 +2272,8 @@ namespace
 // (has to be outside a namespace due to being in SoftwareRenderer).
 struct RasterizerBin
 {
-	static constexpr int MAX_FRUSTUM_TRIANGLES = 16384;
-
-	RasterizerBinEntry entries[MAX_WORKER_DRAW_CALLS_PER_LOOP]; // Draw call index + the portion of a mesh pointing into triangleIndicesToRasterize.
-	int entryCount;
-
-	int triangleIndicesToRasterize[MAX_FRUSTUM_TRIANGLES]; // Points into this worker's triangles to rasterize.
-	int triangleBinPixelAlignedXStarts[MAX_FRUSTUM_TRIANGLES];
-	int triangleBinPixelAlignedXEnds[MAX_FRUSTUM_TRIANGLES];
-	int triangleBinPixelAlignedYStarts[MAX_FRUSTUM_TRIANGLES];
-	int triangleBinPixelAlignedYEnds[MAX_FRUSTUM_TRIANGLES];
-	int triangleCount; // Triangles this bin should try to render. Determines where the next bin entry can allocate its triangle range.
+	RasterizerBinChunk *firstChunk, *lastChunk; // Triangles in draw order. Owned by the worker's bin arena.
+	int triangleCount; // Triangles this bin should try to render.
 
 	RasterizerBin()
 	{
@@ -2068,37 +2282,32 @@ struct RasterizerBin
 
 	void clear()
 	{
-		this->entryCount = 0;
+		this->firstChunk = nullptr;
+		this->lastChunk = nullptr;
 		this->triangleCount = 0;
 	}
 
-	RasterizerBinEntry &getOrAddEntry(int workerDrawCallIndex, int triangleIndicesStartIndex)
+	RasterizerBinTriangle &addTriangle(RasterizerBinArena &arena)
 	{
-		DebugAssert(workerDrawCallIndex >= 0);
-		DebugAssert(workerDrawCallIndex < MAX_WORKER_DRAW_CALLS_PER_LOOP);
-		DebugAssert(triangleIndicesStartIndex >= 0);
-		DebugAssert(triangleIndicesStartIndex < (MAX_FRUSTUM_TRIANGLES - 1));
-
-		RasterizerBinEntry *entryPtr = nullptr;
-		for (int i = 0; i < this->entryCount; i++)
+		if ((this->lastChunk == nullptr) || (this->lastChunk->triangleCount == RasterizerBinChunk::TRIANGLE_COUNT))
 		{
-			RasterizerBinEntry &curEntry = this->entries[i];
-			if (curEntry.workerDrawCallIndex == workerDrawCallIndex)
+			RasterizerBinChunk *newChunk = arena.allocChunk();
+			if (this->lastChunk == nullptr)
 			{
-				entryPtr = &curEntry;
-				break;
+				this->firstChunk = newChunk;
+			}
+			else
+			{
+				this->lastChunk->next = newChunk;
 			}
-		}
 
-		if (entryPtr == nullptr)
-		{
-			DebugAssertMsg(this->entryCount < std::size(this->entries), "Too many bin entries, can't insert for worker draw call index " + std::to_string(workerDrawCallIndex) + ".");
-			entryPtr = &this->entries[this->entryCount];
-			entryPtr->init(workerDrawCallIndex, triangleIndicesStartIndex);
-			this->entryCount++;
+			this->lastChunk = newChunk;
 		}
 
-		return *entryPtr;
+		RasterizerBinTriangle &binTriangle = this->lastChunk->triangles[this->lastChunk->triangleCount];
+		this->lastChunk->triangleCount++;
+		this->triangleCount++;
+		return binTriangle;
 	}
 };
 
@@ -2107,12 +2316,11 @@ namespace
 {
 	struct RasterizerInputCache
 	{
-		static constexpr int MAX_FRUSTUM_TRIANGLES = 16384;
-
-		RasterizerTriangle triangles[MAX_FRUSTUM_TRIANGLES]; // @todo: ideally this triangles array would still be global for all threads; lots of memory waste currently
+		std::vector<RasterizerTriangle> triangles; // Grows to the most triangles this worker has binned in one loop.
 		int triangleCount;
 
 		Buffer2D<RasterizerBin> bins;
+		RasterizerBinArena binArena;
 		int binWidth, binHeight;
 		int binCountX, binCountY;
 
@@ -2130,6 +2338,18 @@ namespace
 			this->triangleCount = 0;
 		}
 
+		RasterizerTriangle &addTriangle()
+		{
+			if (this->triangleCount == static_cast<int>(this->triangles.size()))
+			{
+				this->triangles.emplace_back();
+			}
+
+			RasterizerTriangle &triangle = this->triangles[this->triangleCount];
+			this->triangleCount++;
+			return triangle;
+		}
+
 		void createBins(int frameBufferWidth, int frameBufferHeight)
 		{
 			this->binWidth = GetRasterizerBinDimension(frameBufferWidth, RASTERIZER_TYPICAL_BINS_PER_FRAME_BUFFER_WIDTH, RASTERIZER_BIN_MIN_WIDTH, RASTERIZER_BIN_MAX_WIDTH);
@@ -2145,6 +2365,8 @@ namespace
 			{
 				bin.clear();
 			}
+
+			this->binArena.clear();
 		}
 	};
 
@@ -2164,7 +2386,119 @@ namespace
 		bool previousBrightnessTests[RASTERIZER_TILE_PIXEL_COUNT];
 	};
 
-	void ProcessClipSpaceTrianglesForBinning(int workerDrawCallIndex, bool enableBackFaceCulling, const ClippingOutputCache &clippingOutputCache, RasterizerInputCache &rasterizerInputCache)
+	// Hierarchical depth for coarse occlusion culling. Each rasterizer bin and each square tile inside it stores the
+	// farthest depth buffer value it covers, so a triangle whose nearest vertex is farther can't pass any depth test
+	// there. Tiles are in bin pixel space so only the thread rasterizing a bin ever touches its tiles.
+	constexpr int RASTERIZER_DEPTH_TILE_DIMENSION = 8;
+	static_assert(MathUtils::isMultipleOf(RASTERIZER_BIN_MIN_WIDTH, RASTERIZER_DEPTH_TILE_DIMENSION));
+	static_assert(MathUtils::isMultipleOf(RASTERIZER_BIN_MIN_HEIGHT, RASTERIZER_DEPTH_TILE_DIMENSION));
+	static_assert(MathUtils::isMultipleOf(RASTERIZER_DEPTH_TILE_DIMENSION, TYPICAL_LOOP_UNROLL));
+	static_assert((RASTERIZER_BIN_MAX_WIDTH / RASTERIZER_DEPTH_TILE_DIMENSION) <= 64); // One bit per tile in a bin row.
+
+	struct RasterizerDepthTiles
+	{
+		Buffer<RasterizerReal> tileMaxDepths; // All tiles of bin 0, then bin 1, etc..
+		Buffer<RasterizerReal> binMaxDepths;
+		int binWidth, binHeight;
+		int binCountX, binCountY;
+		int tileCountXPerBin, tileCountYPerBin;
+
+		RasterizerDepthTiles()
+		{
+			this->binWidth = 0;
+			this->binHeight = 0;
+			this->binCountX = 0;
+			this->binCountY = 0;
+			this->tileCountXPerBin = 0;
+			this->tileCountYPerBin = 0;
+		}
+
+		void init(int frameBufferWidth, int frameBufferHeight)
+		{
+			const int binWidth = GetRasterizerBinDimension(frameBufferWidth, RASTERIZER_TYPICAL_BINS_PER_FRAME_BUFFER_WIDTH, RASTERIZER_BIN_MIN_WIDTH, RASTERIZER_BIN_MAX_WIDTH);
+			const int binHeight = GetRasterizerBinDimension(frameBufferHeight, RASTERIZER_TYPICAL_BINS_PER_FRAME_BUFFER_HEIGHT, RASTERIZER_BIN_MIN_HEIGHT, RASTERIZER_BIN_MAX_HEIGHT);
+			const int binCountX = GetRasterizerBinCount(frameBufferWidth, binWidth);
+			const int binCountY = GetRasterizerBinCount(frameBufferHeight, binHeight);
+			if ((binWidth != this->binWidth) || (binHeight != this->binHeight) || (binCountX != this->binCountX) || (binCountY != this->binCountY))
+			{
+				this->binWidth = binWidth;
+				this->binHeight = binHeight;
+				this->binCountX = binCountX;
+				this->binCountY = binCountY;
+				this->tileCountXPerBin = binWidth / RASTERIZER_DEPTH_TILE_DIMENSION;
+				this->tileCountYPerBin = binHeight / RASTERIZER_DEPTH_TILE_DIMENSION;
+				this->tileMaxDepths.init(binCountX * binCountY * this->tileCountXPerBin * this->tileCountYPerBin);
+				this->binMaxDepths.init(binCountX * binCountY);
+			}
+		}
+
+		// Matches a cleared depth buffer. Tiles past the edge of the frame buffer have no depth so they never keep
+		// their bin from culling.
+		void clear(int frameBufferWidth, int frameBufferHeight)
+		{
+			for (int binY = 0; binY < this->binCountY; binY++)
+			{
+				for (int binX = 0; binX < this->binCountX; binX++)
+				{
+					const int binIndex = binX + (binY * this->binCountX);
+					RasterizerReal *binTileMaxDepths = this->getBinTileMaxDepths(binIndex);
+					for (int tileY = 0; tileY < this->tileCountYPerBin; tileY++)
+					{
+						const int frameBufferStartY = BinPixelToFrameBufferPixel(binY, tileY * RASTERIZER_DEPTH_TILE_DIMENSION, this->binHeight);
+						for (int tileX = 0; tileX < this->tileCountXPerBin; tileX++)
+						{
+							const int frameBufferStartX = BinPixelToFrameBufferPixel(binX, tileX * RASTERIZER_DEPTH_TILE_DIMENSION, this->binWidth);
+							const bool isTileInFrameBuffer = (frameBufferStartX < frameBufferWidth) && (frameBufferStartY < frameBufferHeight);
+							binTileMaxDepths[tileX + (tileY * this->tileCountXPerBin)] = isTileInFrameBuffer ?
+								std::numeric_limits<RasterizerReal>::infinity() : std::numeric_limits<RasterizerReal>::lowest();
+						}
+					}
+				}
+			}
+
+			this->binMaxDepths.fill(std::numeric_limits<RasterizerReal>::infinity());
+		}
+
+		RasterizerReal *getBinTileMaxDepths(int binIndex)
+		{
+			const int tilesPerBin = this->tileCountXPerBin * this->tileCountYPerBin;
+			return this->tileMaxDepths.begin() + (binIndex * tilesPerBin);
+		}
+
+		// Rereads a tile from the depth buffer after depth writes.
+		void updateTile(int binX, int binY, int tileX, int tileY)
+		{
+			const int frameBufferStartX = BinPixelToFrameBufferPixel(binX, tileX * RASTERIZER_DEPTH_TILE_DIMENSION, this->binWidth);
+			const int frameBufferStartY = BinPixelToFrameBufferPixel(binY, tileY * RASTERIZER_DEPTH_TILE_DIMENSION, this->binHeight);
+			const int frameBufferEndX = std::min(frameBufferStartX + RASTERIZER_DEPTH_TILE_DIMENSION, g_frameBufferWidth);
+			const int frameBufferEndY = std::min(frameBufferStartY + RASTERIZER_DEPTH_TILE_DIMENSION, g_frameBufferHeight);
+
+			RasterizerReal maxDepth = std::numeric_limits<RasterizerReal>::lowest();
+			for (int y = frameBufferStartY; y < frameBufferEndY; y++)
+			{
+				const RasterizerReal *depthRow = g_depthBuffer + (y * g_frameBufferWidth);
+				for (int x = frameBufferStartX; x < frameBufferEndX; x++)
+				{
+					maxDepth = std::max(maxDepth, depthRow[x]);
+				}
+			}
+
+			const int binIndex = binX + (binY * this->binCountX);
+			RasterizerReal *binTileMaxDepths = this->getBinTileMaxDepths(binIndex);
+			binTileMaxDepths[tileX + (tileY * this->tileCountXPerBin)] = maxDepth;
+		}
+
+		void updateBin(int binIndex)
+		{
+			const RasterizerReal *binTileMaxDepths = this->getBinTileMaxDepths(binIndex);
+			const int tilesPerBin = this->tileCountXPerBin * this->tileCountYPerBin;
+			this->binMaxDepths[binIndex] = *std::max_element(binTileMaxDepths, binTileMaxDepths + tilesPerBin);
+		}
+	};
+
+	RasterizerDepthTiles g_depthTiles;
+
+	void ProcessClipSpaceTrianglesForBinning(const DrawCallCache *drawCallCaches, const ClippingOutputCache &clippingOutputCache, RasterizerInputCache &rasterizerInputCache)
 	{
 		const auto &clipSpaceMeshV0XYZWs = clippingOutputCache.clipSpaceMeshV0XYZWArray;
 		const auto &clipSpaceMeshV1XYZWs = clippingOutputCache.clipSpaceMeshV1XYZWArray;
@@ -2172,10 +2506,14 @@ namespace
 		const auto &clipSpaceMeshUV0XYs = clippingOutputCache.clipSpaceMeshUV0XYArray;
 		const auto &clipSpaceMeshUV1XYs = clippingOutputCache.clipSpaceMeshUV1XYArray;
 		const auto &clipSpaceMeshUV2XYs = clippingOutputCache.clipSpaceMeshUV2XYArray;
+		const int *clipSpaceMeshDrawCallIndices = clippingOutputCache.clipSpaceMeshDrawCallIndices;
 
 		const int meshTriangleCount = clippingOutputCache.clipSpaceMeshTriangleCount;
 		for (int meshTriangleIndex = 0; meshTriangleIndex < meshTriangleCount; meshTriangleIndex++)
 		{
+			const int workerDrawCallIndex = clipSpaceMeshDrawCallIndices[meshTriangleIndex];
+			const bool enableBackFaceCulling = drawCallCaches[workerDrawCallIndex].enableBackFaceCulling;
+
 			const auto &clipSpaceMeshV0XYZW = clipSpaceMeshV0XYZWs[meshTriangleIndex];
 			const auto &clipSpaceMeshV1XYZW = clipSpaceMeshV1XYZWs[meshTriangleIndex];
 			const auto &clipSpaceMeshV2XYZW = clipSpaceMeshV2XYZWs[meshTriangleIndex];
@@ -2288,10 +2626,8 @@ namespace
 			Double2_RightPerpN<1>(&screenSpace20X, &screenSpace20Y, &screenSpace20PerpX, &screenSpace20PerpY);
 
 			// Write triangle to this worker's list.
-			auto &outputTriangles = rasterizerInputCache.triangles;
 			const int outputTriangleIndex = rasterizerInputCache.triangleCount;
-			DebugAssertIndex(outputTriangles, outputTriangleIndex);
-			RasterizerTriangle &outputTriangle = outputTriangles[outputTriangleIndex];
+			RasterizerTriangle &outputTriangle = rasterizerInputCache.addTriangle();
 			outputTriangle.clip0X = clip0X;
 			outputTriangle.clip0Y = clip0Y;
 			outputTriangle.clip0Z = clip0Z;
@@ -2378,9 +2714,6 @@ namespace
 				for (int binX = bboxStartBinX; binX < bboxEndBinX; binX++)
 				{
 					RasterizerBin &bin = rasterizerInputCache.bins.get(binX, binY);
-					const int binTriangleIndex = bin.triangleCount;
-					DebugAssertIndex(bin.triangleIndicesToRasterize, binTriangleIndex);
-					bin.triangleIndicesToRasterize[binTriangleIndex] = outputTriangleIndex;
 
 					const int binFrameBufferPixelStartX = BinPixelToFrameBufferPixel(binX, 0, binPixelWidth);
 					const int binFrameBufferPixelEndX = BinPixelToFrameBufferPixel(binX, binPixelWidth, binPixelWidth);
@@ -2400,29 +2733,24 @@ namespace
 					DebugAssert(MathUtils::isMultipleOf(binPixelStartX, TYPICAL_LOOP_UNROLL));
 					DebugAssert(MathUtils::isMultipleOf(binPixelEndX, TYPICAL_LOOP_UNROLL));
 
-					bin.triangleBinPixelAlignedXStarts[binTriangleIndex] = binPixelStartX;
-					bin.triangleBinPixelAlignedXEnds[binTriangleIndex] = binPixelEndX;
-					bin.triangleBinPixelAlignedYStarts[binTriangleIndex] = binPixelStartY;
-					bin.triangleBinPixelAlignedYEnds[binTriangleIndex] = binPixelEndY;
-
-					RasterizerBinEntry &binEntry = bin.getOrAddEntry(workerDrawCallIndex, binTriangleIndex);
-					binEntry.triangleIndicesCount++;
-					DebugAssert(binEntry.triangleIndicesCount <= std::size(bin.triangleIndicesToRasterize));
-
-					bin.triangleCount++;
+					RasterizerBinTriangle &binTriangle = bin.addTriangle(rasterizerInputCache.binArena);
+					binTriangle.workerDrawCallIndex = workerDrawCallIndex;
+					binTriangle.triangleIndex = outputTriangleIndex;
+					binTriangle.binPixelAlignedXStart = binPixelStartX;
+					binTriangle.binPixelAlignedXEnd = binPixelEndX;
+					binTriangle.binPixelAlignedYStart = binPixelStartY;
+					binTriangle.binPixelAlignedYEnd = binPixelEndY;
 				}
 			}
-
-			rasterizerInputCache.triangleCount++;
 		}
 	}
 
 	template<int N>
-	void GetPerspectiveTexel_N(const FragmentShaderTexture &__restrict texture, const double *__restrict perspectiveTexCoordU, const double *__restrict perspectiveTexCoordV,
+	void GetPerspectiveTexel_N(const FragmentShaderTexture &__restrict texture, const RasterizerReal *__restrict perspectiveTexCoordU, const RasterizerReal *__restrict perspectiveTexCoordV,
 		uint8_t *__restrict outTexel)
 	{
-		double uFract[N];
-		double vFract[N];
+		RasterizerReal uFract[N];
+		RasterizerReal vFract[N];
 		int texelX[N];
 		int texelY[N];
 		int texelIndex[N];
@@ -2440,12 +2768,13 @@ namespace
 
 		for (int i = 0; i < N; i++)
 		{
-			texelX[i] = static_cast<int>(uFract[i] * texture.widthReal);
+			// Tiny negative coordinates can round their fraction up to exactly 1.
+			texelX[i] = std::min(static_cast<int>(uFract[i] * texture.widthReal), texture.width - 1);
 		}
 
 		for (int i = 0; i < N; i++)
 		{
-			texelY[i] = static_cast<int>(vFract[i] * texture.heightReal);
+			texelY[i] = std::min(static_cast<int>(vFract[i] * texture.heightReal), texture.height - 1);
 		}
 
 		for (int i = 0; i < N; i++)
@@ -2460,7 +2789,7 @@ namespace
 	}
 
 	template<int N>
-	void GetScreenSpaceAnimationTexel_N(const FragmentShaderTexture &__restrict texture, double animPercent, const double *__restrict frameBufferPercentX, double frameBufferPercentY,
+	void GetScreenSpaceAnimationTexel_N(const FragmentShaderTexture &__restrict texture, double animPercent, const RasterizerReal *__restrict frameBufferPercentX, RasterizerReal frameBufferPercentY,
 		uint8_t *__restrict outTexel)
 	{
 		// @todo chasms: determine how many pixels the original texture should cover, based on what percentage the original texture height is over the original screen height.
@@ -2562,7 +2891,7 @@ namespace
 	}
 
 	template<RenderLightingType lightingType, FragmentShaderType fragmentShaderType, bool enableDepthRead, bool enableDepthWrite, DitheringMode ditheringMode>
-	void RasterizeMeshInternal(const DrawCallCache &drawCallCache, const RasterizerInputCache &rasterizerInputCache, const RasterizerBin &bin,
+	void RasterizeMeshInternal(const DrawCallCache &drawCallCache, const RasterizerInputCache &rasterizerInputCache,
 		const RasterizerBinEntry &binEntry, int binX, int binY, int binIndex)
 	{
 		// Early-out conditions.
@@ -2612,7 +2941,7 @@ namespace
 		constexpr bool requiresLightTableLighting = fragmentShaderType == FragmentShaderType::AlphaTestedWithLightLevelOpacity;
 
 		const double meshLightPercent = drawCallCache.meshLightPercent;
-		const double texCoordAnimPercent = drawCallCache.texCoordAnimPercent;
+		const RasterizerReal texCoordAnimPercent = drawCallCache.texCoordAnimPercent;
 
 		FragmentShaderLighting shaderLighting;
 		shaderLighting.lightTableTexels = g_lightTableTexture->texels8Bit;
@@ -2659,167 +2988,246 @@ namespace
 		const int lightBinWidth = GetLightBinWidth(g_frameBufferWidth);
 		const int lightBinHeight = GetLightBinHeight(g_frameBufferHeight);
 
+		const RasterizerReal frameBufferWidthReal = static_cast<RasterizerReal>(g_frameBufferWidthReal);
+		const RasterizerReal frameBufferHeightReal = static_cast<RasterizerReal>(g_frameBufferHeightReal);
+		const RasterizerReal frameBufferWidthRealRecip = static_cast<RasterizerReal>(g_frameBufferWidthRealRecip);
+		const RasterizerReal frameBufferHeightRealRecip = static_cast<RasterizerReal>(g_frameBufferHeightRealRecip);
+		constexpr RasterizerReal zero = static_cast<RasterizerReal>(0.0);
+		constexpr RasterizerReal half = static_cast<RasterizerReal>(0.50);
+		constexpr RasterizerReal one = static_cast<RasterizerReal>(1.0);
+
 		// Local variables added to a global afterwards to avoid fighting with threads.
 		int totalCoverageTests = 0;
 		int totalDepthTests = 0;
 		int totalColorWrites = 0;
-
-		const auto &triangleIndices = bin.triangleIndicesToRasterize;
-		for (int entryTriangleIndex = 0; entryTriangleIndex < binEntry.triangleIndicesCount; entryTriangleIndex++)
-		{
-			const int triangleIndicesIndex = binEntry.triangleIndicesStartIndex + entryTriangleIndex;
-			DebugAssertIndex(triangleIndices, triangleIndicesIndex);
-			const int triangleIndex = triangleIndices[triangleIndicesIndex];
+		int totalHiZRejectedTriangles = 0;
+		int totalHiZRejectedTiles = 0;
+
+		// Per-row results from the row kernels, indexed by bin pixel X relative to the triangle's start in the bin.
+		uint8_t rowCoverageTests[RASTERIZER_BIN_MAX_WIDTH];
+		uint8_t rowDepthTests[RASTERIZER_BIN_MAX_WIDTH];
+		RasterizerReal rowBarycentricUs[RASTERIZER_BIN_MAX_WIDTH];
+		RasterizerReal rowBarycentricVs[RASTERIZER_BIN_MAX_WIDTH];
+		RasterizerReal rowBarycentricWs[RASTERIZER_BIN_MAX_WIDTH];
+		RasterizerReal rowDepths[RASTERIZER_BIN_MAX_WIDTH];
+		RasterizerReal rowClipWRecips[RASTERIZER_BIN_MAX_WIDTH];
+		RasterizerReal rowPerspectiveTexCoordUs[RASTERIZER_BIN_MAX_WIDTH];
+		RasterizerReal rowPerspectiveTexCoordVs[RASTERIZER_BIN_MAX_WIDTH];
+		uint8_t rowValidPixels[RASTERIZER_BIN_MAX_WIDTH];
+		uint8_t rowShadedTexels[RASTERIZER_BIN_MAX_WIDTH];
+
+		RasterizerRowSetupOutput rowSetupOutput;
+		rowSetupOutput.coverageTests = rowCoverageTests;
+		rowSetupOutput.depthTests = rowDepthTests;
+		rowSetupOutput.barycentricUs = rowBarycentricUs;
+		rowSetupOutput.barycentricVs = rowBarycentricVs;
+		rowSetupOutput.barycentricWs = rowBarycentricWs;
+		rowSetupOutput.depths = rowDepths;
+		rowSetupOutput.clipWRecips = rowClipWRecips;
+		rowSetupOutput.perspectiveTexCoordUs = rowPerspectiveTexCoordUs;
+		rowSetupOutput.perspectiveTexCoordVs = rowPerspectiveTexCoordVs;
+
+		RasterizerRowResolveInput rowResolveInput;
+		rowResolveInput.validPixels = rowValidPixels;
+		rowResolveInput.shadedTexels = rowShadedTexels;
+		rowResolveInput.depths = rowDepths;
+		rowResolveInput.paletteColors = shaderPalette.colors;
+
+		for (int entryTriangleIndex = 0; entryTriangleIndex < binEntry.triangleCount; entryTriangleIndex++)
+		{
+			const RasterizerBinTriangle &binTriangle = binEntry.triangles[entryTriangleIndex];
+			const int triangleIndex = binTriangle.triangleIndex;
+			DebugAssert(triangleIndex < rasterizerInputCache.triangleCount);
 			const RasterizerTriangle &triangle = rasterizerInputCache.triangles[triangleIndex];
-			const double clip0X = triangle.clip0X;
-			const double clip0Y = triangle.clip0Y;
-			const double clip0Z = triangle.clip0Z;
-			const double clip0W = triangle.clip0W;
-			const double clip1X = triangle.clip1X;
-			const double clip1Y = triangle.clip1Y;
-			const double clip1Z = triangle.clip1Z;
-			const double clip1W = triangle.clip1W;
-			const double clip2X = triangle.clip2X;
-			const double clip2Y = triangle.clip2Y;
-			const double clip2Z = triangle.clip2Z;
-			const double clip2W = triangle.clip2W;
-			const double clip0WRecip = triangle.clip0WRecip;
-			const double clip1WRecip = triangle.clip1WRecip;
-			const double clip2WRecip = triangle.clip2WRecip;
-			const double ndc0X = triangle.ndc0X;
-			const double ndc0Y = triangle.ndc0Y;
-			const double ndc0Z = triangle.ndc0Z;
-			const double ndc1X = triangle.ndc1X;
-			const double ndc1Y = triangle.ndc1Y;
-			const double ndc1Z = triangle.ndc1Z;
-			const double ndc2X = triangle.ndc2X;
-			const double ndc2Y = triangle.ndc2Y;
-			const double ndc2Z = triangle.ndc2Z;
-			const double screenSpace0X = triangle.screenSpace0X;
-			const double screenSpace0Y = triangle.screenSpace0Y;
-			const double screenSpace1X = triangle.screenSpace1X;
-			const double screenSpace1Y = triangle.screenSpace1Y;
-			const double screenSpace2X = triangle.screenSpace2X;
-			const double screenSpace2Y = triangle.screenSpace2Y;
-			const double screenSpace01X = triangle.screenSpace01X;
-			const double screenSpace01Y = triangle.screenSpace01Y;
-			const double screenSpace12X = triangle.screenSpace12X;
-			const double screenSpace12Y = triangle.screenSpace12Y;
-			const double screenSpace20X = triangle.screenSpace20X;
-			const double screenSpace20Y = triangle.screenSpace20Y;
-			const double screenSpace01PerpX = triangle.screenSpace01PerpX;
-			const double screenSpace01PerpY = triangle.screenSpace01PerpY;
-			const double screenSpace12PerpX = triangle.screenSpace12PerpX;
-			const double screenSpace12PerpY = triangle.screenSpace12PerpY;
-			const double screenSpace20PerpX = triangle.screenSpace20PerpX;
-			const double screenSpace20PerpY = triangle.screenSpace20PerpY;
-			const double uv0X = triangle.uv0X;
-			const double uv0Y = triangle.uv0Y;
-			const double uv1X = triangle.uv1X;
-			const double uv1Y = triangle.uv1Y;
-			const double uv2X = triangle.uv2X;
-			const double uv2Y = triangle.uv2Y;
-			const double uv0XDivW = triangle.uv0XDivW;
-			const double uv0YDivW = triangle.uv0YDivW;
-			const double uv1XDivW = triangle.uv1XDivW;
-			const double uv1YDivW = triangle.uv1YDivW;
-			const double uv2XDivW = triangle.uv2XDivW;
-			const double uv2YDivW = triangle.uv2YDivW;
-
-			const double screenSpace02X = -triangle.screenSpace20X;
-			const double screenSpace02Y = -triangle.screenSpace20Y;
-			double barycentricDot00, barycentricDot01, barycentricDot11;
-			Double2_DotN<1>(&screenSpace01X, &screenSpace01Y, &screenSpace01X, &screenSpace01Y, &barycentricDot00);
-			Double2_DotN<1>(&screenSpace01X, &screenSpace01Y, &screenSpace02X, &screenSpace02Y, &barycentricDot01);
-			Double2_DotN<1>(&screenSpace02X, &screenSpace02Y, &screenSpace02X, &screenSpace02Y, &barycentricDot11);
-
-			const double barycentricDenominator = (barycentricDot00 * barycentricDot11) - (barycentricDot01 * barycentricDot01);
-			const double barycentricDenominatorRecip = 1.0 / barycentricDenominator;
-
-			const int binPixelXStart = bin.triangleBinPixelAlignedXStarts[triangleIndicesIndex];
-			const int binPixelXEnd = bin.triangleBinPixelAlignedXEnds[triangleIndicesIndex];
-			const int binPixelXUnrollAdjustedEnd = GetUnrollAdjustedLoopCount(binPixelXEnd, TYPICAL_LOOP_UNROLL);
-			const int binPixelYStart = bin.triangleBinPixelAlignedYStarts[triangleIndicesIndex];
-			const int binPixelYEnd = bin.triangleBinPixelAlignedYEnds[triangleIndicesIndex];
-			const int binPixelYUnrollAdjustedEnd = GetUnrollAdjustedLoopCount(binPixelYEnd, TYPICAL_LOOP_UNROLL);
 
-			// Shade triangle using this bin's bounding box of it.
-			for (int binPixelY = binPixelYStart; binPixelY < binPixelYUnrollAdjustedEnd; binPixelY += TYPICAL_LOOP_UNROLL)
+			// Interpolated depth is never nearer than the nearest vertex.
+			const RasterizerReal triangleMinDepth = std::min(triangle.ndc0Z, std::min(triangle.ndc1Z, triangle.ndc2Z));
+			if constexpr (enableDepthRead)
 			{
-				// Column slice setup.
-				int frameBufferPixelY[TYPICAL_LOOP_UNROLL];
-				double frameBufferPercentY[TYPICAL_LOOP_UNROLL];
-
-				for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
-				{
-					frameBufferPixelY[i] = BinPixelToFrameBufferPixel(binY, binPixelY + i, rasterizerInputCache.binHeight);
-				}
-
-				for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
+				if (triangleMinDepth > g_depthTiles.binMaxDepths[binIndex])
 				{
-					frameBufferPercentY[i] = (static_cast<double>(frameBufferPixelY[i]) + 0.50) * g_frameBufferHeightRealRecip;
+					totalHiZRejectedTriangles++;
+					continue;
 				}
+			}
 
-				// Column pixel coverage test components.
-				double pixelCenterY[TYPICAL_LOOP_UNROLL];
-				double pixelCenterPlane0DiffY[TYPICAL_LOOP_UNROLL];
-				double pixelCenterPlane1DiffY[TYPICAL_LOOP_UNROLL];
-				double pixelCenterPlane2DiffY[TYPICAL_LOOP_UNROLL];
-				double pixelCoverageDot0Y[TYPICAL_LOOP_UNROLL];
-				double pixelCoverageDot1Y[TYPICAL_LOOP_UNROLL];
-				double pixelCoverageDot2Y[TYPICAL_LOOP_UNROLL];
-				double screenSpace0CurrentY[TYPICAL_LOOP_UNROLL];
-				double barycentricDot20Y[TYPICAL_LOOP_UNROLL];
-				double barycentricDot21Y[TYPICAL_LOOP_UNROLL];
+			const RasterizerReal clip0X = triangle.clip0X;
+			const RasterizerReal clip0Y = triangle.clip0Y;
+			const RasterizerReal clip0Z = triangle.clip0Z;
+			const RasterizerReal clip0W = triangle.clip0W;
+			const RasterizerReal clip1X = triangle.clip1X;
+			const RasterizerReal clip1Y = triangle.clip1Y;
+			const RasterizerReal clip1Z = triangle.clip1Z;
+			const RasterizerReal clip1W = triangle.clip1W;
+			const RasterizerReal clip2X = triangle.clip2X;
+			const RasterizerReal clip2Y = triangle.clip2Y;
+			const RasterizerReal clip2Z = triangle.clip2Z;
+			const RasterizerReal clip2W = triangle.clip2W;
+			const RasterizerReal clip0WRecip = triangle.clip0WRecip;
+			const RasterizerReal clip1WRecip = triangle.clip1WRecip;
+			const RasterizerReal clip2WRecip = triangle.clip2WRecip;
+			const RasterizerReal ndc0X = triangle.ndc0X;
+			const RasterizerReal ndc0Y = triangle.ndc0Y;
+			const RasterizerReal ndc0Z = triangle.ndc0Z;
+			const RasterizerReal ndc1X = triangle.ndc1X;
+			const RasterizerReal ndc1Y = triangle.ndc1Y;
+			const RasterizerReal ndc1Z = triangle.ndc1Z;
+			const RasterizerReal ndc2X = triangle.ndc2X;
+			const RasterizerReal ndc2Y = triangle.ndc2Y;
+			const RasterizerReal ndc2Z = triangle.ndc2Z;
+			const RasterizerReal screenSpace0X = triangle.screenSpace0X;
+			const RasterizerReal screenSpace0Y = triangle.screenSpace0Y;
+			const RasterizerReal screenSpace1X = triangle.screenSpace1X;
+			const RasterizerReal screenSpace1Y = triangle.screenSpace1Y;
+			const RasterizerReal screenSpace2X = triangle.screenSpace2X;
+			const RasterizerReal screenSpace2Y = triangle.screenSpace2Y;
+			const RasterizerReal screenSpace01X = triangle.screenSpace01X;
+			const RasterizerReal screenSpace01Y = triangle.screenSpace01Y;
+			const RasterizerReal screenSpace12X = triangle.screenSpace12X;
+			const RasterizerReal screenSpace12Y = triangle.screenSpace12Y;
+			const RasterizerReal screenSpace20X = triangle.screenSpace20X;
+			const RasterizerReal screenSpace20Y = triangle.screenSpace20Y;
+			const RasterizerReal screenSpace01PerpX = triangle.screenSpace01PerpX;
+			const RasterizerReal screenSpace01PerpY = triangle.screenSpace01PerpY;
+			const RasterizerReal screenSpace12PerpX = triangle.screenSpace12PerpX;
+			const RasterizerReal screenSpace12PerpY = triangle.screenSpace12PerpY;
+			const RasterizerReal screenSpace20PerpX = triangle.screenSpace20PerpX;
+			const RasterizerReal screenSpace20PerpY = triangle.screenSpace20PerpY;
+			const RasterizerReal uv0X = triangle.uv0X;
+			const RasterizerReal uv0Y = triangle.uv0Y;
+			const RasterizerReal uv1X = triangle.uv1X;
+			const RasterizerReal uv1Y = triangle.uv1Y;
+			const RasterizerReal uv2X = triangle.uv2X;
+			const RasterizerReal uv2Y = triangle.uv2Y;
+			const RasterizerReal uv0XDivW = triangle.uv0XDivW;
+			const RasterizerReal uv0YDivW = triangle.uv0YDivW;
+			const RasterizerReal uv1XDivW = triangle.uv1XDivW;
+			const RasterizerReal uv1YDivW = triangle.uv1YDivW;
+			const RasterizerReal uv2XDivW = triangle.uv2XDivW;
+			const RasterizerReal uv2YDivW = triangle.uv2YDivW;
+
+			const RasterizerReal screenSpace02X = -triangle.screenSpace20X;
+			const RasterizerReal screenSpace02Y = -triangle.screenSpace20Y;
+			const RasterizerReal barycentricDot00 = (screenSpace01X * screenSpace01X) + (screenSpace01Y * screenSpace01Y);
+			const RasterizerReal barycentricDot01 = (screenSpace01X * screenSpace02X) + (screenSpace01Y * screenSpace02Y);
+			const RasterizerReal barycentricDot11 = (screenSpace02X * screenSpace02X) + (screenSpace02Y * screenSpace02Y);
+
+			const RasterizerReal barycentricDenominator = (barycentricDot00 * barycentricDot11) - (barycentricDot01 * barycentricDot01);
+			const RasterizerReal barycentricDenominatorRecip = one / barycentricDenominator;
+
+			RasterizerRowTriangle rowTriangle;
+			rowTriangle.screenSpace0X = screenSpace0X;
+			rowTriangle.screenSpace0Y = screenSpace0Y;
+			rowTriangle.screenSpace1X = screenSpace1X;
+			rowTriangle.screenSpace1Y = screenSpace1Y;
+			rowTriangle.screenSpace2X = screenSpace2X;
+			rowTriangle.screenSpace2Y = screenSpace2Y;
+			rowTriangle.screenSpace01X = screenSpace01X;
+			rowTriangle.screenSpace01Y = screenSpace01Y;
+			rowTriangle.screenSpace02X = screenSpace02X;
+			rowTriangle.screenSpace02Y = screenSpace02Y;
+			rowTriangle.screenSpace01PerpX = screenSpace01PerpX;
+			rowTriangle.screenSpace01PerpY = screenSpace01PerpY;
+			rowTriangle.screenSpace12PerpX = screenSpace12PerpX;
+			rowTriangle.screenSpace12PerpY = screenSpace12PerpY;
+			rowTriangle.screenSpace20PerpX = screenSpace20PerpX;
+			rowTriangle.screenSpace20PerpY = screenSpace20PerpY;
+			rowTriangle.barycentricDot00 = barycentricDot00;
+			rowTriangle.barycentricDot01 = barycentricDot01;
+			rowTriangle.barycentricDot11 = barycentricDot11;
+			rowTriangle.barycentricDenominatorRecip = barycentricDenominatorRecip;
+			rowTriangle.ndc0Z = ndc0Z;
+			rowTriangle.ndc1Z = ndc1Z;
+			rowTriangle.ndc2Z = ndc2Z;
+			rowTriangle.clip0WRecip = clip0WRecip;
+			rowTriangle.clip1WRecip = clip1WRecip;
+			rowTriangle.clip2WRecip = clip2WRecip;
+			rowTriangle.uv0XDivW = uv0XDivW;
+			rowTriangle.uv0YDivW = uv0YDivW;
+			rowTriangle.uv1XDivW = uv1XDivW;
+			rowTriangle.uv1YDivW = uv1YDivW;
+			rowTriangle.uv2XDivW = uv2XDivW;
+			rowTriangle.uv2YDivW = uv2YDivW;
+
+			const int binPixelXStart = binTriangle.binPixelAlignedXStart;
+			const int binPixelXEnd = binTriangle.binPixelAlignedXEnd;
+			const int binPixelYStart = binTriangle.binPixelAlignedYStart;
+			const int binPixelYEnd = binTriangle.binPixelAlignedYEnd;
+			const int binPixelYUnrollAdjustedEnd = GetUnrollAdjustedLoopCount(binPixelYEnd, TYPICAL_LOOP_UNROLL);
 
-				for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
-				{
-					pixelCenterY[i] = frameBufferPercentY[i] * g_frameBufferHeightReal;
-				}
+			// Depth tiles this bin's bounding box of the triangle touches, one tile row at a time.
+			const RasterizerReal *binTileMaxDepths = g_depthTiles.getBinTileMaxDepths(binIndex);
+			const int depthTileXStart = binPixelXStart / RASTERIZER_DEPTH_TILE_DIMENSION;
+			const int depthTileXEnd = (binPixelXEnd + (RASTERIZER_DEPTH_TILE_DIMENSION - 1)) / RASTERIZER_DEPTH_TILE_DIMENSION;
+			int depthTileY = -1;
+			uint64_t depthTileRowVisibleMask = 0; // Tiles the triangle might be in front of.
+			uint64_t depthTileRowWrittenMask = 0; // Tiles with new depth values.
+			int firstVisibleDepthTileX = 0;
+			int lastVisibleDepthTileX = 0;
+			int rowBinPixelXStart = binPixelXStart;
+			int rowBinPixelXEnd = binPixelXEnd;
+			bool hasBinDepthChanged = false;
 
-				for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
+			// Shade triangle using this bin's bounding box of it.
+			for (int binPixelY = binPixelYStart; binPixelY < binPixelYUnrollAdjustedEnd; binPixelY += TYPICAL_LOOP_UNROLL)
+			{
+				const int currentDepthTileY = binPixelY / RASTERIZER_DEPTH_TILE_DIMENSION;
+				if (currentDepthTileY != depthTileY)
 				{
-					pixelCenterPlane0DiffY[i] = pixelCenterY[i] - screenSpace0Y;
-				}
+					depthTileY = currentDepthTileY;
+					depthTileRowVisibleMask = 0;
+					depthTileRowWrittenMask = 0;
 
-				for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
-				{
-					pixelCenterPlane1DiffY[i] = pixelCenterY[i] - screenSpace1Y;
-				}
+					const RasterizerReal *depthTileRowMaxDepths = binTileMaxDepths + (depthTileY * g_depthTiles.tileCountXPerBin);
+					for (int depthTileX = depthTileXStart; depthTileX < depthTileXEnd; depthTileX++)
+					{
+						if (enableDepthRead && (triangleMinDepth > depthTileRowMaxDepths[depthTileX]))
+						{
+							totalHiZRejectedTiles++;
+						}
+						else
+						{
+							depthTileRowVisibleMask |= static_cast<uint64_t>(1) << depthTileX;
+						}
+					}
 
-				for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
-				{
-					pixelCenterPlane2DiffY[i] = pixelCenterY[i] - screenSpace2Y;
+					if (depthTileRowVisibleMask != 0)
+					{
+						// Rows only span from the first to the last visible tile.
+						firstVisibleDepthTileX = std::countr_zero(depthTileRowVisibleMask);
+						lastVisibleDepthTileX = 63 - std::countl_zero(depthTileRowVisibleMask);
+						rowBinPixelXStart = std::max(binPixelXStart, firstVisibleDepthTileX * RASTERIZER_DEPTH_TILE_DIMENSION);
+						rowBinPixelXEnd = std::min(binPixelXEnd, (lastVisibleDepthTileX + 1) * RASTERIZER_DEPTH_TILE_DIMENSION);
+					}
 				}
 
-				for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
+				if (depthTileRowVisibleMask == 0)
 				{
-					pixelCoverageDot0Y[i] = pixelCenterPlane0DiffY[i] * screenSpace01PerpY;
+					continue;
 				}
 
-				for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
-				{
-					pixelCoverageDot1Y[i] = pixelCenterPlane1DiffY[i] * screenSpace12PerpY;
-				}
+				const int rowBinPixelXUnrollAdjustedEnd = GetUnrollAdjustedLoopCount(rowBinPixelXEnd, TYPICAL_LOOP_UNROLL);
 
-				for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
-				{
-					pixelCoverageDot2Y[i] = pixelCenterPlane2DiffY[i] * screenSpace20PerpY;
-				}
+				// Column slice setup.
+				int frameBufferPixelY[TYPICAL_LOOP_UNROLL];
+				RasterizerReal frameBufferPercentY[TYPICAL_LOOP_UNROLL];
 
 				for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
 				{
-					screenSpace0CurrentY[i] = pixelCenterY[i] - screenSpace0Y;
+					frameBufferPixelY[i] = BinPixelToFrameBufferPixel(binY, binPixelY + i, rasterizerInputCache.binHeight);
 				}
 
 				for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
 				{
-					barycentricDot20Y[i] = screenSpace0CurrentY[i] * screenSpace01Y;
+					frameBufferPercentY[i] = (static_cast<RasterizerReal>(frameBufferPixelY[i]) + half) * frameBufferHeightRealRecip;
 				}
 
+				// Column pixel center.
+				RasterizerReal pixelCenterY[TYPICAL_LOOP_UNROLL];
+
 				for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
 				{
-					barycentricDot21Y[i] = screenSpace0CurrentY[i] * screenSpace02Y;
+					pixelCenterY[i] = frameBufferPercentY[i] * frameBufferHeightReal;
 				}
 
 				// Column light bin component.
@@ -2832,8 +3240,39 @@ namespace
 
 				for (int yUnrollIndex = 0; yUnrollIndex < TYPICAL_LOOP_UNROLL; yUnrollIndex++)
 				{
-					for (int binPixelX = binPixelXStart; binPixelX < binPixelXUnrollAdjustedEnd; binPixelX += TYPICAL_LOOP_UNROLL)
+					// Coverage, barycentrics, depth and texture coordinates for the whole row at once.
+					const int rowFrameBufferPixelXStart = BinPixelToFrameBufferPixel(binX, rowBinPixelXStart, rasterizerInputCache.binWidth);
+					const int rowFrameBufferPixelIndex = rowFrameBufferPixelXStart + (frameBufferPixelY[yUnrollIndex] * g_frameBufferWidth);
+					const int rowPixelCount = rowBinPixelXEnd - rowBinPixelXStart;
+					DebugAssert(rowPixelCount <= RASTERIZER_BIN_MAX_WIDTH);
+
+					RasterizerRowSpan rowSpan;
+					rowSpan.pixelCount = rowPixelCount;
+					rowSpan.pixelCenterXStart = static_cast<RasterizerReal>(rowFrameBufferPixelXStart) + half;
+					rowSpan.pixelCenterY = pixelCenterY[yUnrollIndex];
+					rowSpan.depthBuffer = enableDepthRead ? (g_depthBuffer + rowFrameBufferPixelIndex) : nullptr;
+					g_rasterizerKernels->rowSetup(rowTriangle, rowSpan, rowSetupOutput);
+
+					if constexpr (enableDepthRead)
+					{
+						// Occluded tiles between visible ones fail coverage so their pixel groups are skipped.
+						for (int depthTileX = firstVisibleDepthTileX + 1; depthTileX < lastVisibleDepthTileX; depthTileX++)
+						{
+							if ((depthTileRowVisibleMask & (static_cast<uint64_t>(1) << depthTileX)) == 0)
+							{
+								const int depthTileRowPixelOffset = (depthTileX * RASTERIZER_DEPTH_TILE_DIMENSION) - rowBinPixelXStart;
+								std::fill(rowCoverageTests + depthTileRowPixelOffset, rowCoverageTests + depthTileRowPixelOffset + RASTERIZER_DEPTH_TILE_DIMENSION, 0);
+							}
+						}
+					}
+
+					std::fill(rowValidPixels, rowValidPixels + rowPixelCount, 0);
+					bool rowHasValidPixels = false;
+
+					for (int binPixelX = rowBinPixelXStart; binPixelX < rowBinPixelXUnrollAdjustedEnd; binPixelX += TYPICAL_LOOP_UNROLL)
 					{
+						const int rowPixelOffset = binPixelX - rowBinPixelXStart;
+
 						// Frame buffer slice for this set of pixels.
 						int frameBufferPixelX[TYPICAL_LOOP_UNROLL];
 						int frameBufferPixelIndex[TYPICAL_LOOP_UNROLL];
@@ -2849,100 +3288,26 @@ namespace
 						}
 
 						const int frameBufferSlicePixelIndex = frameBufferPixelIndex[0];
-						uint8_t *paletteIndexBufferSlice = g_paletteIndexBuffer + frameBufferSlicePixelIndex;
-						double *depthBufferSlice = g_depthBuffer + frameBufferSlicePixelIndex;
-						uint32_t *colorBufferSlice = g_colorBuffer + frameBufferSlicePixelIndex;
+						const uint8_t *paletteIndexBufferSlice = g_paletteIndexBuffer + frameBufferSlicePixelIndex;
 
 						// Coverage test (is pixel center in triangle?).
-						double frameBufferPercentX[TYPICAL_LOOP_UNROLL];
-						double pixelCenterX[TYPICAL_LOOP_UNROLL];
-						double pixelCenterPlane0DiffX[TYPICAL_LOOP_UNROLL];
-						double pixelCenterPlane1DiffX[TYPICAL_LOOP_UNROLL];
-						double pixelCenterPlane2DiffX[TYPICAL_LOOP_UNROLL];
-						double pixelCoverageDot0X[TYPICAL_LOOP_UNROLL];
-						double pixelCoverageDot1X[TYPICAL_LOOP_UNROLL];
-						double pixelCoverageDot2X[TYPICAL_LOOP_UNROLL];
-						double pixelCenterDot0[TYPICAL_LOOP_UNROLL];
-						double pixelCenterDot1[TYPICAL_LOOP_UNROLL];
-						double pixelCenterDot2[TYPICAL_LOOP_UNROLL];
-						bool isPixelCenterIn0[TYPICAL_LOOP_UNROLL];
-						bool isPixelCenterIn1[TYPICAL_LOOP_UNROLL];
-						bool isPixelCenterIn2[TYPICAL_LOOP_UNROLL];
+						RasterizerReal frameBufferPercentX[TYPICAL_LOOP_UNROLL];
+						RasterizerReal pixelCenterX[TYPICAL_LOOP_UNROLL];
 						bool isPixelCenterCovered[TYPICAL_LOOP_UNROLL];
 
 						for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
 						{
-							frameBufferPercentX[i] = (static_cast<double>(frameBufferPixelX[i]) + 0.50) * g_frameBufferWidthRealRecip;
+							frameBufferPercentX[i] = (static_cast<RasterizerReal>(frameBufferPixelX[i]) + half) * frameBufferWidthRealRecip;
 						}
 
 						for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
 						{
-							pixelCenterX[i] = frameBufferPercentX[i] * g_frameBufferWidthReal;
+							pixelCenterX[i] = frameBufferPercentX[i] * frameBufferWidthReal;
 						}
 
 						for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
 						{
-							pixelCenterPlane0DiffX[i] = pixelCenterX[i] - screenSpace0X;
-						}
-
-						for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
-						{
-							pixelCenterPlane1DiffX[i] = pixelCenterX[i] - screenSpace1X;
-						}
-
-						for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
-						{
-							pixelCenterPlane2DiffX[i] = pixelCenterX[i] - screenSpace2X;
-						}
-
-						for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
-						{
-							pixelCoverageDot0X[i] = pixelCenterPlane0DiffX[i] * screenSpace01PerpX;
-						}
-
-						for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
-						{
-							pixelCoverageDot1X[i] = pixelCenterPlane1DiffX[i] * screenSpace12PerpX;
-						}
-
-						for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
-						{
-							pixelCoverageDot2X[i] = pixelCenterPlane2DiffX[i] * screenSpace20PerpX;
-						}
-
-						for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
-						{
-							pixelCenterDot0[i] = pixelCoverageDot0X[i] + pixelCoverageDot0Y[yUnrollIndex];
-						}
-
-						for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
-						{
-							pixelCenterDot1[i] = pixelCoverageDot1X[i] + pixelCoverageDot1Y[yUnrollIndex];
-						}
-
-						for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
-						{
-							pixelCenterDot2[i] = pixelCoverageDot2X[i] + pixelCoverageDot2Y[yUnrollIndex];
-						}
-
-						for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
-						{
-							isPixelCenterIn0[i] = pixelCenterDot0[i] >= 0.0;
-						}
-
-						for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
-						{
-							isPixelCenterIn1[i] = pixelCenterDot1[i] >= 0.0;
-						}
-
-						for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
-						{
-							isPixelCenterIn2[i] = pixelCenterDot2[i] >= 0.0;
-						}
-
-						for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
-						{
-							isPixelCenterCovered[i] = isPixelCenterIn0[i] && isPixelCenterIn1[i] && isPixelCenterIn2[i];
+							isPixelCenterCovered[i] = rowCoverageTests[rowPixelOffset + i] != 0;
 						}
 
 						totalCoverageTests += TYPICAL_LOOP_UNROLL;
@@ -3001,85 +3366,16 @@ namespace
 						}
 
 						// Depth test (is pixel center closer than depth buffer?).
-						double screenSpace0CurrentX[TYPICAL_LOOP_UNROLL];
-						double barycentricDot20X[TYPICAL_LOOP_UNROLL];
-						double barycentricDot21X[TYPICAL_LOOP_UNROLL];
-						double barycentricDot20[TYPICAL_LOOP_UNROLL];
-						double barycentricDot21[TYPICAL_LOOP_UNROLL];
-						double vNumerator[TYPICAL_LOOP_UNROLL];
-						double wNumerator[TYPICAL_LOOP_UNROLL];
-						double v[TYPICAL_LOOP_UNROLL];
-						double w[TYPICAL_LOOP_UNROLL];
-						double u[TYPICAL_LOOP_UNROLL];
-						double ndcZDepth[TYPICAL_LOOP_UNROLL];
+						const RasterizerReal *u = rowBarycentricUs + rowPixelOffset;
+						const RasterizerReal *v = rowBarycentricVs + rowPixelOffset;
+						const RasterizerReal *w = rowBarycentricWs + rowPixelOffset;
 						bool isPixelCenterDepthLower[TYPICAL_LOOP_UNROLL];
 
-						for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
-						{
-							screenSpace0CurrentX[i] = pixelCenterX[i] - screenSpace0X;
-						}
-
-						for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
-						{
-							barycentricDot20X[i] = screenSpace0CurrentX[i] * screenSpace01X;
-						}
-
-						for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
-						{
-							barycentricDot21X[i] = screenSpace0CurrentX[i] * screenSpace02X;
-						}
-
-						for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
-						{
-							barycentricDot20[i] = barycentricDot20X[i] + barycentricDot20Y[yUnrollIndex];
-						}
-
-						for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
-						{
-							barycentricDot21[i] = barycentricDot21X[i] + barycentricDot21Y[yUnrollIndex];
-						}
-
-						for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
-						{
-							vNumerator[i] = (barycentricDot11 * barycentricDot20[i]) - (barycentricDot01 * barycentricDot21[i]);
-						}
-
-						for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
-						{
-							wNumerator[i] = (barycentricDot00 * barycentricDot21[i]) - (barycentricDot01 * barycentricDot20[i]);
-						}
-
-						for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
-						{
-							v[i] = vNumerator[i] * barycentricDenominatorRecip;
-						}
-
-						for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
-						{
-							w[i] = wNumerator[i] * barycentricDenominatorRecip;
-						}
-
-						for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
-						{
-							u[i] = 1.0 - v[i] - w[i];
-						}
-
-						for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
-						{
-							ndcZDepth[i] = (ndc0Z * u[i]) + (ndc1Z * v[i]) + (ndc2Z * w[i]);
-						}
-
 						if constexpr (enableDepthRead)
 						{
-							double prevDepthBufferPixels[TYPICAL_LOOP_UNROLL];
 							for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
 							{
-								prevDepthBufferPixels[i] = depthBufferSlice[i];
-							}
-
-							for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
-							{
-								isPixelCenterDepthLower[i] = ndcZDepth[i] < prevDepthBufferPixels[i];
+								isPixelCenterDepthLower[i] = rowDepthTests[rowPixelOffset + i] != 0;
 							}
 
 							totalDepthTests += TYPICAL_LOOP_UNROLL;
@@ -3097,13 +3393,12 @@ namespace
 						}
 
 						// Texture lookup.
-						double shaderClipSpacePointX[TYPICAL_LOOP_UNROLL];
-						double shaderClipSpacePointY[TYPICAL_LOOP_UNROLL];
-						double shaderClipSpacePointZ[TYPICAL_LOOP_UNROLL];
-						double shaderClipSpacePointW[TYPICAL_LOOP_UNROLL];
-						double shaderClipSpacePointWRecip[TYPICAL_LOOP_UNROLL];
-						double perspectiveTexCoordU[TYPICAL_LOOP_UNROLL];
-						double perspectiveTexCoordV[TYPICAL_LOOP_UNROLL];
+						RasterizerReal shaderClipSpacePointX[TYPICAL_LOOP_UNROLL];
+						RasterizerReal shaderClipSpacePointY[TYPICAL_LOOP_UNROLL];
+						const RasterizerReal *shaderClipSpacePointZ = rowDepths + rowPixelOffset;
+						const RasterizerReal *shaderClipSpacePointWRecip = rowClipWRecips + rowPixelOffset;
+						RasterizerReal perspectiveTexCoordU[TYPICAL_LOOP_UNROLL];
+						RasterizerReal perspectiveTexCoordV[TYPICAL_LOOP_UNROLL];
 
 						for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
 						{
@@ -3117,45 +3412,30 @@ namespace
 
 						for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
 						{
-							shaderClipSpacePointZ[i] = (ndc0Z * u[i]) + (ndc1Z * v[i]) + (ndc2Z * w[i]);
-						}
-
-						for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
-						{
-							shaderClipSpacePointW[i] = (clip0WRecip * u[i]) + (clip1WRecip * v[i]) + (clip2WRecip * w[i]);
-						}
-
-						for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
-						{
-							shaderClipSpacePointWRecip[i] = 1.0 / shaderClipSpacePointW[i];
-						}
-
-						for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
-						{
-							perspectiveTexCoordU[i] = ((uv0XDivW * u[i]) + (uv1XDivW * v[i]) + (uv2XDivW * w[i])) * shaderClipSpacePointWRecip[i];
+							perspectiveTexCoordU[i] = rowPerspectiveTexCoordUs[rowPixelOffset + i];
 						}
 
 						for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
 						{
-							perspectiveTexCoordV[i] = ((uv0YDivW * u[i]) + (uv1YDivW * v[i]) + (uv2YDivW * w[i])) * shaderClipSpacePointWRecip[i];
+							perspectiveTexCoordV[i] = rowPerspectiveTexCoordVs[rowPixelOffset + i];
 						}
 
 						if constexpr (requiresVariableTexCoordUMin)
 						{
-							const double uMin = texCoordAnimPercent;
+							const RasterizerReal uMin = texCoordAnimPercent;
 
 							for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
 							{
-								perspectiveTexCoordU[i] = std::clamp(uMin + ((1.0 - uMin) * perspectiveTexCoordU[i]), uMin, 1.0);
+								perspectiveTexCoordU[i] = std::clamp(uMin + ((one - uMin) * perspectiveTexCoordU[i]), uMin, one);
 							}
 						}
 						else if (requiresVariableTexCoordVMin)
 						{
-							const double vMin = texCoordAnimPercent;
+							const RasterizerReal vMin = texCoordAnimPercent;
 
 							for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
 							{
-								perspectiveTexCoordV[i] = std::clamp(vMin + ((1.0 - vMin) * perspectiveTexCoordV[i]), vMin, 1.0);
+								perspectiveTexCoordV[i] = std::clamp(vMin + ((one - vMin) * perspectiveTexCoordV[i]), vMin, one);
 							}
 						}
 
@@ -3458,8 +3738,8 @@ namespace
 						if constexpr (requiresHorizonMirrorReflection)
 						{
 							// @todo: support camera roll
-							double reflectedScreenSpacePointX[TYPICAL_LOOP_UNROLL];
-							double reflectedScreenSpacePointY[TYPICAL_LOOP_UNROLL];
+							RasterizerReal reflectedScreenSpacePointX[TYPICAL_LOOP_UNROLL];
+							RasterizerReal reflectedScreenSpacePointY[TYPICAL_LOOP_UNROLL];
 							int reflectedPixelX[TYPICAL_LOOP_UNROLL];
 							int reflectedPixelY[TYPICAL_LOOP_UNROLL];
 
@@ -3575,50 +3855,100 @@ namespace
 							}
 						}
 
+						// Writes are deferred to the end of the row. A triangle covers each pixel at most once so
+						// nothing later in the row reads what this group would have written.
 						for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
 						{
-							if (isPixelCenterValid[i])
-							{
-								paletteIndexBufferSlice[i] = shadedTexel[i];
-								colorBufferSlice[i] = shaderPalette.colors[shadedTexel[i]];
-								totalColorWrites++;
+							rowValidPixels[rowPixelOffset + i] = isPixelCenterValid[i];
+						}
+
+						for (int i = 0; i < TYPICAL_LOOP_UNROLL; i++)
+						{
+							rowShadedTexels[rowPixelOffset + i] = shadedTexel[i];
+						}
 
-								if constexpr (enableDepthWrite)
+						rowHasValidPixels = true;
+					}
+
+					if (rowHasValidPixels)
+					{
+						rowResolveInput.pixelCount = rowPixelCount;
+
+						RasterizerRowResolveOutput rowResolveOutput;
+						rowResolveOutput.paletteIndexBuffer = g_paletteIndexBuffer + rowFrameBufferPixelIndex;
+						rowResolveOutput.colorBuffer = g_colorBuffer + rowFrameBufferPixelIndex;
+						rowResolveOutput.depthBuffer = enableDepthWrite ? (g_depthBuffer + rowFrameBufferPixelIndex) : nullptr;
+						totalColorWrites += g_rasterizerKernels->rowResolve(rowResolveInput, rowResolveOutput);
+
+						if constexpr (enableDepthWrite)
+						{
+							for (int depthTileX = firstVisibleDepthTileX; depthTileX <= lastVisibleDepthTileX; depthTileX++)
+							{
+								const int depthTileRowPixelStart = std::max((depthTileX * RASTERIZER_DEPTH_TILE_DIMENSION) - rowBinPixelXStart, 0);
+								const int depthTileRowPixelEnd = std::min(((depthTileX + 1) * RASTERIZER_DEPTH_TILE_DIMENSION) - rowBinPixelXStart, rowPixelCount);
+								const uint8_t *depthTileValidPixelsBegin = rowValidPixels + depthTileRowPixelStart;
+								const uint8_t *depthTileValidPixelsEnd = rowValidPixels + depthTileRowPixelEnd;
+								if (std::any_of(depthTileValidPixelsBegin, depthTileValidPixelsEnd, [](uint8_t isValid) { return isValid != 0; }))
 								{
-									depthBufferSlice[i] = ndcZDepth[i];
+									depthTileRowWrittenMask |= static_cast<uint64_t>(1) << depthTileX;
 								}
 							}
 						}
 					}
 				}
+
+				if constexpr (enableDepthWrite)
+				{
+					// Refresh written tiles once the triangle leaves their tile row.
+					const int nextBinPixelY = binPixelY + TYPICAL_LOOP_UNROLL;
+					const bool isDepthTileRowDone = ((nextBinPixelY % RASTERIZER_DEPTH_TILE_DIMENSION) == 0) || (nextBinPixelY >= binPixelYUnrollAdjustedEnd);
+					if (isDepthTileRowDone && (depthTileRowWrittenMask != 0))
+					{
+						for (uint64_t writtenMask = depthTileRowWrittenMask; writtenMask != 0; writtenMask &= writtenMask - 1)
+						{
+							const int depthTileX = std::countr_zero(writtenMask);
+							g_depthTiles.updateTile(binX, binY, depthTileX, depthTileY);
+						}
+
+						depthTileRowWrittenMask = 0;
+						hasBinDepthChanged = true;
+					}
+				}
+			}
+
+			if (hasBinDepthChanged)
+			{
+				g_depthTiles.updateBin(binIndex);
 			}
 		}
 
 		g_totalCoverageTests += totalCoverageTests;
 		g_totalDepthTests += totalDepthTests;
 		g_totalColorWrites += totalColorWrites;
+		g_totalHiZRejectedTriangles += totalHiZRejectedTriangles;
+		g_totalHiZRejectedTiles += totalHiZRejectedTiles;
 	}
 
 	template<RenderLightingType lightingType, FragmentShaderType fragmentShaderType, bool enableDepthRead, bool enableDepthWrite>
-	void RasterizeMeshDispatchDitheringMode(const DrawCallCache &drawCallCache, const RasterizerInputCache &rasterizerInputCache, const RasterizerBin &bin,
+	void RasterizeMeshDispatchDitheringMode(const DrawCallCache &drawCallCache, const RasterizerInputCache &rasterizerInputCache,
 		const RasterizerBinEntry &binEntry, int binX, int binY, int binIndex)
 	{
 		switch (g_ditheringMode)
 		{
 		case DitheringMode::None:
-			RasterizeMeshInternal<lightingType, fragmentShaderType, enableDepthRead, enableDepthWrite, DitheringMode::None>(drawCallCache, rasterizerInputCache, bin, binEntry, binX, binY, binIndex);
+			RasterizeMeshInternal<lightingType, fragmentShaderType, enableDepthRead, enableDepthWrite, DitheringMode::None>(drawCallCache, rasterizerInputCache, binEntry, binX, binY, binIndex);
 			break;
 		case DitheringMode::Classic:
-			RasterizeMeshInternal<lightingType, fragmentShaderType, enableDepthRead, enableDepthWrite, DitheringMode::Classic>(drawCallCache, rasterizerInputCache, bin, binEntry, binX, binY, binIndex);
+			RasterizeMeshInternal<lightingType, fragmentShaderType, enableDepthRead, enableDepthWrite, DitheringMode::Classic>(drawCallCache, rasterizerInputCache, binEntry, binX, binY, binIndex);
 			break;
 		case DitheringMode::Modern:
-			RasterizeMeshInternal<lightingType, fragmentShaderType, enableDepthRead, enableDepthWrite, DitheringMode::Modern>(drawCallCache, rasterizerInputCache, bin, binEntry, binX, binY, binIndex);
+			RasterizeMeshInternal<lightingType, fragmentShaderType, enableDepthRead, enableDepthWrite, DitheringMode::Modern>(drawCallCache, rasterizerInputCache, binEntry, binX, binY, binIndex);
 			break;
 		}
 	}
 
 	template<RenderLightingType lightingType, FragmentShaderType fragmentShaderType>
-	void RasterizeMeshDispatchDepthToggles(const DrawCallCache &drawCallCache, const RasterizerInputCache &rasterizerInputCache, const RasterizerBin &bin,
+	void RasterizeMeshDispatchDepthToggles(const DrawCallCache &drawCallCache, const RasterizerInputCache &rasterizerInputCache,
 		const RasterizerBinEntry &binEntry, int binX, int binY, int binIndex)
 	{
 		const bool enableDepthRead = drawCallCache.enableDepthRead;
@@ -3628,28 +3958,28 @@ namespace
 		{
 			if (enableDepthWrite)
 			{
-				RasterizeMeshDispatchDitheringMode<lightingType, fragmentShaderType, true, true>(drawCallCache, rasterizerInputCache, bin, binEntry, binX, binY, binIndex);
+				RasterizeMeshDispatchDitheringMode<lightingType, fragmentShaderType, true, true>(drawCallCache, rasterizerInputCache, binEntry, binX, binY, binIndex);
 			}
 			else
 			{
-				RasterizeMeshDispatchDitheringMode<lightingType, fragmentShaderType, true, false>(drawCallCache, rasterizerInputCache, bin, binEntry, binX, binY, binIndex);
+				RasterizeMeshDispatchDitheringMode<lightingType, fragmentShaderType, true, false>(drawCallCache, rasterizerInputCache, binEntry, binX, binY, binIndex);
 			}
 		}
 		else
 		{
 			if (enableDepthWrite)
 			{
-				RasterizeMeshDispatchDitheringMode<lightingType, fragmentShaderType, false, true>(drawCallCache, rasterizerInputCache, bin, binEntry, binX, binY, binIndex);
+				RasterizeMeshDispatchDitheringMode<lightingType, fragmentShaderType, false, true>(drawCallCache, rasterizerInputCache, binEntry, binX, binY, binIndex);
 			}
 			else
 			{
-				RasterizeMeshDispatchDitheringMode<lightingType, fragmentShaderType, false, false>(drawCallCache, rasterizerInputCache, bin, binEntry, binX, binY, binIndex);
+				RasterizeMeshDispatchDitheringMode<lightingType, fragmentShaderType, false, false>(drawCallCache, rasterizerInputCache, binEntry, binX, binY, binIndex);
 			}
 		}
 	}
 
 	template<RenderLightingType lightingType>
-	void RasterizeMeshDispatchFragmentShaderType(const DrawCallCache &drawCallCache, const RasterizerInputCache &rasterizerInputCache, const RasterizerBin &bin,
+	void RasterizeMeshDispatchFragmentShaderType(const DrawCallCache &drawCallCache, const RasterizerInputCache &rasterizerInputCache,
 		const RasterizerBinEntry &binEntry, int binX, int binY, int binIndex)
 	{
 		static_assert(FragmentShaderType::AlphaTestedWithHorizonMirrorSecondPass == OBJECT_FRAGMENT_SHADER_TYPE_MAX);
@@ -3658,46 +3988,46 @@ namespace
 		switch (fragmentShaderType)
 		{
 		case FragmentShaderType::Opaque:
-			RasterizeMeshDispatchDepthToggles<lightingType, FragmentShaderType::Opaque>(drawCallCache, rasterizerInputCache, bin, binEntry, binX, binY, binIndex);
+			RasterizeMeshDispatchDepthToggles<lightingType, FragmentShaderType::Opaque>(drawCallCache, rasterizerInputCache, binEntry, binX, binY, binIndex);
 			break;
 		case FragmentShaderType::OpaqueWithAlphaTestLayer:
-			RasterizeMeshDispatchDepthToggles<lightingType, FragmentShaderType::OpaqueWithAlphaTestLayer>(drawCallCache, rasterizerInputCache, bin, binEntry, binX, binY, binIndex);
+			RasterizeMeshDispatchDepthToggles<lightingType, FragmentShaderType::OpaqueWithAlphaTestLayer>(drawCallCache, rasterizerInputCache, binEntry, binX, binY, binIndex);
 			break;
 		case FragmentShaderType::OpaqueScreenSpaceAnimation:
-			RasterizeMeshDispatchDepthToggles<lightingType, FragmentShaderType::OpaqueScreenSpaceAnimation>(drawCallCache, rasterizerInputCache, bin, binEntry, binX, binY, binIndex);
+			RasterizeMeshDispatchDepthToggles<lightingType, FragmentShaderType::OpaqueScreenSpaceAnimation>(drawCallCache, rasterizerInputCache, binEntry, binX, binY, binIndex);
 			break;
 		case FragmentShaderType::OpaqueScreenSpaceAnimationWithAlphaTestLayer:
-			RasterizeMeshDispatchDepthToggles<lightingType, FragmentShaderType::OpaqueScreenSpaceAnimationWithAlphaTestLayer>(drawCallCache, rasterizerInputCache, bin, binEntry, binX, binY, binIndex);
+			RasterizeMeshDispatchDepthToggles<lightingType, FragmentShaderType::OpaqueScreenSpaceAnimationWithAlphaTestLayer>(drawCallCache, rasterizerInputCache, binEntry, binX, binY, binIndex);
 			break;
 		case FragmentShaderType::AlphaTested:
-			RasterizeMeshDispatchDepthToggles<lightingType, FragmentShaderType::AlphaTested>(drawCallCache, rasterizerInputCache, bin, binEntry, binX, binY, binIndex);
+			RasterizeMeshDispatchDepthToggles<lightingType, FragmentShaderType::AlphaTested>(drawCallCache, rasterizerInputCache, binEntry, binX, binY, binIndex);
 			break;
 		case FragmentShaderType::AlphaTestedWithVariableTexCoordUMin:
-			RasterizeMeshDispatchDepthToggles<lightingType, FragmentShaderType::AlphaTestedWithVariableTexCoordUMin>(drawCallCache, rasterizerInputCache, bin, binEntry, binX, binY, binIndex);
+			RasterizeMeshDispatchDepthToggles<lightingType, FragmentShaderType::AlphaTestedWithVariableTexCoordUMin>(drawCallCache, rasterizerInputCache, binEntry, binX, binY, binIndex);
 			break;
 		case FragmentShaderType::AlphaTestedWithVariableTexCoordVMin:
-			RasterizeMeshDispatchDepthToggles<lightingType, FragmentShaderType::AlphaTestedWithVariableTexCoordVMin>(drawCallCache, rasterizerInputCache, bin, binEntry, binX, binY, binIndex);
+			RasterizeMeshDispatchDepthToggles<lightingType, FragmentShaderType::AlphaTestedWithVariableTexCoordVMin>(drawCallCache, rasterizerInputCache, binEntry, binX, binY, binIndex);
 			break;
 		case FragmentShaderType::AlphaTestedWithPaletteIndexLookup:
-			RasterizeMeshDispatchDepthToggles<lightingType, FragmentShaderType::AlphaTestedWithPaletteIndexLookup>(drawCallCache, rasterizerInputCache, bin, binEntry, binX, binY, binIndex);
+			RasterizeMeshDispatchDepthToggles<lightingType, FragmentShaderType::AlphaTestedWithPaletteIndexLookup>(drawCallCache, rasterizerInputCache, binEntry, binX, binY, binIndex);
 			break;
 		case FragmentShaderType::AlphaTestedWithLightLevelOpacity:
-			RasterizeMeshDispatchDepthToggles<lightingType, FragmentShaderType::AlphaTestedWithLightLevelOpacity>(drawCallCache, rasterizerInputCache, bin, binEntry, binX, binY, binIndex);
+			RasterizeMeshDispatchDepthToggles<lightingType, FragmentShaderType::AlphaTestedWithLightLevelOpacity>(drawCallCache, rasterizerInputCache, binEntry, binX, binY, binIndex);
 			break;
 		case FragmentShaderType::AlphaTestedWithPreviousBrightnessLimit:
-			RasterizeMeshDispatchDepthToggles<lightingType, FragmentShaderType::AlphaTestedWithPreviousBrightnessLimit>(drawCallCache, rasterizerInputCache, bin, binEntry, binX, binY, binIndex);
+			RasterizeMeshDispatchDepthToggles<lightingType, FragmentShaderType::AlphaTestedWithPreviousBrightnessLimit>(drawCallCache, rasterizerInputCache, binEntry, binX, binY, binIndex);
 			break;
 		case FragmentShaderType::AlphaTestedWithHorizonMirrorFirstPass:
-			RasterizeMeshDispatchDepthToggles<lightingType, FragmentShaderType::AlphaTestedWithHorizonMirrorFirstPass>(drawCallCache, rasterizerInputCache, bin, binEntry, binX, binY, binIndex);
+			RasterizeMeshDispatchDepthToggles<lightingType, FragmentShaderType::AlphaTestedWithHorizonMirrorFirstPass>(drawCallCache, rasterizerInputCache, binEntry, binX, binY, binIndex);
 			break;
 		case FragmentShaderType::AlphaTestedWithHorizonMirrorSecondPass:
-			RasterizeMeshDispatchDepthToggles<lightingType, FragmentShaderType::AlphaTestedWithHorizonMirrorSecondPass>(drawCallCache, rasterizerInputCache, bin, binEntry, binX, binY, binIndex);
+			RasterizeMeshDispatchDepthToggles<lightingType, FragmentShaderType::AlphaTestedWithHorizonMirrorSecondPass>(drawCallCache, rasterizerInputCache, binEntry, binX, binY, binIndex);
 			break;
 		}
 	}
 
 	// Decides which optimized rasterizer variant to use based on the parameters.
-	void RasterizeMesh(const DrawCallCache &drawCallCache, const RasterizerInputCache &rasterizerInputCache, const RasterizerBin &bin,
+	void RasterizeMesh(const DrawCallCache &drawCallCache, const RasterizerInputCache &rasterizerInputCache,
 		const RasterizerBinEntry &binEntry, int binX, int binY, int binIndex)
 	{
 		static_assert(RenderLightingType::PerPixel == RENDER_LIGHTING_TYPE_MAX);
@@ -3706,10 +4036,10 @@ namespace
 		switch (lightingType)
 		{
 		case RenderLightingType::PerMesh:
-			RasterizeMeshDispatchFragmentShaderType<RenderLightingType::PerMesh>(drawCallCache, rasterizerInputCache, bin, binEntry, binX, binY, binIndex);
+			RasterizeMeshDispatchFragmentShaderType<RenderLightingType::PerMesh>(drawCallCache, rasterizerInputCache, binEntry, binX, binY, binIndex);
 			break;
 		case RenderLightingType::PerPixel:
-			RasterizeMeshDispatchFragmentShaderType<RenderLightingType::PerPixel>(drawCallCache, rasterizerInputCache, bin, binEntry, binX, binY, binIndex);
+			RasterizeMeshDispatchFragmentShaderType<RenderLightingType::PerPixel>(drawCallCache, rasterizerInputCache, binEntry, binX, binY, binIndex);
 			break;
 		}
 	}
@@ -3720,8 +4050,6 @@ namespace
 {
 	struct Worker
 	{
-		std::thread thread;
-
 		DrawCallCache drawCallCaches[MAX_WORKER_DRAW_CALLS_PER_LOOP];
 		TransformCache transformCaches[MAX_WORKER_DRAW_CALLS_PER_LOOP];
 		int drawCallStartIndex, drawCallCount;
@@ -3730,134 +4058,292 @@ namespace
 		VertexShaderOutputCache vertexShaderOutputCache;
 		ClippingOutputCache clippingOutputCache;
 		RasterizerInputCache rasterizerInputCache;
-		std::vector<RasterizerWorkItem> rasterizerWorkItems;
-		bool isReadyToStartWork, shouldExit, shouldWorkOnDrawCalls, shouldClearFrameBuffer, isFinishedWithDrawCalls, shouldWorkOnRasterizing, isFinishedRasterizing;
+		RasterizerWorkQueue rasterizerWorkQueue; // Indices into the scheduled rasterizer work items.
+	};
+
+	// Range of draw calls in one command list entry that workers process and rasterize together.
+	struct DrawCallBatch
+	{
+		Span<const RenderDrawCall> drawCalls;
+		int startDrawCallIndex;
+		int drawCallCount;
+
+		DrawCallBatch(Span<const RenderDrawCall> drawCalls, int startDrawCallIndex, int drawCallCount)
+			: drawCalls(drawCalls)
+		{
+			this->startDrawCallIndex = startDrawCallIndex;
+			this->drawCallCount = drawCallCount;
+		}
 	};
 
 	Buffer<Worker> g_workers;
-	std::mutex g_mutex;
-	std::condition_variable g_workerCondVar, g_directorCondVar;
+	JobSystem g_jobSystem; // Runs worker jobs on (worker count - 1) threads plus the thread submitting the frame.
+	JobGraph g_frameJobGraph;
+	std::vector<DrawCallBatch> g_drawCallBatches;
+
+	std::vector<RasterizerWorkItem> g_rasterizerWorkItems; // Non-empty bins for the current rasterization pass, grouped by owning worker.
+	double g_workerFrameSeconds = 0.0; // Wall time of running this frame's jobs, for deriving idle time.
 
-	void WorkerFunc(int workerIndex)
+	double GetSecondsSince(std::chrono::high_resolution_clock::time_point startTime)
 	{
-		Worker &worker = g_workers.get(workerIndex);
-		std::unique_lock<std::mutex> workerLock(g_mutex);
+		const auto duration = std::chrono::high_resolution_clock::now() - startTime;
+		return std::chrono::duration<double>(duration).count();
+	}
 
-		while (true)
-		{
-			worker.isReadyToStartWork = true;
-			g_directorCondVar.notify_one();
-			g_workerCondVar.wait(workerLock, [&worker]() { return worker.shouldExit || worker.shouldWorkOnDrawCalls; });
-			workerLock.unlock();
+	void PopulateDrawCallBatches(const RenderCommandList &commandList)
+	{
+		constexpr int maxDrawCallsPerBatch = 8192;
+		static_assert(maxDrawCallsPerBatch <= MAX_WORKER_DRAW_CALLS_PER_LOOP);
 
-			if (worker.shouldExit)
+		g_drawCallBatches.clear();
+		for (int commandIndex = 0; commandIndex < commandList.entryCount; commandIndex++)
+		{
+			const Span<const RenderDrawCall> drawCalls = commandList.entries[commandIndex];
+			int startDrawCallIndex = 0;
+			int remainingDrawCallCount = drawCalls.getCount();
+			while (remainingDrawCallCount > 0)
 			{
-				break;
+				const int drawCallsToConsume = std::min(maxDrawCallsPerBatch, remainingDrawCallCount);
+				g_drawCallBatches.emplace_back(drawCalls, startDrawCallIndex, drawCallsToConsume);
+				startDrawCallIndex += drawCallsToConsume;
+				remainingDrawCallCount -= drawCallsToConsume;
 			}
+		}
+	}
 
-			for (int drawCallIndex = 0; drawCallIndex < worker.drawCallCount; drawCallIndex++)
-			{
-				DebugAssertIndex(worker.drawCallCaches, drawCallIndex);
-				const DrawCallCache &drawCallCache = worker.drawCallCaches[drawCallIndex];
-				TransformCache &transformCache = worker.transformCaches[drawCallIndex];
-				VertexShaderInputCache &vertexShaderInputCache = worker.vertexShaderInputCache;
-				VertexShaderOutputCache &vertexShaderOutputCache = worker.vertexShaderOutputCache;
-				ClippingOutputCache &clippingOutputCache = worker.clippingOutputCache;
-				RasterizerInputCache &rasterizerInputCache = worker.rasterizerInputCache;
-
-				ProcessMeshBufferLookups(drawCallCache, vertexShaderInputCache);
-				CalculateVertexShaderTransforms(transformCache);
-				ProcessVertexShaders(drawCallCache.vertexShaderType, transformCache, vertexShaderInputCache, vertexShaderOutputCache);
-				ProcessClipping(drawCallCache, vertexShaderOutputCache, clippingOutputCache);
-				ProcessClipSpaceTrianglesForBinning(drawCallIndex, drawCallCache.enableBackFaceCulling, clippingOutputCache, rasterizerInputCache);
-			}
+	void PopulateWorkerDrawCallWorkload(int workerIndex, const DrawCallBatch &batch)
+	{
+		const int workerCount = g_workers.getCount();
+		const int baseDrawCallsPerWorker = batch.drawCallCount / workerCount;
+		const int workersWithExtraDrawCall = batch.drawCallCount % workerCount;
+
+		Worker &worker = g_workers[workerIndex];
+		worker.drawCallStartIndex = batch.startDrawCallIndex + (workerIndex * baseDrawCallsPerWorker) + std::min(workerIndex, workersWithExtraDrawCall);
+		worker.drawCallCount = baseDrawCallsPerWorker + ((workerIndex < workersWithExtraDrawCall) ? 1 : 0);
+		DebugAssert((worker.drawCallStartIndex + worker.drawCallCount) <= (batch.startDrawCallIndex + batch.drawCallCount));
+	}
 
-			// Clear screen before rasterization sync as frame buffer rows are faster than bin rows.
-			if (worker.shouldClearFrameBuffer)
+	// Gives the worker's draw calls the data they need from renderer resources.
+	void PopulateWorkerDrawCallCaches(Worker &worker, Span<const RenderDrawCall> drawCalls)
+	{
+		for (int workerDrawCallIndex = 0; workerDrawCallIndex < worker.drawCallCount; workerDrawCallIndex++)
+		{
+			const int globalDrawCallIndex = worker.drawCallStartIndex + workerDrawCallIndex;
+			const RenderDrawCall &drawCall = drawCalls[globalDrawCallIndex];
+
+			DebugAssertIndex(worker.drawCallCaches, workerDrawCallIndex);
+			DrawCallCache &workerDrawCallCache = worker.drawCallCaches[workerDrawCallIndex];
+			TransformCache &workerTransformCache = worker.transformCaches[workerDrawCallIndex];
+			auto &drawCallCachePositionBuffer = workerDrawCallCache.positionBuffer;
+			auto &drawCallCacheTexCoordBuffer = workerDrawCallCache.texCoordBuffer;
+			auto &drawCallCacheIndexBuffer = workerDrawCallCache.indexBuffer;
+			ObjectTextureID &drawCallCacheTextureID0 = workerDrawCallCache.textureID0;
+			ObjectTextureID &drawCallCacheTextureID1 = workerDrawCallCache.textureID1;
+			RenderLightingType &drawCallCacheLightingType = workerDrawCallCache.lightingType;
+			double &drawCallCacheMeshLightPercent = workerDrawCallCache.meshLightPercent;
+			VertexShaderType &drawCallCacheVertexShaderType = workerDrawCallCache.vertexShaderType;
+			FragmentShaderType &drawCallCacheFragmentShaderType = workerDrawCallCache.fragmentShaderType;
+			double &drawCallCacheTexCoordAnimPercent = workerDrawCallCache.texCoordAnimPercent;
+			bool &drawCallCacheEnableBackFaceCulling = workerDrawCallCache.enableBackFaceCulling;
+			bool &drawCallCacheEnableDepthRead = workerDrawCallCache.enableDepthRead;
+			bool &drawCallCacheEnableDepthWrite = workerDrawCallCache.enableDepthWrite;
+
+			const SoftwareUniformBuffer &transformBuffer = g_uniformBuffers->get(drawCall.transformBufferID);
+			const Matrix4d &modelMatrix = transformBuffer.get<Matrix4d>(drawCall.transformIndex);
+			PopulateMeshTransform(workerTransformCache, modelMatrix);
+
+			drawCallCachePositionBuffer = &g_positionBuffers->get(drawCall.positionBufferID);
+			drawCallCacheTexCoordBuffer = &g_attributeBuffers->get(drawCall.texCoordBufferID);
+			drawCallCacheIndexBuffer = &g_indexBuffers->get(drawCall.indexBufferID);
+
+			const SoftwareMaterial &material = g_materials->get(drawCall.materialID);
+			drawCallCacheTextureID0 = material.textureIDs[0];
+			drawCallCacheTextureID1 = material.textureIDs[1];
+			drawCallCacheLightingType = material.lightingType;
+			drawCallCacheMeshLightPercent = 0.0;
+			drawCallCacheVertexShaderType = material.vertexShaderType;
+			drawCallCacheFragmentShaderType = material.fragmentShaderType;
+			drawCallCacheTexCoordAnimPercent = 0.0;
+			drawCallCacheEnableBackFaceCulling = material.enableBackFaceCulling;
+			drawCallCacheEnableDepthRead = material.enableDepthRead;
+			drawCallCacheEnableDepthWrite = material.enableDepthWrite;
+
+			if (drawCall.materialInstID >= 0)
 			{
-				// Determine rows to clear.
-				const std::div_t frameBufferClearRowsDiv = std::div(g_frameBufferHeight, g_workers.getCount());
-				const int frameBufferClearRowsPerWorker = frameBufferClearRowsDiv.quot;
-				const int frameBufferClearRowsRemainder = frameBufferClearRowsDiv.rem;
-				const int frameBufferClearStartY = (workerIndex * frameBufferClearRowsPerWorker) + std::min(workerIndex, frameBufferClearRowsRemainder);
-				const int frameBufferClearRowCount = frameBufferClearRowsPerWorker + (workerIndex < frameBufferClearRowsRemainder ? 1 : 0);
-
-				// Don't have to clear color buffer since there's always a sky mesh.
-				double *depthBufferClearStart = g_depthBuffer + (frameBufferClearStartY * g_frameBufferWidth);
-				double *depthBufferClearEnd = depthBufferClearStart + (frameBufferClearRowCount * g_frameBufferWidth);
-				std::fill(depthBufferClearStart, depthBufferClearEnd, std::numeric_limits<double>::infinity());
+				const SoftwareMaterialInstance &materialInst = g_materialInsts->get(drawCall.materialInstID);
+				drawCallCacheMeshLightPercent = materialInst.meshLightPercent;
+				drawCallCacheTexCoordAnimPercent = materialInst.texCoordAnimPercent;
 			}
+		}
+	}
+
+	// Geometry job. Transforms, clips, and bins the worker's share of the batch's draw calls.
+	void ProcessWorkerDrawCalls(int workerIndex, int batchIndex)
+	{
+		DebugAssertIndex(g_drawCallBatches, batchIndex);
+		const DrawCallBatch &batch = g_drawCallBatches[batchIndex];
+		const auto startTime = std::chrono::high_resolution_clock::now();
 
-			// Populate light bins associated with this worker.
-			const int lightBinCountX = g_lightBins.getWidth();
-			const int lightBinCountY = g_lightBins.getHeight();
-			const int lightBinCount = lightBinCountX * lightBinCountY;
-			const int firstLightBinIndex = workerIndex;
-			const int lightBinIndexDelta = g_workers.getCount();
-			for (int lightBinIndex = firstLightBinIndex; lightBinIndex < lightBinCount; lightBinIndex += lightBinIndexDelta)
+		Worker &worker = g_workers.get(workerIndex);
+		worker.rasterizerInputCache.clearTriangles();
+		worker.rasterizerInputCache.emptyBins();
+		PopulateWorkerDrawCallWorkload(workerIndex, batch);
+		PopulateWorkerDrawCallCaches(worker, batch.drawCalls);
+
+		const int drawCallCount = worker.drawCallCount;
+		for (int drawCallIndex = 0; drawCallIndex < drawCallCount; drawCallIndex++)
+		{
+			DebugAssertIndex(worker.transformCaches, drawCallIndex);
+			CalculateVertexShaderTransforms(worker.transformCaches[drawCallIndex]);
+		}
+
+		VertexShaderInputCache &vertexShaderInputCache = worker.vertexShaderInputCache;
+		VertexShaderOutputCache &vertexShaderOutputCache = worker.vertexShaderOutputCache;
+		ClippingOutputCache &clippingOutputCache = worker.clippingOutputCache;
+		RasterizerInputCache &rasterizerInputCache = worker.rasterizerInputCache;
+
+		// Shade many draw calls' triangles at once since most meshes are only a couple triangles.
+		int64_t geometryTriangleCount = 0;
+		int drawCallIndex = 0;
+		while (drawCallIndex < drawCallCount)
+		{
+			drawCallIndex = ProcessMeshBufferLookups(worker.drawCallCaches, drawCallIndex, drawCallCount, vertexShaderInputCache);
+			ProcessVertexShaders(worker.transformCaches, vertexShaderInputCache, vertexShaderOutputCache);
+
+			int clipTriangleIndex = 0;
+			while (clipTriangleIndex < vertexShaderOutputCache.triangleWriteCount)
 			{
-				const int lightBinX = lightBinIndex % lightBinCountX;
-				const int lightBinY = lightBinIndex / lightBinCountX;
-				PopulateLightBin(lightBinX, lightBinY, g_camera, g_frameBufferWidth, g_frameBufferHeight);
+				clipTriangleIndex = ProcessClipping(clipTriangleIndex, vertexShaderInputCache, vertexShaderOutputCache, clippingOutputCache);
+				ProcessClipSpaceTrianglesForBinning(worker.drawCallCaches, clippingOutputCache, rasterizerInputCache);
 			}
 
-			workerLock.lock();
-			worker.isFinishedWithDrawCalls = true;
-			g_directorCondVar.notify_one();
-			g_workerCondVar.wait(workerLock, [&worker]() { return worker.shouldWorkOnRasterizing; });
-			workerLock.unlock();
+			geometryTriangleCount += vertexShaderInputCache.triangleCount;
+		}
+
+		g_totalGeometryTriangleCount += geometryTriangleCount;
+		g_totalGeometrySeconds += GetSecondsSince(startTime);
+	}
+
+	// Depth clear job, once per frame. Frame buffer rows are split evenly between workers.
+	void ClearWorkerDepthBufferRows(int workerIndex)
+	{
+		const std::div_t frameBufferClearRowsDiv = std::div(g_frameBufferHeight, g_workers.getCount());
+		const int frameBufferClearRowsPerWorker = frameBufferClearRowsDiv.quot;
+		const int frameBufferClearRowsRemainder = frameBufferClearRowsDiv.rem;
+		const int frameBufferClearStartY = (workerIndex * frameBufferClearRowsPerWorker) + std::min(workerIndex, frameBufferClearRowsRemainder);
+		const int frameBufferClearRowCount = frameBufferClearRowsPerWorker + (workerIndex < frameBufferClearRowsRemainder ? 1 : 0);
+
+		// Don't have to clear color buffer since there's always a sky mesh.
+		RasterizerReal *depthBufferClearStart = g_depthBuffer + (frameBufferClearStartY * g_frameBufferWidth);
+		RasterizerReal *depthBufferClearEnd = depthBufferClearStart + (frameBufferClearRowCount * g_frameBufferWidth);
+		std::fill(depthBufferClearStart, depthBufferClearEnd, std::numeric_limits<RasterizerReal>::infinity());
+	}
 
-			// Use the geometry processing results of all workers to rasterize this worker's bins. The order of workers is assumed to be
-			// the same that draw calls were originally processed, otherwise triangles in each bin would be rasterized in the wrong order.
-			for (const RasterizerWorkItem &workItem : worker.rasterizerWorkItems)
+	// Light binning job, once per frame since lights don't change between batches.
+	void PopulateWorkerLightBins(int workerIndex)
+	{
+		const int lightBinCountX = g_lightBins.getWidth();
+		const int lightBinCountY = g_lightBins.getHeight();
+		const int lightBinCount = lightBinCountX * lightBinCountY;
+		const int firstLightBinIndex = workerIndex;
+		const int lightBinIndexDelta = g_workers.getCount();
+		for (int lightBinIndex = firstLightBinIndex; lightBinIndex < lightBinCount; lightBinIndex += lightBinIndexDelta)
+		{
+			const int lightBinX = lightBinIndex % lightBinCountX;
+			const int lightBinY = lightBinIndex / lightBinCountX;
+			PopulateLightBin(lightBinX, lightBinY, g_camera, g_frameBufferWidth, g_frameBufferHeight);
+		}
+	}
+
+	// Rasterizes every worker's triangles in the bin. The order of workers is assumed to be the same that draw calls were
+	// originally processed, otherwise triangles in each bin would be rasterized in the wrong order.
+	void RasterizeBin(const RasterizerWorkItem &workItem)
+	{
+		const int binX = workItem.binX;
+		const int binY = workItem.binY;
+		for (const Worker &geometryWorker : g_workers)
+		{
+			if (geometryWorker.drawCallCount > 0)
 			{
-				const int binX = workItem.binX;
-				const int binY = workItem.binY;
-				for (const Worker &geometryWorker : g_workers)
+				const RasterizerBin &geometryWorkerBin = geometryWorker.rasterizerInputCache.bins.get(binX, binY);
+				for (const RasterizerBinChunk *binChunk = geometryWorkerBin.firstChunk; binChunk != nullptr; binChunk = binChunk->next)
 				{
-					if (geometryWorker.drawCallCount > 0)
+					int chunkTriangleIndex = 0;
+					while (chunkTriangleIndex < binChunk->triangleCount)
 					{
-						const RasterizerBin &geometryWorkerBin = geometryWorker.rasterizerInputCache.bins.get(binX, binY);
-						for (int entryIndex = 0; entryIndex < geometryWorkerBin.entryCount; entryIndex++)
-						{
-							const RasterizerBinEntry &binEntry = geometryWorkerBin.entries[entryIndex];
-							const int workerDrawCallIndex = binEntry.workerDrawCallIndex;
-							DebugAssertIndex(geometryWorker.drawCallCaches, workerDrawCallIndex);
-							const DrawCallCache &drawCallCache = geometryWorker.drawCallCaches[workerDrawCallIndex];
-							const RasterizerInputCache &rasterizerInputCache = geometryWorker.rasterizerInputCache;
-							RasterizeMesh(drawCallCache, rasterizerInputCache, geometryWorkerBin, binEntry, binX, binY, workItem.binIndex);
-						}
+						const int chunkTriangleEndIndex = binChunk->getDrawCallRunEndIndex(chunkTriangleIndex);
+
+						RasterizerBinEntry binEntry;
+						binEntry.workerDrawCallIndex = binChunk->triangles[chunkTriangleIndex].workerDrawCallIndex;
+						binEntry.triangles = binChunk->triangles + chunkTriangleIndex;
+						binEntry.triangleCount = chunkTriangleEndIndex - chunkTriangleIndex;
+
+						const int workerDrawCallIndex = binEntry.workerDrawCallIndex;
+						DebugAssertIndex(geometryWorker.drawCallCaches, workerDrawCallIndex);
+						const DrawCallCache &drawCallCache = geometryWorker.drawCallCaches[workerDrawCallIndex];
+						const RasterizerInputCache &rasterizerInputCache = geometryWorker.rasterizerInputCache;
+						RasterizeMesh(drawCallCache, rasterizerInputCache, binEntry, binX, binY, workItem.binIndex);
+
+						chunkTriangleIndex = chunkTriangleEndIndex;
 					}
 				}
 			}
-
-			workerLock.lock();
-			worker.isFinishedRasterizing = true;
 		}
 	}
 
-	void SignalWorkersToExitAndJoin()
+	// Rasterization job. Takes the worker's bins most expensive first, then helps workers still behind.
+	void RasterizeWorkerBins(int workerIndex)
 	{
-		std::unique_lock<std::mutex> lock(g_mutex);
-		for (Worker &worker : g_workers)
+		Worker &worker = g_workers.get(workerIndex);
+		int workItemIndex;
+		while (worker.rasterizerWorkQueue.tryPopFront(&workItemIndex))
 		{
-			worker.shouldExit = true;
+			DebugAssertIndex(g_rasterizerWorkItems, workItemIndex);
+			RasterizeBin(g_rasterizerWorkItems[workItemIndex]);
 		}
 
-		g_workerCondVar.notify_all();
-		lock.unlock();
+		// Steal the cheapest remaining bins. Queues only shrink during a pass.
+		const int workerCount = g_workers.getCount();
+		for (int i = 1; i < workerCount; i++)
+		{
+			Worker &victimWorker = g_workers[(workerIndex + i) % workerCount];
+			while (victimWorker.rasterizerWorkQueue.trySteal(&workItemIndex))
+			{
+				DebugAssertIndex(g_rasterizerWorkItems, workItemIndex);
+				RasterizeBin(g_rasterizerWorkItems[workItemIndex]);
+			}
+		}
+	}
+
+	// Adds one job per worker after the given job (if any) and returns a barrier job that finishes after all of them.
+	template<typename WorkerJobFunc>
+	int AddWorkerJobs(JobGraph &jobGraph, int dependencyJobID, WorkerJobFunc func)
+	{
+		const int workerCount = g_workers.getCount();
+		const int firstJobID = jobGraph.getJobCount();
+		for (int workerIndex = 0; workerIndex < workerCount; workerIndex++)
+		{
+			const int jobID = jobGraph.addJob([func, workerIndex]() { func(workerIndex); });
+			if (dependencyJobID >= 0)
+			{
+				jobGraph.addDependency(jobID, dependencyJobID);
+			}
+		}
 
-		for (Worker &worker : g_workers)
+		const int barrierJobID = jobGraph.addBarrier();
+		for (int jobID = firstJobID; jobID < (firstJobID + workerCount); jobID++)
 		{
-			worker.thread.join();
+			jobGraph.addDependency(barrierJobID, jobID);
 		}
+
+		return barrierJobID;
 	}
 
 	void InitializeWorkers(int workerCount, int frameBufferWidth, int frameBufferHeight)
 	{
 		if (g_workers.getCount() != workerCount)
 		{
-			SignalWorkersToExitAndJoin();
+			g_jobSystem.init(workerCount - 1);
 
 			g_workers.init(workerCount);
 			for (int workerIndex = 0; workerIndex < workerCount; workerIndex++)
@@ -3866,70 +4352,206 @@ namespace
 				worker.drawCallStartIndex = -1;
 				worker.drawCallCount = 0;
 				worker.rasterizerInputCache.createBins(frameBufferWidth, frameBufferHeight);
-				worker.isReadyToStartWork = false;
-				worker.shouldExit = false;
-				worker.shouldWorkOnDrawCalls = false;
-				worker.shouldClearFrameBuffer = false;
-				worker.isFinishedWithDrawCalls = false;
-				worker.shouldWorkOnRasterizing = false;
-				worker.isFinishedRasterizing = false;
-				worker.thread = std::thread(WorkerFunc, workerIndex);
 			}
 		}
+	}
 
-		for (Worker &worker : g_workers)
-		{
-			worker.rasterizerWorkItems.clear();
-		}
-
+	// Sorts non-empty bins by estimated cost and deals them out so each worker starts on its most expensive bins.
+	// Must run after every geometry job of the batch and before any of its rasterization jobs.
+	void PopulateRasterizerWorkQueues()
+	{
 		const Worker &firstWorker = g_workers.get(0);
 		const int binCountX = firstWorker.rasterizerInputCache.binCountX;
 		const int binCountY = firstWorker.rasterizerInputCache.binCountY;
 
-		// Split up rasterizer bins across workers.
-		int curWorkerIndex = 0;
+		std::vector<RasterizerWorkItem> sortedWorkItems;
+		sortedWorkItems.reserve(binCountX * binCountY);
 		for (int binY = 0; binY < binCountY; binY++)
 		{
 			for (int binX = 0; binX < binCountX; binX++)
 			{
-				const int binIndex = binX + (binY * binCountX);
-				Worker &worker = g_workers[curWorkerIndex];
-				worker.rasterizerWorkItems.emplace_back(binX, binY, binIndex);
-				curWorkerIndex = (curWorkerIndex + 1) % workerCount;
+				int triangleCount = 0;
+				for (const Worker &worker : g_workers)
+				{
+					triangleCount += worker.rasterizerInputCache.bins.get(binX, binY).triangleCount;
+				}
+
+				if (triangleCount > 0)
+				{
+					const int binIndex = binX + (binY * binCountX);
+					sortedWorkItems.emplace_back(binX, binY, binIndex, triangleCount);
+				}
 			}
 		}
+
+		std::stable_sort(sortedWorkItems.begin(), sortedWorkItems.end(),
+			[](const RasterizerWorkItem &a, const RasterizerWorkItem &b)
+		{
+			return a.triangleCount > b.triangleCount;
+		});
+
+		// Worker N owns sorted items N, N + workerCount, ... stored contiguously.
+		const int workerCount = g_workers.getCount();
+		const int workItemCount = static_cast<int>(sortedWorkItems.size());
+		g_rasterizerWorkItems.clear();
+		g_rasterizerWorkItems.reserve(workItemCount);
+		for (int workerIndex = 0; workerIndex < workerCount; workerIndex++)
+		{
+			const int workerStartIndex = static_cast<int>(g_rasterizerWorkItems.size());
+			for (int sortedIndex = workerIndex; sortedIndex < workItemCount; sortedIndex += workerCount)
+			{
+				g_rasterizerWorkItems.emplace_back(sortedWorkItems[sortedIndex]);
+			}
+
+			const int workerEndIndex = static_cast<int>(g_rasterizerWorkItems.size());
+			g_workers[workerIndex].rasterizerWorkQueue.reset(workerStartIndex, workerEndIndex);
+		}
+
+		for (const Worker &worker : g_workers)
+		{
+			g_totalPresentedTriangleCount += worker.rasterizerInputCache.triangleCount;
+		}
 	}
 
-	void PopulateWorkerDrawCallWorkloads(int workerCount, int startDrawCallIndex, int drawCallCount)
+	// Builds the whole frame as one job graph so phases are separated by dependency counts instead of thread
+	// round trips. Geometry of a batch reuses worker caches, so it waits for the previous batch's rasterization.
+	void PopulateFrameJobGraph(JobGraph &jobGraph)
 	{
-		const int baseDrawCallsPerWorker = drawCallCount / workerCount;
-		const int workersWithExtraDrawCall = drawCallCount % workerCount;
+		jobGraph.clear();
 
-		int workerStartDrawCallIndex = startDrawCallIndex;
-		for (int i = 0; i < workerCount; i++)
+		// Once per frame, only needed before the first rasterization.
+		const int depthClearBarrierJobID = AddWorkerJobs(jobGraph, -1, [](int workerIndex) { ClearWorkerDepthBufferRows(workerIndex); });
+		const int lightBinBarrierJobID = AddWorkerJobs(jobGraph, -1, [](int workerIndex) { PopulateWorkerLightBins(workerIndex); });
+
+		int rasterizationBarrierJobID = -1;
+		const int batchCount = static_cast<int>(g_drawCallBatches.size());
+		for (int batchIndex = 0; batchIndex < batchCount; batchIndex++)
 		{
-			Worker &worker = g_workers[i];
-			worker.drawCallStartIndex = workerStartDrawCallIndex;
-			worker.drawCallCount = baseDrawCallsPerWorker;
+			const int geometryBarrierJobID = AddWorkerJobs(jobGraph, rasterizationBarrierJobID,
+				[batchIndex](int workerIndex) { ProcessWorkerDrawCalls(workerIndex, batchIndex); });
 
-			if (i < workersWithExtraDrawCall)
+			const int scheduleJobID = jobGraph.addJob([]() { PopulateRasterizerWorkQueues(); });
+			jobGraph.addDependency(scheduleJobID, geometryBarrierJobID);
+			if (batchIndex == 0)
 			{
-				worker.drawCallCount++;
+				jobGraph.addDependency(scheduleJobID, depthClearBarrierJobID);
+				jobGraph.addDependency(scheduleJobID, lightBinBarrierJobID);
 			}
 
-			workerStartDrawCallIndex += worker.drawCallCount;
+			rasterizationBarrierJobID = AddWorkerJobs(jobGraph, scheduleJobID, [](int workerIndex) { RasterizeWorkerBins(workerIndex); });
 		}
-
-		DebugAssert((workerStartDrawCallIndex - startDrawCallIndex) == drawCallCount);
 	}
 
 	void ShutdownWorkers()
 	{
-		SignalWorkersToExitAndJoin();
+		g_jobSystem.shutdown();
 		g_workers.clear();
 	}
 }
 
+// Pipelined frames.
+namespace
+{
+	// Everything below except the thread state is owned by the frame thread while a frame is in flight.
+	std::thread g_frameThread;
+	std::mutex g_frameMutex;
+	std::condition_variable g_frameCondVar;
+	bool g_isFrameInFlight = false;
+	bool g_shouldFrameThreadExit = false;
+	bool g_hasPipelinedFrameOutput = false;
+
+	// Copies of per-frame data that the caller is free to change once the frame is submitted.
+	std::vector<RenderDrawCall> g_pipelinedDrawCalls;
+	RenderCommandList g_pipelinedCommandList;
+	RenderCamera g_pipelinedCamera;
+	RenderFrameSettings g_pipelinedFrameSettings;
+	SoftwareUniformBufferPool g_pipelinedUniformBuffers;
+	SoftwareMaterialInstancePool g_pipelinedMaterialInsts;
+
+	Buffer2D<uint32_t> g_pipelinedColorBuffer;
+	RendererProfilerData3D g_pipelinedProfilerData; // Stats of the last finished pipelined frame.
+
+	bool IsFrameThreadRunning()
+	{
+		return g_frameThread.joinable();
+	}
+
+	void WaitForPipelinedFrame()
+	{
+		if (!IsFrameThreadRunning())
+		{
+			return;
+		}
+
+		std::unique_lock<std::mutex> lock(g_frameMutex);
+		g_frameCondVar.wait(lock, []() { return !g_isFrameInFlight; });
+	}
+
+	void ShutdownFrameThread()
+	{
+		if (!IsFrameThreadRunning())
+		{
+			return;
+		}
+
+		WaitForPipelinedFrame();
+
+		std::unique_lock<std::mutex> lock(g_frameMutex);
+		g_shouldFrameThreadExit = true;
+		lock.unlock();
+		g_frameCondVar.notify_all();
+
+		g_frameThread.join();
+		g_shouldFrameThreadExit = false;
+		g_hasPipelinedFrameOutput = false;
+	}
+
+	void PopulatePipelinedCommandList(const RenderCommandList &commandList)
+	{
+		g_pipelinedDrawCalls.clear();
+		for (int entryIndex = 0; entryIndex < commandList.entryCount; entryIndex++)
+		{
+			const Span<const RenderDrawCall> drawCalls = commandList.entries[entryIndex];
+			g_pipelinedDrawCalls.insert(g_pipelinedDrawCalls.end(), drawCalls.begin(), drawCalls.end());
+		}
+
+		// Same entry boundaries as the original list, done after copying since the vector may have reallocated.
+		g_pipelinedCommandList = RenderCommandList();
+		int drawCallOffset = 0;
+		for (int entryIndex = 0; entryIndex < commandList.entryCount; entryIndex++)
+		{
+			const int drawCallCount = commandList.entries[entryIndex].getCount();
+			g_pipelinedCommandList.addDrawCalls(Span<const RenderDrawCall>(g_pipelinedDrawCalls.data() + drawCallOffset, drawCallCount));
+			drawCallOffset += drawCallCount;
+		}
+	}
+
+	// Reuses the destination's allocations since most uniform buffers keep their size from frame to frame.
+	void PopulatePipelinedUniformBuffers(const SoftwareUniformBufferPool &uniformBuffers)
+	{
+		g_pipelinedUniformBuffers.keys = uniformBuffers.keys;
+		g_pipelinedUniformBuffers.valueIndices = uniformBuffers.valueIndices;
+		g_pipelinedUniformBuffers.freedKeys = uniformBuffers.freedKeys;
+		g_pipelinedUniformBuffers.values.resize(uniformBuffers.values.size());
+
+		for (int i = 0; i < uniformBuffers.getCount(); i++)
+		{
+			const SoftwareUniformBuffer &srcBuffer = uniformBuffers.values[i];
+			SoftwareUniformBuffer &dstBuffer = g_pipelinedUniformBuffers.values[i];
+			const bool isSameLayout = (dstBuffer.elementCount == srcBuffer.elementCount) &&
+				(dstBuffer.bytesPerElement == srcBuffer.bytesPerElement) &&
+				(dstBuffer.alignmentOfElement == srcBuffer.alignmentOfElement) &&
+				(dstBuffer.bytes.getCount() == srcBuffer.bytes.getCount());
+			if (!isSameLayout)
+			{
+				dstBuffer.init(srcBuffer.elementCount, srcBuffer.bytesPerElement, srcBuffer.alignmentOfElement);
+			}
+
+			std::copy(srcBuffer.begin(), srcBuffer.end(), dstBuffer.begin());
+		}
+	}
+}
+
 SoftwareObjectTexture::SoftwareObjectTexture()
 {
 	this->texels8Bit = nullptr;
@@ -4148,6 +4770,9 @@ bool SoftwareRenderer::init(const RenderInitSettings &initSettings)
 	this->paletteIndexBuffer.init(frameBufferWidth, frameBufferHeight);
 	this->depthBuffer.init(frameBufferWidth, frameBufferHeight);
 
+	g_rasterizerKernels = &SoftwareRasterizerKernels::select();
+	DebugLogFormat("Using %s rasterizer kernels.", g_rasterizerKernels->name);
+
 	const int workerCount = RendererUtils::getRenderThreadsFromMode(initSettings.renderThreadsMode);
 	InitializeWorkers(workerCount, frameBufferWidth, frameBufferHeight);
 
@@ -4156,6 +4781,13 @@ bool SoftwareRenderer::init(const RenderInitSettings &initSettings)
 
 void SoftwareRenderer::shutdown()
 {
+	ShutdownFrameThread();
+	g_pipelinedDrawCalls.clear();
+	g_pipelinedCommandList = RenderCommandList();
+	g_pipelinedUniformBuffers.clear();
+	g_pipelinedMaterialInsts.clear();
+	g_pipelinedColorBuffer.clear();
+
 	this->paletteIndexBuffer.clear();
 	this->depthBuffer.clear();
 	this->positionBuffers.clear();
@@ -4175,11 +4807,14 @@ bool SoftwareRenderer::isInited() const
 
 void SoftwareRenderer::resize(int width, int height)
 {
+	WaitForPipelinedFrame();
+	g_hasPipelinedFrameOutput = false;
+
 	this->paletteIndexBuffer.init(width, height);
 	this->paletteIndexBuffer.fill(0);
 
 	this->depthBuffer.init(width, height);
-	this->depthBuffer.fill(std::numeric_limits<double>::infinity());
+	this->depthBuffer.fill(std::numeric_limits<RasterizerReal>::infinity());
 
 	for (Worker &worker : g_workers)
 	{
@@ -4187,7 +4822,7 @@ void SoftwareRenderer::resize(int width, int height)
 	}
 }
 
-RendererProfilerData3D SoftwareRenderer::getProfilerData() const
+RendererProfilerData3D SoftwareRenderer::makeProfilerData() const
 {
 	RendererProfilerData3D profilerData;
 	profilerData.width = this->paletteIndexBuffer.getWidth();
@@ -4207,10 +4842,37 @@ RendererProfilerData3D SoftwareRenderer::getProfilerData() const
 	profilerData.totalCoverageTests = g_totalCoverageTests;
 	profilerData.totalDepthTests = g_totalDepthTests;
 	profilerData.totalColorWrites = g_totalColorWrites;
+	profilerData.totalHiZRejectedTriangles = g_totalHiZRejectedTriangles;
+	profilerData.totalHiZRejectedTiles = g_totalHiZRejectedTiles;
+	profilerData.geometryTriangleCount = g_totalGeometryTriangleCount;
+	profilerData.geometrySeconds = g_totalGeometrySeconds;
+
+	// Job system threads plus the thread that submitted the frame.
+	const int jobThreadCount = (g_workers.getCount() > 0) ? (g_jobSystem.getThreadCount() + 1) : 0;
+	profilerData.threadBusySeconds.resize(jobThreadCount);
+	profilerData.threadIdleSeconds.resize(jobThreadCount);
+	for (int i = 0; i < jobThreadCount; i++)
+	{
+		const double busySeconds = g_jobSystem.getThreadBusySeconds(i);
+		profilerData.threadBusySeconds[i] = busySeconds;
+		profilerData.threadIdleSeconds[i] = std::max(g_workerFrameSeconds - busySeconds, 0.0);
+	}
 
 	return profilerData;
 }
 
+RendererProfilerData3D SoftwareRenderer::getProfilerData() const
+{
+	if (IsFrameThreadRunning())
+	{
+		// The frame in flight is still writing the counters.
+		std::lock_guard<std::mutex> lock(g_frameMutex);
+		return g_pipelinedProfilerData;
+	}
+
+	return this->makeProfilerData();
+}
+
 int SoftwareRenderer::getBytesPerFloat() const
 {
 	return sizeof(double);
@@ -4218,6 +4880,8 @@ int SoftwareRenderer::getBytesPerFloat() const
 
 VertexPositionBufferID SoftwareRenderer::createVertexPositionBuffer(int vertexCount, int componentsPerVertex, int bytesPerComponent)
 {
+	WaitForPipelinedFrame();
+
 	DebugAssert(vertexCount > 0);
 	DebugAssert(componentsPerVertex >= 2);
 	DebugAssert(bytesPerComponent == sizeof(double));
@@ -4236,11 +4900,14 @@ VertexPositionBufferID SoftwareRenderer::createVertexPositionBuffer(int vertexCo
 
 void SoftwareRenderer::freeVertexPositionBuffer(VertexPositionBufferID id)
 {
+	WaitForPipelinedFrame();
 	this->positionBuffers.free(id);
 }
 
 LockedBuffer SoftwareRenderer::lockVertexPositionBuffer(VertexPositionBufferID id)
 {
+	WaitForPipelinedFrame();
+
 	SoftwareVertexPositionBuffer &buffer = this->positionBuffers.get(id);
 	const int elementCount = buffer.positions.getCount();
 	const int bytesPerElement = sizeof(double);
@@ -4256,6 +4923,8 @@ void SoftwareRenderer::unlockVertexPositionBuffer(VertexPositionBufferID id)
 
 VertexAttributeBufferID SoftwareRenderer::createVertexAttributeBuffer(int vertexCount, int componentsPerVertex, int bytesPerComponent)
 {
+	WaitForPipelinedFrame();
+
 	DebugAssert(vertexCount > 0);
 	DebugAssert(componentsPerVertex >= 2);
 	DebugAssert(bytesPerComponent == sizeof(double));
@@ -4274,11 +4943,14 @@ VertexAttributeBufferID SoftwareRenderer::createVertexAttributeBuffer(int vertex
 
 void SoftwareRenderer::freeVertexAttributeBuffer(VertexAttributeBufferID id)
 {
+	WaitForPipelinedFrame();
 	this->attributeBuffers.free(id);
 }
 
 LockedBuffer SoftwareRenderer::lockVertexAttributeBuffer(VertexAttributeBufferID id)
 {
+	WaitForPipelinedFrame();
+
 	SoftwareVertexAttributeBuffer &buffer = this->attributeBuffers.get(id);
 	const int elementCount = buffer.attributes.getCount();
 	const int bytesPerElement = sizeof(double);
@@ -4294,6 +4966,8 @@ void SoftwareRenderer::unlockVertexAttributeBuffer(VertexAttributeBufferID id)
 
 IndexBufferID SoftwareRenderer::createIndexBuffer(int indexCount, int bytesPerIndex)
 {
+	WaitForPipelinedFrame();
+
 	DebugAssert(indexCount > 0);
 	DebugAssert((indexCount % 3) == 0);
 	DebugAssert(bytesPerIndex == sizeof(int32_t));
@@ -4312,11 +4986,14 @@ IndexBufferID SoftwareRenderer::createIndexBuffer(int indexCount, int bytesPerIn
 
 void SoftwareRenderer::freeIndexBuffer(IndexBufferID id)
 {
+	WaitForPipelinedFrame();
 	this->indexBuffers.free(id);
 }
 
 LockedBuffer SoftwareRenderer::lockIndexBuffer(IndexBufferID id)
 {
+	WaitForPipelinedFrame();
+
 	SoftwareIndexBuffer &buffer = this->indexBuffers.get(id);
 	const int elementCount = buffer.indices.getCount();
 	const int bytesPerElement = sizeof(int32_t);
@@ -4387,6 +5064,8 @@ void SoftwareRenderer::unlockUniformBufferIndex(UniformBufferID id, int index)
 
 ObjectTextureID SoftwareRenderer::createTexture(int width, int height, int bytesPerTexel)
 {
+	WaitForPipelinedFrame();
+
 	const ObjectTextureID textureID = this->objectTextures.alloc();
 	if (textureID < 0)
 	{
@@ -4401,6 +5080,7 @@ ObjectTextureID SoftwareRenderer::createTexture(int width, int height, int bytes
 
 void SoftwareRenderer::freeTexture(ObjectTextureID textureID)
 {
+	WaitForPipelinedFrame();
 	this->objectTextures.free(textureID);
 }
 
@@ -4412,6 +5092,8 @@ std::optional<Int2> SoftwareRenderer::tryGetTextureDims(ObjectTextureID id) cons
 
 LockedTexture SoftwareRenderer::lockTexture(ObjectTextureID textureID)
 {
+	WaitForPipelinedFrame();
+
 	SoftwareObjectTexture &texture = this->objectTextures.get(textureID);
 	const int byteCount = texture.width * texture.height * texture.bytesPerTexel;
 	return LockedTexture(Span<std::byte>(texture.texels.begin(), byteCount), texture.width, texture.height, texture.bytesPerTexel);
@@ -4425,6 +5107,8 @@ void SoftwareRenderer::unlockTexture(ObjectTextureID textureID)
 
 RenderMaterialID SoftwareRenderer::createMaterial(RenderMaterialKey key)
 {
+	WaitForPipelinedFrame();
+
 	const RenderMaterialID materialID = this->materials.alloc();
 	if (materialID < 0)
 	{
@@ -4439,6 +5123,7 @@ RenderMaterialID SoftwareRenderer::createMaterial(RenderMaterialKey key)
 
 void SoftwareRenderer::freeMaterial(RenderMaterialID id)
 {
+	WaitForPipelinedFrame();
 	this->materials.free(id);
 }
 
@@ -4483,21 +5168,22 @@ void SoftwareRenderer::setMaterialInstanceTexCoordAnimPercent(RenderMaterialInst
 	inst->texCoordAnimPercent = value;
 }
 
-void SoftwareRenderer::submitFrame(const RenderCommandList &commandList, const RenderCamera &camera,
-	const RenderFrameSettings &settings, uint32_t *outputBuffer)
+void SoftwareRenderer::renderFrame(const RenderCommandList &commandList, const RenderCamera &camera, const RenderFrameSettings &settings,
+	const SoftwareUniformBufferPool &uniformBuffers, const SoftwareMaterialInstancePool &materialInsts, uint32_t *outputBuffer)
 {
 	const int totalDrawCallCount = commandList.getTotalDrawCallCount();
 	const int frameBufferWidth = this->paletteIndexBuffer.getWidth();
 	const int frameBufferHeight = this->paletteIndexBuffer.getHeight();
 
-	const SoftwareUniformBuffer &visibleLights = this->uniformBuffers.get(settings.visibleLightsBufferID);
+	const SoftwareUniformBuffer &visibleLights = uniformBuffers.get(settings.visibleLightsBufferID);
 	const SoftwareObjectTexture &paletteTexture = this->objectTextures.get(settings.paletteTextureID);
 	const SoftwareObjectTexture &lightTableTexture = this->objectTextures.get(settings.lightTableTextureID);
 	const SoftwareObjectTexture &ditherTexture = this->objectTextures.get(settings.ditherTextureID);
 	const SoftwareObjectTexture &skyBgTexture = this->objectTextures.get(settings.skyBgTextureID);
 
 	PopulateCameraGlobals(camera);
-	PopulateDrawCallGlobals(totalDrawCallCount);
+	PopulateDrawCallGlobals(totalDrawCallCount, &this->positionBuffers, &this->attributeBuffers, &this->indexBuffers,
+		&uniformBuffers, &this->materials, &materialInsts);
 	PopulateRasterizerGlobals(frameBufferWidth, frameBufferHeight, this->paletteIndexBuffer.begin(), this->depthBuffer.begin(),
 		settings.ditheringMode, outputBuffer, &this->objectTextures);
 	PopulateVisibleLights(visibleLights, settings.visibleLightCount);
@@ -4508,141 +5194,96 @@ void SoftwareRenderer::submitFrame(const RenderCommandList &commandList, const R
 	const int totalWorkerCount = RendererUtils::getRenderThreadsFromMode(settings.renderThreadsMode);
 	InitializeWorkers(totalWorkerCount, frameBufferWidth, frameBufferHeight);
 
+	// Depth buffer is cleared by the first jobs of the frame.
+	g_depthTiles.init(frameBufferWidth, frameBufferHeight);
+	g_depthTiles.clear(frameBufferWidth, frameBufferHeight);
+
 	ClearTriangleTotalCounts();
 	ClearFrameBufferOperationCounts();
 
-	bool shouldWorkersClearFrameBuffer = true; // Once per frame.
-	std::unique_lock<std::mutex> lock(g_mutex);
+	PopulateDrawCallBatches(commandList);
+	PopulateFrameJobGraph(g_frameJobGraph);
 
-	for (int commandIndex = 0; commandIndex < commandList.entryCount; commandIndex++)
-	{
-		const Span<const RenderDrawCall> drawCalls = commandList.entries[commandIndex];
-		int startDrawCallIndex = 0;
-		int remainingDrawCallCount = drawCalls.getCount();
-		constexpr int maxDrawCallsPerLoop = 8192;
-		static_assert(maxDrawCallsPerLoop <= MAX_WORKER_DRAW_CALLS_PER_LOOP);
+	const auto workStartTime = std::chrono::high_resolution_clock::now();
+	g_jobSystem.run(g_frameJobGraph);
+	g_workerFrameSeconds = GetSecondsSince(workStartTime);
+}
+
+void SoftwareRenderer::frameThreadLoop()
+{
+	std::unique_lock<std::mutex> lock(g_frameMutex);
 
-		while (remainingDrawCallCount > 0)
+	while (true)
+	{
+		g_frameCondVar.wait(lock, []() { return g_isFrameInFlight || g_shouldFrameThreadExit; });
+		if (g_shouldFrameThreadExit)
 		{
-			// Wait for all workers to be ready to process this set of draw calls.
-			g_directorCondVar.wait(lock, []()
-			{
-				return std::all_of(g_workers.begin(), g_workers.end(), [](const Worker &worker) { return worker.isReadyToStartWork; });
-			});
+			break;
+		}
 
-			for (Worker &worker : g_workers)
-			{
-				DebugAssert(!worker.shouldExit);
-				DebugAssert(!worker.shouldWorkOnDrawCalls);
-				DebugAssert(!worker.shouldClearFrameBuffer);
-				DebugAssert(!worker.isFinishedWithDrawCalls);
-				DebugAssert(!worker.shouldWorkOnRasterizing);
-				DebugAssert(!worker.isFinishedRasterizing);
-				worker.isReadyToStartWork = false;
-				worker.rasterizerInputCache.clearTriangles();
-				worker.rasterizerInputCache.emptyBins();
-			}
+		lock.unlock();
 
-			// Determine which workers get which draw calls this loop.
-			const int drawCallsToConsume = std::min(maxDrawCallsPerLoop, remainingDrawCallCount);
-			PopulateWorkerDrawCallWorkloads(totalWorkerCount, startDrawCallIndex, drawCallsToConsume);
+		this->renderFrame(g_pipelinedCommandList, g_pipelinedCamera, g_pipelinedFrameSettings, g_pipelinedUniformBuffers,
+			g_pipelinedMaterialInsts, g_pipelinedColorBuffer.begin());
+		const RendererProfilerData3D profilerData = this->makeProfilerData();
 
-			// Populate worker draw call caches so they have data to work with.
-			for (Worker &worker : g_workers)
-			{
-				for (int workerDrawCallIndex = 0; workerDrawCallIndex < worker.drawCallCount; workerDrawCallIndex++)
-				{
-					const int globalDrawCallIndex = worker.drawCallStartIndex + workerDrawCallIndex;
-					const RenderDrawCall &drawCall = drawCalls[globalDrawCallIndex];
-
-					DebugAssertIndex(worker.drawCallCaches, workerDrawCallIndex);
-					DrawCallCache &workerDrawCallCache = worker.drawCallCaches[workerDrawCallIndex];
-					TransformCache &workerTransformCache = worker.transformCaches[workerDrawCallIndex];
-					auto &drawCallCachePositionBuffer = workerDrawCallCache.positionBuffer;
-					auto &drawCallCacheTexCoordBuffer = workerDrawCallCache.texCoordBuffer;
-					auto &drawCallCacheIndexBuffer = workerDrawCallCache.indexBuffer;
-					ObjectTextureID &drawCallCacheTextureID0 = workerDrawCallCache.textureID0;
-					ObjectTextureID &drawCallCacheTextureID1 = workerDrawCallCache.textureID1;
-					RenderLightingType &drawCallCacheLightingType = workerDrawCallCache.lightingType;
-					double &drawCallCacheMeshLightPercent = workerDrawCallCache.meshLightPercent;
-					VertexShaderType &drawCallCacheVertexShaderType = workerDrawCallCache.vertexShaderType;
-					FragmentShaderType &drawCallCacheFragmentShaderType = workerDrawCallCache.fragmentShaderType;
-					double &drawCallCacheTexCoordAnimPercent = workerDrawCallCache.texCoordAnimPercent;
-					bool &drawCallCacheEnableBackFaceCulling = workerDrawCallCache.enableBackFaceCulling;
-					bool &drawCallCacheEnableDepthRead = workerDrawCallCache.enableDepthRead;
-					bool &drawCallCacheEnableDepthWrite = workerDrawCallCache.enableDepthWrite;
-
-					const SoftwareUniformBuffer &transformBuffer = this->uniformBuffers.get(drawCall.transformBufferID);
-					const Matrix4d &modelMatrix = transformBuffer.get<Matrix4d>(drawCall.transformIndex);
-					PopulateMeshTransform(workerTransformCache, modelMatrix);
-
-					drawCallCachePositionBuffer = &this->positionBuffers.get(drawCall.positionBufferID);
-					drawCallCacheTexCoordBuffer = &this->attributeBuffers.get(drawCall.texCoordBufferID);
-					drawCallCacheIndexBuffer = &this->indexBuffers.get(drawCall.indexBufferID);
-
-					const SoftwareMaterial &material = this->materials.get(drawCall.materialID);
-					drawCallCacheTextureID0 = material.textureIDs[0];
-					drawCallCacheTextureID1 = material.textureIDs[1];
-					drawCallCacheLightingType = material.lightingType;
-					drawCallCacheMeshLightPercent = 0.0;
-					drawCallCacheVertexShaderType = material.vertexShaderType;
-					drawCallCacheFragmentShaderType = material.fragmentShaderType;
-					drawCallCacheTexCoordAnimPercent = 0.0;
-					drawCallCacheEnableBackFaceCulling = material.enableBackFaceCulling;
-					drawCallCacheEnableDepthRead = material.enableDepthRead;
-					drawCallCacheEnableDepthWrite = material.enableDepthWrite;
-
-					if (drawCall.materialInstID >= 0)
-					{
-						const SoftwareMaterialInstance &materialInst = this->materialInsts.get(drawCall.materialInstID);
-						drawCallCacheMeshLightPercent = materialInst.meshLightPercent;
-						drawCallCacheTexCoordAnimPercent = materialInst.texCoordAnimPercent;
-					}
-				}
-			}
+		lock.lock();
+		g_pipelinedProfilerData = profilerData;
+		g_hasPipelinedFrameOutput = true;
+		g_isFrameInFlight = false;
+		g_frameCondVar.notify_all();
+	}
+}
 
-			for (Worker &worker : g_workers)
-			{
-				DebugAssert(!worker.shouldWorkOnDrawCalls);
-				worker.shouldWorkOnDrawCalls = true;
-				worker.shouldClearFrameBuffer = shouldWorkersClearFrameBuffer;
-			}
+void SoftwareRenderer::submitFrame(const RenderCommandList &commandList, const RenderCamera &camera,
+	const RenderFrameSettings &settings, uint32_t *outputBuffer)
+{
+	// Pipelining might have been turned off since the last frame.
+	ShutdownFrameThread();
 
-			g_workerCondVar.notify_all();
-			g_directorCondVar.wait(lock, []()
-			{
-				return std::all_of(g_workers.begin(), g_workers.end(), [](const Worker &worker) { return worker.isFinishedWithDrawCalls; });
-			});
+	this->renderFrame(commandList, camera, settings, this->uniformBuffers, this->materialInsts, outputBuffer);
+}
 
-			shouldWorkersClearFrameBuffer = false;
+void SoftwareRenderer::submitFramePipelined(const RenderCommandList &commandList, const RenderCamera &camera,
+	const RenderFrameSettings &settings)
+{
+	WaitForPipelinedFrame();
 
-			for (Worker &worker : g_workers)
-			{
-				DebugAssert(worker.shouldWorkOnDrawCalls);
-				DebugAssert(!worker.shouldWorkOnRasterizing);
-				DebugAssert(!worker.isFinishedRasterizing);
-				worker.shouldWorkOnDrawCalls = false;
-				worker.shouldClearFrameBuffer = false;
-				worker.shouldWorkOnRasterizing = true;
-				g_totalPresentedTriangleCount += worker.rasterizerInputCache.triangleCount;
-			}
+	const int frameBufferWidth = this->paletteIndexBuffer.getWidth();
+	const int frameBufferHeight = this->paletteIndexBuffer.getHeight();
+	if ((g_pipelinedColorBuffer.getWidth() != frameBufferWidth) || (g_pipelinedColorBuffer.getHeight() != frameBufferHeight))
+	{
+		g_pipelinedColorBuffer.init(frameBufferWidth, frameBufferHeight);
+	}
 
-			g_workerCondVar.notify_all();
-			g_directorCondVar.wait(lock, []()
-			{
-				return std::all_of(g_workers.begin(), g_workers.end(), [](const Worker &worker) { return worker.isFinishedRasterizing; });
-			});
+	PopulatePipelinedCommandList(commandList);
+	g_pipelinedCamera = camera;
+	g_pipelinedFrameSettings = settings;
+	PopulatePipelinedUniformBuffers(this->uniformBuffers);
+	g_pipelinedMaterialInsts = this->materialInsts;
 
-			// Reset workers for next frame.
-			for (Worker &worker : g_workers)
-			{
-				worker.isFinishedWithDrawCalls = false;
-				worker.shouldWorkOnRasterizing = false;
-				worker.isFinishedRasterizing = false;
-			}
+	if (!IsFrameThreadRunning())
+	{
+		g_frameThread = std::thread([this]() { this->frameThreadLoop(); });
+	}
 
-			startDrawCallIndex += drawCallsToConsume;
-			remainingDrawCallCount -= drawCallsToConsume;
-		}
+	std::unique_lock<std::mutex> lock(g_frameMutex);
+	g_isFrameInFlight = true;
+	g_hasPipelinedFrameOutput = false;
+	lock.unlock();
+	g_frameCondVar.notify_all();
+}
+
+bool SoftwareRenderer::tryCopyPipelinedFrame(uint32_t *outputBuffer)
+{
+	WaitForPipelinedFrame();
+
+	if (!g_hasPipelinedFrameOutput)
+	{
+		return false;
 	}
+
+	std::copy(g_pipelinedColorBuffer.begin(), g_pipelinedColorBuffer.end(), outputBuffer);
+	g_hasPipelinedFrameOutput = false;
+	return true;
 }
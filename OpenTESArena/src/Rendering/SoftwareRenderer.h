@@ -5,6 +5,7 @@
 #include <cstdint>
 
 #include "RenderLightUtils.h"
+#include "SoftwareRasterizerKernels.h"
 #include "../Math/MathUtils.h"
 #include "../Math/Matrix4.h"
 #include "../Math/Vector2.h"
@@ -155,7 +156,7 @@ class SoftwareRenderer
 {
 private:
 	Buffer2D<uint8_t> paletteIndexBuffer; // Intermediate buffer to support back-to-front transparencies.
-	Buffer2D<double> depthBuffer;
+	Buffer2D<RasterizerReal> depthBuffer;
 
 	SoftwareVertexPositionBufferPool positionBuffers;
 	SoftwareVertexAttributeBufferPool attributeBuffers;
@@ -164,6 +165,13 @@ private:
 	SoftwareObjectTexturePool objectTextures;
 	SoftwareMaterialPool materials;
 	SoftwareMaterialInstancePool materialInsts;
+
+	void renderFrame(const RenderCommandList &commandList, const RenderCamera &camera, const RenderFrameSettings &settings,
+		const SoftwareUniformBufferPool &uniformBuffers, const SoftwareMaterialInstancePool &materialInsts, uint32_t *outputBuffer);
+	RendererProfilerData3D makeProfilerData() const;
+
+	// Runs on the pipelined frame thread.
+	void frameThreadLoop();
 public:
 	SoftwareRenderer();
 	~SoftwareRenderer();
@@ -216,6 +224,15 @@ public:
 
 	void submitFrame(const RenderCommandList &commandList, const RenderCamera &camera,
 		const RenderFrameSettings &settings, uint32_t *outputBuffer);
+
+	// Starts rendering the frame on a background thread and returns immediately. The draw calls, camera, uniform
+	// buffers, and material instances are copied so they can be updated for the next frame right away. Any other
+	// resource change waits for the frame to finish.
+	void submitFramePipelined(const RenderCommandList &commandList, const RenderCamera &camera, const RenderFrameSettings &settings);
+
+	// Waits for the pipelined frame in flight and copies it to the output buffer. Returns false if there is no
+	// finished frame, i.e. nothing was submitted since the last call or the frame buffer was resized.
+	bool tryCopyPipelinedFrame(uint32_t *outputBuffer);
 };
 
 #endif
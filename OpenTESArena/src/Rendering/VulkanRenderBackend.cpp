@@ -6136,6 +6136,10 @@ void VulkanRenderBackend::submitFrame(const RenderCommandList &renderCommandList
 	this->profilerData3D.totalCoverageTests = 0;
 	this->profilerData3D.totalDepthTests = 0;
 	this->profilerData3D.totalColorWrites = 0;
+	this->profilerData3D.totalHiZRejectedTriangles = 0;
+	this->profilerData3D.totalHiZRejectedTiles = 0;
+	this->profilerData3D.geometryTriangleCount = 0;
+	this->profilerData3D.geometrySeconds = 0.0;
 }
 
 #endif
@@ -169,6 +169,24 @@ std::string Platform::getLogPath()
 	}
 }
 
+std::string Platform::getCachePath()
+{
+	// SDL_GetPrefPath() creates the desired folder if it doesn't exist.
+	char *cachePathPtr = SDL_GetPrefPath("OpenTESArena", "cache");
+
+	if (cachePathPtr == nullptr)
+	{
+		DebugLogWarning("SDL_GetPrefPath() not available on this platform.");
+		cachePathPtr = SDL_strdup("cache/");
+	}
+
+	const std::string cachePathString(cachePathPtr);
+	SDL_free(cachePathPtr);
+
+	// Convert Windows backslashes to forward slashes.
+	return String::replace(cachePathString, '\\', '/');
+}
+
 double Platform::getDefaultDPI()
 {
 	const std::string platform = Platform::getPlatform();
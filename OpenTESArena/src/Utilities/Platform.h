@@ -25,6 +25,9 @@ namespace Platform
 	// Gets the log folder path for logging program messages.
 	std::string getLogPath();
 
+	// Gets the folder path for files the engine regenerates as needed via SDL_GetPrefPath().
+	std::string getCachePath();
+
 	// Gets the default pixels-per-inch value from the OS.
 	double getDefaultDPI();
 
@@ -166,10 +166,10 @@ void VoxelBoxCombineChunk::init(const ChunkInt2 &position, int height)
 {
 	Chunk::init(position, height);
 
-	this->entryIDs.init(Chunk::WIDTH, height, Chunk::DEPTH);
+	this->entryIDs.initOrReuse(Chunk::WIDTH, height, Chunk::DEPTH);
 	this->entryIDs.fill(-1);
 
-	this->dirtyEntries.init(Chunk::WIDTH, height, Chunk::DEPTH);
+	this->dirtyEntries.initOrReuse(Chunk::WIDTH, height, Chunk::DEPTH);
 	this->dirtyEntries.fill(false);
 }
 
@@ -347,8 +347,6 @@ void VoxelBoxCombineChunk::update(Span<const VoxelInt3> dirtyVoxels, const Voxel
 void VoxelBoxCombineChunk::clear()
 {
 	Chunk::clear();
-	this->dirtyEntries.clear();
 	this->dirtyEntryPositions.clear();
 	this->combinedBoxesPool.clear();
-	this->entryIDs.clear();
 }
@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "VoxelBoxCombineChunkManager.h"
 #include "VoxelChunk.h"
 #include "VoxelChunkManager.h"
@@ -13,35 +15,56 @@ void VoxelBoxCombineChunkManager::updateActiveChunks(Span<const ChunkInt2> newCh
 
 	for (const ChunkInt2 chunkPos : newChunkPositions)
 	{
-		const int spawnIndex = this->spawnChunk();
+		const int spawnIndex = this->spawnChunk(chunkPos);
 		VoxelBoxCombineChunk &boxCombineChunk = this->getChunkAtIndex(spawnIndex);
 		const VoxelChunk &voxelChunk = voxelChunkManager.getChunkAtPosition(chunkPos);
 		boxCombineChunk.init(chunkPos, voxelChunk.height);
 	}
 
-	this->chunkPool.clear();
+	this->trimChunkPool();
 }
 
 void VoxelBoxCombineChunkManager::update(Span<const ChunkInt2> activeChunkPositions, Span<const ChunkInt2> newChunkPositions,
-	const VoxelChunkManager &voxelChunkManager)
+	const VoxelChunkManager &voxelChunkManager, JobSystem &jobSystem)
 {
+	// New chunks get job IDs matching their index in newChunkPositions.
+	this->jobGraph.clear();
 	for (const ChunkInt2 chunkPos : newChunkPositions)
 	{
 		VoxelBoxCombineChunk &boxCombineChunk = this->getChunkAtPosition(chunkPos);
 		const VoxelChunk &voxelChunk = voxelChunkManager.getChunkAtPosition(chunkPos);
-		Span<const VoxelInt3> dirtyVoxels = voxelChunk.dirtyShapeDefPositions;
-		boxCombineChunk.update(dirtyVoxels, voxelChunk);
+		this->jobGraph.addJob([&boxCombineChunk, &voxelChunk]()
+		{
+			Span<const VoxelInt3> dirtyVoxels = voxelChunk.dirtyShapeDefPositions;
+			boxCombineChunk.update(dirtyVoxels, voxelChunk);
+		});
 	}
 
 	for (const ChunkInt2 chunkPos : activeChunkPositions)
 	{
 		VoxelBoxCombineChunk &boxCombineChunk = this->getChunkAtPosition(chunkPos);
 		const VoxelChunk &voxelChunk = voxelChunkManager.getChunkAtPosition(chunkPos);
+		if (voxelChunk.dirtyShapeDefPositions.empty() && voxelChunk.dirtyFaceActivationPositions.empty())
+		{
+			continue;
+		}
 
-		// Rebuild combined boxes due to change in mesh.
-		Span<const VoxelInt3> dirtyShapeDefVoxels = voxelChunk.dirtyShapeDefPositions;
-		Span<const VoxelInt3> dirtyFaceActivationVoxels = voxelChunk.dirtyFaceActivationPositions;
-		boxCombineChunk.update(dirtyShapeDefVoxels, voxelChunk);
-		boxCombineChunk.update(dirtyFaceActivationVoxels, voxelChunk);
+		const int jobID = this->jobGraph.addJob([&boxCombineChunk, &voxelChunk]()
+		{
+			// Rebuild combined boxes due to change in mesh.
+			Span<const VoxelInt3> dirtyShapeDefVoxels = voxelChunk.dirtyShapeDefPositions;
+			Span<const VoxelInt3> dirtyFaceActivationVoxels = voxelChunk.dirtyFaceActivationPositions;
+			boxCombineChunk.update(dirtyShapeDefVoxels, voxelChunk);
+			boxCombineChunk.update(dirtyFaceActivationVoxels, voxelChunk);
+		});
+
+		const auto newChunkIter = std::find(newChunkPositions.begin(), newChunkPositions.end(), chunkPos);
+		if (newChunkIter != newChunkPositions.end())
+		{
+			this->jobGraph.addDependency(jobID, static_cast<int>(std::distance(newChunkPositions.begin(), newChunkIter)));
+		}
 	}
+
+	jobSystem.run(this->jobGraph);
+	this->jobGraph.clear();
 }
@@ -4,6 +4,7 @@
 #include "VoxelBoxCombineChunk.h"
 #include "../World/SpecializedChunkManager.h"
 
+#include "components/utilities/JobSystem.h"
 #include "components/utilities/Span.h"
 
 class VoxelChunkManager;
@@ -11,9 +12,15 @@ class VoxelChunkManager;
 // Combines voxel shapes where possible within each chunk for reduced collider count.
 class VoxelBoxCombineChunkManager final : public SpecializedChunkManager<VoxelBoxCombineChunk>
 {
+private:
+	JobGraph jobGraph;
 public:
 	void updateActiveChunks(Span<const ChunkInt2> newChunkPositions, Span<const ChunkInt2> freedChunkPositions, const VoxelChunkManager &voxelChunkManager);
-	void update(Span<const ChunkInt2> activeChunkPositions, Span<const ChunkInt2> newChunkPositions, const VoxelChunkManager &voxelChunkManager);
+
+	// Updates chunks in parallel. A job only writes its own box combine chunk and only reads the voxel chunk at
+	// the same position.
+	void update(Span<const ChunkInt2> activeChunkPositions, Span<const ChunkInt2> newChunkPositions, const VoxelChunkManager &voxelChunkManager,
+		JobSystem &jobSystem);
 };
 
 #endif
@@ -26,19 +26,19 @@ void VoxelChunk::init(const ChunkInt2 &position, int height)
 	this->traitsDefs.emplace_back(VoxelTraitsDefinition());
 
 	// Set all voxels to air.
-	this->shapeDefIDs.init(Chunk::WIDTH, height, Chunk::DEPTH);
+	this->shapeDefIDs.initOrReuse(Chunk::WIDTH, height, Chunk::DEPTH);
 	this->shapeDefIDs.fill(VoxelChunk::AIR_SHAPE_DEF_ID);
 
-	this->textureDefIDs.init(Chunk::WIDTH, height, Chunk::DEPTH);
+	this->textureDefIDs.initOrReuse(Chunk::WIDTH, height, Chunk::DEPTH);
 	this->textureDefIDs.fill(VoxelChunk::AIR_TEXTURE_DEF_ID);
 
-	this->shadingDefIDs.init(Chunk::WIDTH, height, Chunk::DEPTH);
+	this->shadingDefIDs.initOrReuse(Chunk::WIDTH, height, Chunk::DEPTH);
 	this->shadingDefIDs.fill(VoxelChunk::AIR_SHADING_DEF_ID);
 
-	this->traitsDefIDs.init(Chunk::WIDTH, height, Chunk::DEPTH);
+	this->traitsDefIDs.initOrReuse(Chunk::WIDTH, height, Chunk::DEPTH);
 	this->traitsDefIDs.fill(VoxelChunk::AIR_TRAITS_DEF_ID);
 
-	this->dirtyVoxelTypes.init(Chunk::WIDTH, height, Chunk::DEPTH);
+	this->dirtyVoxelTypes.initOrReuse(Chunk::WIDTH, height, Chunk::DEPTH);
 	this->dirtyVoxelTypes.fill(static_cast<VoxelDirtyType>(0));
 	this->dirtyShapeDefPositions.reserve(Chunk::WIDTH * height * Chunk::DEPTH);
 }
@@ -277,6 +277,7 @@ void VoxelChunk::setTraitsDefID(SNInt x, int y, WEInt z, VoxelTraitsDefID id)
 VoxelShapeDefID VoxelChunk::addShapeDef(VoxelShapeDefinition &&voxelShapeDef)
 {
 	const VoxelShapeDefID id = static_cast<VoxelShapeDefID>(this->shapeDefs.size());
+	DebugAssert(id <= PackedIdBuffer3D::MAX_VALUE);
 	this->shapeDefs.emplace_back(std::move(voxelShapeDef));
 	return id;
 }
@@ -284,6 +285,7 @@ VoxelShapeDefID VoxelChunk::addShapeDef(VoxelShapeDefinition &&voxelShapeDef)
 VoxelTextureDefID VoxelChunk::addTextureDef(VoxelTextureDefinition &&voxelTextureDef)
 {
 	const VoxelTextureDefID id = static_cast<VoxelTextureDefID>(this->textureDefs.size());
+	DebugAssert(id <= PackedIdBuffer3D::MAX_VALUE);
 	this->textureDefs.emplace_back(std::move(voxelTextureDef));
 	return id;
 }
@@ -291,6 +293,7 @@ VoxelTextureDefID VoxelChunk::addTextureDef(VoxelTextureDefinition &&voxelTextur
 VoxelShadingDefID VoxelChunk::addShadingDef(VoxelShadingDefinition &&voxelShadingDef)
 {
 	const VoxelShadingDefID id = static_cast<VoxelShadingDefID>(this->shadingDefs.size());
+	DebugAssert(id <= PackedIdBuffer3D::MAX_VALUE);
 	this->shadingDefs.emplace_back(std::move(voxelShadingDef));
 	return id;
 }
@@ -298,6 +301,7 @@ VoxelShadingDefID VoxelChunk::addShadingDef(VoxelShadingDefinition &&voxelShadin
 VoxelTraitsDefID VoxelChunk::addTraitsDef(VoxelTraitsDefinition &&voxelTraitsDef)
 {
 	const VoxelTraitsDefID id = static_cast<VoxelTraitsDefID>(this->traitsDefs.size());
+	DebugAssert(id <= PackedIdBuffer3D::MAX_VALUE);
 	this->traitsDefs.emplace_back(std::move(voxelTraitsDef));
 	return id;
 }
@@ -428,6 +432,67 @@ void VoxelChunk::setFadeAnimInstDirty(SNInt x, int y, WEInt z)
 	this->trySetVoxelDirtyInternal(x, y, z, this->dirtyFadeAnimInstPositions, VoxelDirtyType::FadeAnimation);
 }
 
+void VoxelChunk::replaceFadedVoxel(SNInt x, int y, WEInt z)
+{
+	const VoxelInt3 voxel(x, y, z);
+	const VoxelTraitsDefID voxelTraitsDefID = this->traitsDefIDs.get(voxel.x, voxel.y, voxel.z);
+	const VoxelTraitsDefinition &voxelTraitsDef = this->traitsDefs[voxelTraitsDefID];
+	const bool shouldConvertToChasm = voxelTraitsDef.type == ArenaVoxelType::Floor;
+	if (shouldConvertToChasm)
+	{
+		// Change to water chasm.
+		this->setShapeDefID(voxel.x, voxel.y, voxel.z, this->floorReplacementShapeDefID);
+		this->setTextureDefID(voxel.x, voxel.y, voxel.z, this->floorReplacementTextureDefID);
+		this->setShadingDefID(voxel.x, voxel.y, voxel.z, this->floorReplacementShadingDefID);
+		this->setTraitsDefID(voxel.x, voxel.y, voxel.z, this->floorReplacementTraitsDefID);
+		this->chasmDefIndices.emplace(voxel, this->floorReplacementChasmDefID);
+		this->setFaceActivationDirty(voxel.x, voxel.y, voxel.z);
+	}
+	else
+	{
+		// Air voxel.
+		this->setShapeDefID(voxel.x, voxel.y, voxel.z, VoxelChunk::AIR_SHAPE_DEF_ID);
+		this->setTextureDefID(voxel.x, voxel.y, voxel.z, VoxelChunk::AIR_TEXTURE_DEF_ID);
+		this->setShadingDefID(voxel.x, voxel.y, voxel.z, VoxelChunk::AIR_SHADING_DEF_ID);
+		this->setTraitsDefID(voxel.x, voxel.y, voxel.z, VoxelChunk::AIR_TRAITS_DEF_ID);
+
+		auto tryEraseVoxelMapEntry = [&voxel](auto &map)
+		{
+			const auto mapIter = map.find(voxel);
+			if (mapIter != map.end())
+			{
+				map.erase(mapIter);
+			}
+		};
+
+		tryEraseVoxelMapEntry(this->transitionDefIndices);
+		tryEraseVoxelMapEntry(this->triggerDefIndices);
+		tryEraseVoxelMapEntry(this->lockDefIndices);
+		tryEraseVoxelMapEntry(this->buildingNameIndices);
+		tryEraseVoxelMapEntry(this->doorDefIndices);
+		tryEraseVoxelMapEntry(this->chasmDefIndices);
+	}
+
+	// Set adjacent face activations dirty in case they became unblocked.
+	const VoxelInt3 adjacentVoxels[] =
+	{
+		VoxelUtils::getVoxelWithOffset(voxel, VoxelInt3::UnitX),
+		VoxelUtils::getVoxelWithOffset(voxel, -VoxelInt3::UnitX),
+		VoxelUtils::getVoxelWithOffset(voxel, VoxelInt3::UnitY),
+		VoxelUtils::getVoxelWithOffset(voxel, -VoxelInt3::UnitY),
+		VoxelUtils::getVoxelWithOffset(voxel, VoxelInt3::UnitZ),
+		VoxelUtils::getVoxelWithOffset(voxel, -VoxelInt3::UnitZ)
+	};
+
+	for (const VoxelInt3 adjacentVoxel : adjacentVoxels)
+	{
+		if (this->isValidVoxel(adjacentVoxel.x, adjacentVoxel.y, adjacentVoxel.z))
+		{
+			this->setFaceActivationDirty(adjacentVoxel.x, adjacentVoxel.y, adjacentVoxel.z);
+		}
+	}
+}
+
 void VoxelChunk::updateDoorAnimInsts(double dt, const CoordDouble3 &playerCoord, double ceilingScale, AudioManager &audioManager)
 {
 	const ChunkInt2 chunkPos = this->position;
@@ -505,63 +570,7 @@ void VoxelChunk::updateFadeAnimInsts(double dt)
 		const VoxelInt3 voxel(animInst.x, animInst.y, animInst.z);
 		if (animInst.isDoneFading())
 		{
-			const VoxelTraitsDefID voxelTraitsDefID = this->traitsDefIDs.get(voxel.x, voxel.y, voxel.z);
-			const VoxelTraitsDefinition &voxelTraitsDef = this->traitsDefs[voxelTraitsDefID];
-			const bool shouldConvertToChasm = voxelTraitsDef.type == ArenaVoxelType::Floor;
-			if (shouldConvertToChasm)
-			{
-				// Change to water chasm.
-				this->setShapeDefID(voxel.x, voxel.y, voxel.z, this->floorReplacementShapeDefID);
-				this->setTextureDefID(voxel.x, voxel.y, voxel.z, this->floorReplacementTextureDefID);
-				this->setShadingDefID(voxel.x, voxel.y, voxel.z, this->floorReplacementShadingDefID);
-				this->setTraitsDefID(voxel.x, voxel.y, voxel.z, this->floorReplacementTraitsDefID);
-				this->chasmDefIndices.emplace(voxel, this->floorReplacementChasmDefID);
-				this->setFaceActivationDirty(voxel.x, voxel.y, voxel.z);
-			}
-			else
-			{
-				// Air voxel.
-				this->setShapeDefID(voxel.x, voxel.y, voxel.z, VoxelChunk::AIR_SHAPE_DEF_ID);
-				this->setTextureDefID(voxel.x, voxel.y, voxel.z, VoxelChunk::AIR_TEXTURE_DEF_ID);
-				this->setShadingDefID(voxel.x, voxel.y, voxel.z, VoxelChunk::AIR_SHADING_DEF_ID);
-				this->setTraitsDefID(voxel.x, voxel.y, voxel.z, VoxelChunk::AIR_TRAITS_DEF_ID);
-
-				auto tryEraseVoxelMapEntry = [&voxel](auto &map)
-				{
-					const auto mapIter = map.find(voxel);
-					if (mapIter != map.end())
-					{
-						map.erase(mapIter);
-					}
-				};
-
-				tryEraseVoxelMapEntry(this->transitionDefIndices);
-				tryEraseVoxelMapEntry(this->triggerDefIndices);
-				tryEraseVoxelMapEntry(this->lockDefIndices);
-				tryEraseVoxelMapEntry(this->buildingNameIndices);
-				tryEraseVoxelMapEntry(this->doorDefIndices);
-				tryEraseVoxelMapEntry(this->chasmDefIndices);
-			}
-
-			// Set adjacent face activations dirty in case they became unblocked.
-			const VoxelInt3 adjacentVoxels[] =
-			{
-				VoxelUtils::getVoxelWithOffset(voxel, VoxelInt3::UnitX),
-				VoxelUtils::getVoxelWithOffset(voxel, -VoxelInt3::UnitX),
-				VoxelUtils::getVoxelWithOffset(voxel, VoxelInt3::UnitY),
-				VoxelUtils::getVoxelWithOffset(voxel, -VoxelInt3::UnitY),
-				VoxelUtils::getVoxelWithOffset(voxel, VoxelInt3::UnitZ),
-				VoxelUtils::getVoxelWithOffset(voxel, -VoxelInt3::UnitZ)
-			};
-
-			for (const VoxelInt3 adjacentVoxel : adjacentVoxels)
-			{
-				if (this->isValidVoxel(adjacentVoxel.x, adjacentVoxel.y, adjacentVoxel.z))
-				{
-					this->setFaceActivationDirty(adjacentVoxel.x, adjacentVoxel.y, adjacentVoxel.z);
-				}
-			}
-
+			this->replaceFadedVoxel(voxel.x, voxel.y, voxel.z);
 			this->destroyedFadeAnimInsts.emplace_back(voxel);
 		}
 		else
@@ -621,11 +630,6 @@ void VoxelChunk::clear()
 	this->lockDefs.clear();
 	this->buildingNames.clear();
 	this->doorDefs.clear();
-	this->shapeDefIDs.clear();
-	this->textureDefIDs.clear();
-	this->shadingDefIDs.clear();
-	this->traitsDefIDs.clear();
-	this->dirtyVoxelTypes.clear();
 	this->dirtyShapeDefPositions.clear();
 	this->dirtyFaceActivationPositions.clear();
 	this->dirtyDoorAnimInstPositions.clear();
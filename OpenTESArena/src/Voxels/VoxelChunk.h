@@ -28,6 +28,7 @@
 #include "../World/TransitionDefinition.h"
 
 #include "components/utilities/Buffer3D.h"
+#include "components/utilities/PackedIdBuffer3D.h"
 
 class AudioManager;
 
@@ -56,11 +57,12 @@ struct VoxelChunk final : public Chunk
 	std::vector<std::string> buildingNames;
 	std::vector<VoxelDoorDefinition> doorDefs;
 
-	// Indices into definitions for actual voxels in-game.
-	Buffer3D<VoxelShapeDefID> shapeDefIDs;
-	Buffer3D<VoxelTextureDefID> textureDefIDs;
-	Buffer3D<VoxelShadingDefID> shadingDefIDs;
-	Buffer3D<VoxelTraitsDefID> traitsDefIDs;
+	// Indices into definitions for actual voxels in-game. The definition lists above act as per-chunk palettes
+	// so these usually fit in one byte per voxel.
+	PackedIdBuffer3D shapeDefIDs;
+	PackedIdBuffer3D textureDefIDs;
+	PackedIdBuffer3D shadingDefIDs;
+	PackedIdBuffer3D traitsDefIDs;
 	VoxelShapeDefID floorReplacementShapeDefID;
 	VoxelTextureDefID floorReplacementTextureDefID;
 	VoxelShadingDefID floorReplacementShadingDefID;
@@ -165,6 +167,10 @@ struct VoxelChunk final : public Chunk
 
 	void removeChasmWallInst(const VoxelInt3 &voxel);
 
+	// Turns a voxel that finished fading into air, or a chasm if it was a floor. Also used when re-applying
+	// saved chunk changes.
+	void replaceFadedVoxel(SNInt x, int y, WEInt z);
+
 	// Simulates the chunk's voxels by delta time.
 	// @todo: evaluate just letting the chunk manager do all the updating for the chunk, due to the complexity
 	// of chunk perimeters, etc. and the amount of almost-identical problem solving between the two classes.
@@ -3,6 +3,7 @@
 
 #include "VoxelChunkManager.h"
 #include "../Assets/ArenaTypes.h"
+#include "../World/ChunkDeltaCache.h"
 #include "../Game/Game.h"
 #include "../World/ChunkUtils.h"
 #include "../World/MapType.h"
@@ -35,21 +36,62 @@ namespace
 		// Chunks have an air definition at ID 0.
 		return static_cast<VoxelTraitsDefID>(levelVoxelDefID + 1);
 	}
+
+	// Defaults to the active level def unless it's the wilderness which relies on the chunk coordinate.
+	void GetChunkLevelDefs(const ChunkInt2 &chunkPos, const LevelDefinition *activeLevelDef, const LevelInfoDefinition *activeLevelInfoDef,
+		const MapSubDefinition &mapSubDef, Span<const LevelDefinition> levelDefs, Span<const int> levelInfoDefIndices,
+		Span<const LevelInfoDefinition> levelInfoDefs, const LevelDefinition **outLevelDef, const LevelInfoDefinition **outLevelInfoDef)
+	{
+		*outLevelDef = activeLevelDef;
+		*outLevelInfoDef = activeLevelInfoDef;
+
+		if (mapSubDef.type == MapType::Wilderness)
+		{
+			const MapDefinitionWild &mapDefWild = mapSubDef.wild;
+			const int levelDefIndex = mapDefWild.getLevelDefIndex(chunkPos);
+			*outLevelDef = &levelDefs[levelDefIndex];
+
+			const int levelInfoDefIndex = levelInfoDefIndices[levelDefIndex];
+			*outLevelInfoDef = &levelInfoDefs[levelInfoDefIndex];
+		}
+	}
+}
+
+VoxelChunkManager::VoxelChunkManager()
+{
+	this->isStreamingInFlight = false;
+	this->shouldStreamingThreadExit = false;
+}
+
+VoxelChunkManager::~VoxelChunkManager()
+{
+	if (this->streamingThread.joinable())
+	{
+		std::unique_lock<std::mutex> lock(this->streamingMutex);
+		this->streamingCondVar.wait(lock, [this]() { return !this->isStreamingInFlight; });
+		this->shouldStreamingThreadExit = true;
+		lock.unlock();
+		this->streamingCondVar.notify_all();
+		this->streamingThread.join();
+	}
 }
 
 int VoxelChunkManager::getChasmDefCount() const
 {
+	std::lock_guard<std::mutex> lock(this->chasmDefMutex);
 	return static_cast<int>(this->chasmDefs.size());
 }
 
 const VoxelChasmDefinition &VoxelChunkManager::getChasmDef(VoxelChasmDefID id) const
 {
+	std::lock_guard<std::mutex> lock(this->chasmDefMutex);
 	DebugAssertIndex(this->chasmDefs, id);
 	return this->chasmDefs[id];
 }
 
 VoxelChasmDefID VoxelChunkManager::findChasmDef(const VoxelChasmDefinition &def)
 {
+	std::lock_guard<std::mutex> lock(this->chasmDefMutex);
 	for (int i = 0; i < static_cast<int>(this->chasmDefs.size()); i++)
 	{
 		const VoxelChasmDefinition &currentDef = this->chasmDefs[i];
@@ -64,11 +106,29 @@ VoxelChasmDefID VoxelChunkManager::findChasmDef(const VoxelChasmDefinition &def)
 
 VoxelChasmDefID VoxelChunkManager::addChasmDef(VoxelChasmDefinition &&def)
 {
+	std::lock_guard<std::mutex> lock(this->chasmDefMutex);
 	const VoxelChasmDefID id = static_cast<int>(this->chasmDefs.size());
 	this->chasmDefs.emplace_back(std::move(def));
 	return id;
 }
 
+VoxelChasmDefID VoxelChunkManager::getOrAddChasmDef(const VoxelChasmDefinition &def)
+{
+	// Find and add under one lock so the streaming thread and main thread can't both add the same definition.
+	std::lock_guard<std::mutex> lock(this->chasmDefMutex);
+	for (int i = 0; i < static_cast<int>(this->chasmDefs.size()); i++)
+	{
+		if (this->chasmDefs[i] == def)
+		{
+			return i;
+		}
+	}
+
+	const VoxelChasmDefID id = static_cast<int>(this->chasmDefs.size());
+	this->chasmDefs.emplace_back(def);
+	return id;
+}
+
 void VoxelChunkManager::getAdjacentVoxelShapeDefIDs(const CoordInt3 &coord, int *outNorthChunkIndex, int *outEastChunkIndex, int *outSouthChunkIndex, int *outWestChunkIndex,
 	VoxelShapeDefID *outNorthID, VoxelShapeDefID *outEastID, VoxelShapeDefID *outSouthID, VoxelShapeDefID *outWestID)
 {
@@ -162,14 +222,8 @@ void VoxelChunkManager::populateChunkVoxelDefs(VoxelChunk &chunk, const LevelDef
 
 	// Reuse chasm definitions across all chunks.
 	const LevelVoxelChasmDefID levelFloorReplacementChasmDefID = levelDefinition.getFloorReplacementChasmDefID();
-	VoxelChasmDefinition floorReplacementChasmDef = levelInfoDefinition.getChasmDef(levelFloorReplacementChasmDefID);	
-	VoxelChasmDefID floorReplacementChasmDefID = this->findChasmDef(floorReplacementChasmDef);
-	if (floorReplacementChasmDefID < 0)
-	{
-		floorReplacementChasmDefID = this->addChasmDef(std::move(floorReplacementChasmDef));
-	}
-
-	chunk.floorReplacementChasmDefID = floorReplacementChasmDefID;
+	const VoxelChasmDefinition &floorReplacementChasmDef = levelInfoDefinition.getChasmDef(levelFloorReplacementChasmDefID);
+	chunk.floorReplacementChasmDefID = this->getOrAddChasmDef(floorReplacementChasmDef);
 }
 
 void VoxelChunkManager::populateChunkVoxels(VoxelChunk &chunk, const LevelDefinition &levelDefinition,
@@ -331,11 +385,7 @@ void VoxelChunkManager::populateChunkDecorators(VoxelChunk &chunk, const LevelDe
 		const LevelChasmPlacementDefinition &placementDef = levelDefinition.getChasmPlacementDef(i);
 		const VoxelChasmDefinition &chasmDef = levelInfoDefinition.getChasmDef(placementDef.id);
 		
-		VoxelChasmDefID chasmDefID = this->findChasmDef(chasmDef);
-		if (chasmDefID < 0)
-		{
-			chasmDefID = this->addChasmDef(VoxelChasmDefinition(chasmDef));
-		}
+		const VoxelChasmDefID chasmDefID = this->getOrAddChasmDef(chasmDef);
 
 		for (const WorldInt3 position : placementDef.positions)
 		{
@@ -484,10 +534,9 @@ void VoxelChunkManager::populateChunkDoorVisibilityInsts(VoxelChunk &chunk)
 	}
 }
 
-void VoxelChunkManager::populateChunk(int index, const ChunkInt2 &chunkPos, const LevelDefinition &levelDef,
+void VoxelChunkManager::populateChunk(VoxelChunk &chunk, const ChunkInt2 &chunkPos, const LevelDefinition &levelDef,
 	const LevelInfoDefinition &levelInfoDef, const MapSubDefinition &mapSubDef)
 {
-	VoxelChunk &chunk = this->getChunkAtIndex(index);
 	const SNInt levelWidth = levelDef.getWidth();
 	const int levelHeight = levelDef.getHeight();
 	const WEInt levelDepth = levelDef.getDepth();
@@ -553,7 +602,6 @@ void VoxelChunkManager::populateChunk(int index, const ChunkInt2 &chunkPos, cons
 			const WorldInt2 levelOffset = chunkPos * ChunkUtils::CHUNK_DIM;
 			this->populateChunkVoxels(chunk, levelDef, levelOffset);
 			this->populateChunkDecorators(chunk, levelDef, levelInfoDef, levelOffset);
-			this->populateChunkChasmInsts(chunk);
 			this->populateChunkDoorVisibilityInsts(chunk);
 		}
 	}
@@ -624,8 +672,6 @@ void VoxelChunkManager::populateChunk(int index, const ChunkInt2 &chunkPos, cons
 				}
 			}
 		}
-
-		this->populateChunkChasmInsts(chunk);
 	}
 	else if (mapType == MapType::Wilderness)
 	{
@@ -645,7 +691,6 @@ void VoxelChunkManager::populateChunk(int index, const ChunkInt2 &chunkPos, cons
 			this->populateWildChunkBuildingNames(chunk, *buildingNameInfo, levelInfoDef);
 		}
 
-		this->populateChunkChasmInsts(chunk);
 		this->populateChunkDoorVisibilityInsts(chunk);
 	}
 	else
@@ -777,10 +822,108 @@ void VoxelChunkManager::updateChunkDoorVisibilityInsts(VoxelChunk &chunk, const
 	}
 }
 
+void VoxelChunkManager::streamingThreadLoop()
+{
+	std::unique_lock<std::mutex> lock(this->streamingMutex);
+
+	while (true)
+	{
+		this->streamingCondVar.wait(lock, [this]() { return this->isStreamingInFlight || this->shouldStreamingThreadExit; });
+		if (this->shouldStreamingThreadExit)
+		{
+			break;
+		}
+
+		lock.unlock();
+
+		for (int i = 0; i < static_cast<int>(this->streamingRequests.size()); i++)
+		{
+			const StreamingRequest &request = this->streamingRequests[i];
+			VoxelChunk &chunk = *this->streamingChunks[i];
+			this->populateChunk(chunk, request.position, *request.levelDef, *request.levelInfoDef, *request.mapSubDef);
+		}
+
+		lock.lock();
+		this->isStreamingInFlight = false;
+		this->streamingCondVar.notify_all();
+	}
+}
+
+void VoxelChunkManager::beginStreaming(Span<const ChunkInt2> streamingChunkPositions, const LevelDefinition *activeLevelDef,
+	const LevelInfoDefinition *activeLevelInfoDef, const MapSubDefinition &mapSubDef, Span<const LevelDefinition> levelDefs,
+	Span<const int> levelInfoDefIndices, Span<const LevelInfoDefinition> levelInfoDefs)
+{
+	DebugAssert(this->streamingRequests.empty());
+	DebugAssert(this->streamingChunks.empty());
+
+	for (const ChunkInt2 chunkPos : streamingChunkPositions)
+	{
+		if (static_cast<int>(this->streamingRequests.size()) == MAX_STREAMING_CHUNKS_PER_FRAME)
+		{
+			break;
+		}
+
+		const bool isAlreadyStreamed = std::any_of(this->streamedChunks.begin(), this->streamedChunks.end(),
+			[&chunkPos](const ChunkPtr &chunkPtr)
+		{
+			return chunkPtr->position == chunkPos;
+		});
+
+		if (isAlreadyStreamed)
+		{
+			continue;
+		}
+
+		StreamingRequest request;
+		request.position = chunkPos;
+		request.mapSubDef = &mapSubDef;
+		GetChunkLevelDefs(chunkPos, activeLevelDef, activeLevelInfoDef, mapSubDef, levelDefs, levelInfoDefIndices,
+			levelInfoDefs, &request.levelDef, &request.levelInfoDef);
+		this->streamingRequests.emplace_back(request);
+
+		this->streamingChunks.emplace_back(this->takePooledChunk());
+	}
+
+	if (this->streamingRequests.empty())
+	{
+		return;
+	}
+
+	if (!this->streamingThread.joinable())
+	{
+		this->streamingThread = std::thread([this]() { this->streamingThreadLoop(); });
+	}
+
+	std::unique_lock<std::mutex> lock(this->streamingMutex);
+	this->isStreamingInFlight = true;
+	lock.unlock();
+	this->streamingCondVar.notify_all();
+}
+
+void VoxelChunkManager::finishStreaming()
+{
+	if (this->streamingRequests.empty())
+	{
+		return;
+	}
+
+	std::unique_lock<std::mutex> lock(this->streamingMutex);
+	this->streamingCondVar.wait(lock, [this]() { return !this->isStreamingInFlight; });
+	lock.unlock();
+
+	for (ChunkPtr &chunkPtr : this->streamingChunks)
+	{
+		this->streamedChunks.emplace_back(std::move(chunkPtr));
+	}
+
+	this->streamingRequests.clear();
+	this->streamingChunks.clear();
+}
+
 void VoxelChunkManager::update(double dt, Span<const ChunkInt2> newChunkPositions, Span<const ChunkInt2> freedChunkPositions,
-	const CoordDouble3 &playerCoord, const LevelDefinition *activeLevelDef, const LevelInfoDefinition *activeLevelInfoDef,
+	Span<const ChunkInt2> streamingChunkPositions, const CoordDouble3 &playerCoord, const LevelDefinition *activeLevelDef, const LevelInfoDefinition *activeLevelInfoDef,
 	const MapSubDefinition &mapSubDef, Span<const LevelDefinition> levelDefs, Span<const int> levelInfoDefIndices,
-	Span<const LevelInfoDefinition> levelInfoDefs, double ceilingScale, AudioManager &audioManager)
+	Span<const LevelInfoDefinition> levelInfoDefs, double ceilingScale, ChunkDeltaCache &chunkDeltaCache, AudioManager &audioManager)
 {
 	for (const ChunkInt2 chunkPos : freedChunkPositions)
 	{
@@ -791,27 +934,69 @@ void VoxelChunkManager::update(double dt, Span<const ChunkInt2> newChunkPosition
 	const MapType mapType = mapSubDef.type;
 	for (const ChunkInt2 chunkPos : newChunkPositions)
 	{
-		const int spawnIndex = this->spawnChunk();
+		const LevelDefinition *levelDefPtr;
+		const LevelInfoDefinition *levelInfoDefPtr;
+		GetChunkLevelDefs(chunkPos, activeLevelDef, activeLevelInfoDef, mapSubDef, levelDefs, levelInfoDefIndices,
+			levelInfoDefs, &levelDefPtr, &levelInfoDefPtr);
+
+		int chunkIndex;
+		const auto streamedIter = std::find_if(this->streamedChunks.begin(), this->streamedChunks.end(),
+			[&chunkPos](const ChunkPtr &chunkPtr)
+		{
+			return chunkPtr->position == chunkPos;
+		});
 
-		// Default to the active level def unless it's the wilderness which relies on this chunk coordinate.
-		const LevelDefinition *levelDefPtr = activeLevelDef;
-		const LevelInfoDefinition *levelInfoDefPtr = activeLevelInfoDef;
-		if (mapType == MapType::Wilderness)
+		if (streamedIter != this->streamedChunks.end())
 		{
-			const MapDefinitionWild &mapDefWild = mapSubDef.wild;
-			const int levelDefIndex = mapDefWild.getLevelDefIndex(chunkPos);
-			levelDefPtr = &levelDefs[levelDefIndex];
+			chunkIndex = this->addActiveChunk(std::move(*streamedIter));
+			this->streamedChunks.erase(streamedIter);
+		}
+		else
+		{
+			chunkIndex = this->spawnChunk(chunkPos);
+			this->populateChunk(this->getChunkAtIndex(chunkIndex), chunkPos, *levelDefPtr, *levelInfoDefPtr, mapSubDef);
+		}
 
-			const int levelInfoDefIndex = levelInfoDefIndices[levelDefIndex];
-			levelInfoDefPtr = &levelInfoDefs[levelInfoDefIndex];
+		// Re-apply changes from the last time this chunk was active.
+		const ChunkDelta *chunkDelta = chunkDeltaCache.findDelta(chunkPos);
+		if (chunkDelta != nullptr)
+		{
+			VoxelChunk &chunk = this->getChunkAtIndex(chunkIndex);
+			for (const VoxelInt3 fadedVoxel : chunkDelta->fadedVoxels)
+			{
+				chunk.replaceFadedVoxel(fadedVoxel.x, fadedVoxel.y, fadedVoxel.z);
+			}
 		}
 
-		this->populateChunk(spawnIndex, chunkPos, *levelDefPtr, *levelInfoDefPtr, mapSubDef);
+		// Chasm walls depend on adjacent chunks so they're added once the chunk is active.
+		const bool canHaveChasms = (mapType != MapType::Interior) ||
+			ChunkUtils::touchesLevelDimensions(chunkPos, levelDefPtr->getWidth(), levelDefPtr->getDepth());
+		if (canHaveChasms)
+		{
+			this->populateChunkChasmInsts(this->getChunkAtIndex(chunkIndex));
+		}
 	}
 
-	// Free any unneeded chunks for memory savings in case the chunk distance was once large
-	// and is now small. This is significant even for chunk distance 2->1, or 25->9 chunks.
-	this->chunkPool.clear();
+	// Streamed chunks the player moved away from before reaching them.
+	for (int i = static_cast<int>(this->streamedChunks.size()) - 1; i >= 0; i--)
+	{
+		ChunkPtr &chunkPtr = this->streamedChunks[i];
+		const ChunkInt2 chunkPos = chunkPtr->position;
+		const auto streamingPosIter = std::find(streamingChunkPositions.begin(), streamingChunkPositions.end(), chunkPos);
+		if (streamingPosIter == streamingChunkPositions.end())
+		{
+			chunkPtr->clear();
+			this->chunkPool.emplace_back(std::move(chunkPtr));
+			this->streamedChunks.erase(this->streamedChunks.begin() + i);
+		}
+	}
+
+	this->beginStreaming(streamingChunkPositions, activeLevelDef, activeLevelInfoDef, mapSubDef, levelDefs,
+		levelInfoDefIndices, levelInfoDefs);
+
+	// Keep recycled chunks warm for the next chunk border crossing, only freeing the excess in case the
+	// chunk distance was once large and is now small. This is significant even for chunk distance 2->1.
+	this->trimChunkPool();
 
 	// Update each chunk so they can animate/destroy faded voxel instances, etc..
 	const int activeChunkCount = static_cast<int>(this->activeChunks.size());
@@ -820,6 +1005,15 @@ void VoxelChunkManager::update(double dt, Span<const ChunkInt2> newChunkPosition
 		ChunkPtr &chunkPtr = this->activeChunks[i];
 		chunkPtr->updateDoorAnimInsts(dt, playerCoord, ceilingScale, audioManager);
 		chunkPtr->updateFadeAnimInsts(dt);
+
+		if (!chunkPtr->destroyedFadeAnimInsts.empty())
+		{
+			ChunkDelta &chunkDelta = chunkDeltaCache.getOrAddDelta(chunkPtr->position);
+			for (const VoxelInt3 fadedVoxel : chunkPtr->destroyedFadeAnimInsts)
+			{
+				chunkDelta.addFadedVoxel(fadedVoxel);
+			}
+		}
 	}
 
 	// Check if new chasms caused surrounding chasms to become dirty.
@@ -922,6 +1116,12 @@ void VoxelChunkManager::endFrame()
 
 void VoxelChunkManager::clear()
 {
+	this->finishStreaming();
+	this->streamedChunks.clear();
+
+	std::unique_lock<std::mutex> lock(this->chasmDefMutex);
 	this->chasmDefs.clear();
+	lock.unlock();
+
 	this->recycleAllChunks();
 }
@@ -1,8 +1,12 @@
 #ifndef VOXEL_CHUNK_MANAGER_H
 #define VOXEL_CHUNK_MANAGER_H
 
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <thread>
 #include <vector>
 
 #include "VoxelChasmDefinition.h"
@@ -12,13 +16,40 @@
 
 #include "components/utilities/Span.h"
 
+class ChunkDeltaCache;
+
 struct MapSubDefinition;
 
 // Handles the lifetimes of voxel chunks. Relies on the base chunk manager for the active chunk coordinates.
+// Chunks in the ring just outside the active ones are populated ahead of time on a streaming thread so
+// crossing a chunk border only has to do the parts that depend on adjacent chunks.
 class VoxelChunkManager final : public SpecializedChunkManager<VoxelChunk>
 {
 private:
-	std::vector<VoxelChasmDefinition> chasmDefs;
+	struct StreamingRequest
+	{
+		ChunkInt2 position;
+		const LevelDefinition *levelDef;
+		const LevelInfoDefinition *levelInfoDef;
+		const MapSubDefinition *mapSubDef;
+	};
+
+	// Upper bound on chunks handed to the streaming thread per frame so it reliably finishes before the frame's join point.
+	static constexpr int MAX_STREAMING_CHUNKS_PER_FRAME = 2;
+
+	std::deque<VoxelChasmDefinition> chasmDefs; // Deque so references stay valid while the streaming thread adds to it.
+	mutable std::mutex chasmDefMutex;
+
+	std::vector<StreamingRequest> streamingRequests; // Owned by the streaming thread while in flight.
+	std::vector<ChunkPtr> streamingChunks; // Parallel to requests, owned by the streaming thread while in flight.
+	std::vector<ChunkPtr> streamedChunks; // Populated ahead of time and waiting to become active.
+	std::thread streamingThread;
+	std::mutex streamingMutex;
+	std::condition_variable streamingCondVar;
+	bool isStreamingInFlight;
+	bool shouldStreamingThreadExit;
+
+	VoxelChasmDefID getOrAddChasmDef(const VoxelChasmDefinition &def);
 
 	void getAdjacentVoxelShapeDefIDs(const CoordInt3 &coord, int *outNorthChunkIndex, int *outEastChunkIndex, int *outSouthChunkIndex, int *outWestChunkIndex,
 		VoxelShapeDefID *outNorthID, VoxelShapeDefID *outEastID, VoxelShapeDefID *outSouthID, VoxelShapeDefID *outWestID);
@@ -53,26 +84,41 @@ private:
 	// Adds door visibility instances to the chunk for determining which faces to render.
 	void populateChunkDoorVisibilityInsts(VoxelChunk &chunk);
 
-	// Fills the chunk with the data required based on its position and the world type.
-	void populateChunk(int index, const ChunkInt2 &chunkPos, const LevelDefinition &levelDef, const LevelInfoDefinition &levelInfoDef,
+	// Fills the chunk with the data required based on its position and the world type. Doesn't look at any other
+	// chunks so it's safe to run on the streaming thread.
+	void populateChunk(VoxelChunk &chunk, const ChunkInt2 &chunkPos, const LevelDefinition &levelDef, const LevelInfoDefinition &levelInfoDef,
 		const MapSubDefinition &mapSubDef);
 
+	void streamingThreadLoop();
+
+	// Hands up to the per-frame budget of unpopulated streaming chunk positions to the streaming thread.
+	void beginStreaming(Span<const ChunkInt2> streamingChunkPositions, const LevelDefinition *activeLevelDef,
+		const LevelInfoDefinition *activeLevelInfoDef, const MapSubDefinition &mapSubDef, Span<const LevelDefinition> levelDefs,
+		Span<const int> levelInfoDefIndices, Span<const LevelInfoDefinition> levelInfoDefs);
+
 	// Updates a chasm (context-sensitive voxel) that may be affected by adjacent chunks.
 	void updateChasmWallInst(VoxelChunk &chunk, SNInt x, int y, WEInt z);
 
 	// Updates door visibilities for a chunk; some of which might be on the chunk's perimeter that are affected by adjacent chunks.
 	void updateChunkDoorVisibilityInsts(VoxelChunk &chunk, const CoordDouble3 &playerCoord);
 public:
+	VoxelChunkManager();
+	~VoxelChunkManager();
+
 	int getChasmDefCount() const;
 	const VoxelChasmDefinition &getChasmDef(VoxelChasmDefID id) const;
 	VoxelChasmDefID findChasmDef(const VoxelChasmDefinition &def);
 	VoxelChasmDefID addChasmDef(VoxelChasmDefinition &&def);
 
 	void update(double dt, Span<const ChunkInt2> newChunkPositions, Span<const ChunkInt2> freedChunkPositions,
-		const CoordDouble3 &playerCoord, const LevelDefinition *activeLevelDef, const LevelInfoDefinition *activeLevelInfoDef,
+		Span<const ChunkInt2> streamingChunkPositions, const CoordDouble3 &playerCoord, const LevelDefinition *activeLevelDef, const LevelInfoDefinition *activeLevelInfoDef,
 		const MapSubDefinition &mapSubDef, Span<const LevelDefinition> levelDefs,
 		Span<const int> levelInfoDefIndices, Span<const LevelInfoDefinition> levelInfoDefs,
-		double ceilingScale, AudioManager &audioManager);
+		double ceilingScale, ChunkDeltaCache &chunkDeltaCache, AudioManager &audioManager);
+
+	// Waits for chunks started this frame on the streaming thread. Must be called before anything can change the
+	// level definitions they read from.
+	void finishStreaming();
 
 	// Run at the end of a frame to reset certain frame data like dirty voxels.
 	void endFrame();
@@ -180,10 +180,10 @@ void VoxelFaceCombineChunk::init(const ChunkInt2 &position, int height)
 {
 	Chunk::init(position, height);
 
-	this->entries.init(Chunk::WIDTH, height, Chunk::DEPTH);
+	this->entries.initOrReuse(Chunk::WIDTH, height, Chunk::DEPTH);
 	this->entries.fill(VoxelFacesEntry());
 
-	this->dirtyEntries.init(Chunk::WIDTH, height, Chunk::DEPTH);
+	this->dirtyEntries.initOrReuse(Chunk::WIDTH, height, Chunk::DEPTH);
 	this->dirtyEntries.fill(VoxelFaceCombineDirtyEntry());
 }
 
@@ -389,9 +389,7 @@ void VoxelFaceCombineChunk::update(Span<const VoxelInt3> dirtyVoxels, const Voxe
 void VoxelFaceCombineChunk::clear()
 {
 	Chunk::clear();
-	this->dirtyEntries.clear();
 	this->dirtyEntryPositions.clear();
 	this->combinedFacesPool.clear();
-	this->entries.clear();
 	this->dirtyIDs.clear();
 }
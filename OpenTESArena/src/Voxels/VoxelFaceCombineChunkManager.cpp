@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "VoxelChunk.h"
 #include "VoxelChunkManager.h"
 #include "VoxelFaceCombineChunkManager.h"
@@ -14,44 +16,67 @@ void VoxelFaceCombineChunkManager::updateActiveChunks(Span<const ChunkInt2> newC
 
 	for (const ChunkInt2 chunkPos : newChunkPositions)
 	{
-		const int spawnIndex = this->spawnChunk();
+		const int spawnIndex = this->spawnChunk(chunkPos);
 		VoxelFaceCombineChunk &faceCombineChunk = this->getChunkAtIndex(spawnIndex);
 		const VoxelChunk &voxelChunk = voxelChunkManager.getChunkAtPosition(chunkPos);
 		faceCombineChunk.init(chunkPos, voxelChunk.height);
 	}
 
-	this->chunkPool.clear();
+	this->trimChunkPool();
 }
 
 void VoxelFaceCombineChunkManager::update(Span<const ChunkInt2> activeChunkPositions, Span<const ChunkInt2> newChunkPositions,
-	const VoxelChunkManager &voxelChunkManager, const VoxelFaceEnableChunkManager &voxelFaceEnableChunkManager)
+	const VoxelChunkManager &voxelChunkManager, const VoxelFaceEnableChunkManager &voxelFaceEnableChunkManager,
+	JobSystem &jobSystem)
 {
+	// New chunks get job IDs matching their index in newChunkPositions.
+	this->jobGraph.clear();
 	for (const ChunkInt2 chunkPos : newChunkPositions)
 	{
 		VoxelFaceCombineChunk &faceCombineChunk = this->getChunkAtPosition(chunkPos);
 		const VoxelChunk &voxelChunk = voxelChunkManager.getChunkAtPosition(chunkPos);
-		Span<const VoxelInt3> dirtyVoxels = voxelChunk.dirtyShapeDefPositions;
 		const VoxelFaceEnableChunk &faceEnableChunk = voxelFaceEnableChunkManager.getChunkAtPosition(chunkPos);
-		faceCombineChunk.update(dirtyVoxels, voxelChunk, faceEnableChunk);
+		this->jobGraph.addJob([&faceCombineChunk, &voxelChunk, &faceEnableChunk]()
+		{
+			Span<const VoxelInt3> dirtyVoxels = voxelChunk.dirtyShapeDefPositions;
+			faceCombineChunk.update(dirtyVoxels, voxelChunk, faceEnableChunk);
+		});
 	}
 
 	for (const ChunkInt2 chunkPos : activeChunkPositions)
 	{
 		VoxelFaceCombineChunk &faceCombineChunk = this->getChunkAtPosition(chunkPos);
 		const VoxelChunk &voxelChunk = voxelChunkManager.getChunkAtPosition(chunkPos);
+		if (voxelChunk.dirtyShapeDefPositions.empty() && voxelChunk.dirtyFaceActivationPositions.empty() &&
+			voxelChunk.dirtyFadeAnimInstPositions.empty())
+		{
+			continue;
+		}
+
 		const VoxelFaceEnableChunk &faceEnableChunk = voxelFaceEnableChunkManager.getChunkAtPosition(chunkPos);
+		const int jobID = this->jobGraph.addJob([&faceCombineChunk, &voxelChunk, &faceEnableChunk]()
+		{
+			// Rebuild combined faces due to change in mesh.
+			Span<const VoxelInt3> dirtyShapeDefVoxels = voxelChunk.dirtyShapeDefPositions;
+			faceCombineChunk.update(dirtyShapeDefVoxels, voxelChunk, faceEnableChunk);
 
-		// Rebuild combined faces due to change in mesh.
-		Span<const VoxelInt3> dirtyShapeDefVoxels = voxelChunk.dirtyShapeDefPositions;
-		faceCombineChunk.update(dirtyShapeDefVoxels, voxelChunk, faceEnableChunk);
+			Span<const VoxelInt3> dirtyFaceActivationVoxels = voxelChunk.dirtyFaceActivationPositions;
+			faceCombineChunk.update(dirtyFaceActivationVoxels, voxelChunk, faceEnableChunk);
 
-		Span<const VoxelInt3> dirtyFaceActivationVoxels = voxelChunk.dirtyFaceActivationPositions;
-		faceCombineChunk.update(dirtyFaceActivationVoxels, voxelChunk, faceEnableChunk);
+			// Rebuild combined faces due to changes in material.
+			Span<const VoxelInt3> dirtyFadeAnimInstVoxels = voxelChunk.dirtyFadeAnimInstPositions;
+			faceCombineChunk.update(dirtyFadeAnimInstVoxels, voxelChunk, faceEnableChunk);
+		});
 
-		// Rebuild combined faces due to changes in material.
-		Span<const VoxelInt3> dirtyFadeAnimInstVoxels = voxelChunk.dirtyFadeAnimInstPositions;
-		faceCombineChunk.update(dirtyFadeAnimInstVoxels, voxelChunk, faceEnableChunk);
+		const auto newChunkIter = std::find(newChunkPositions.begin(), newChunkPositions.end(), chunkPos);
+		if (newChunkIter != newChunkPositions.end())
+		{
+			this->jobGraph.addDependency(jobID, static_cast<int>(std::distance(newChunkPositions.begin(), newChunkIter)));
+		}
 	}
+
+	jobSystem.run(this->jobGraph);
+	this->jobGraph.clear();
 }
 
 void VoxelFaceCombineChunkManager::endFrame()
@@ -4,6 +4,7 @@
 #include "VoxelFaceCombineChunk.h"
 #include "../World/SpecializedChunkManager.h"
 
+#include "components/utilities/JobSystem.h"
 #include "components/utilities/Span.h"
 
 class VoxelChunkManager;
@@ -12,11 +13,17 @@ class VoxelFaceEnableChunkManager;
 // Combines voxel faces where possible within each chunk for reduced draw calls.
 class VoxelFaceCombineChunkManager final : public SpecializedChunkManager<VoxelFaceCombineChunk>
 {
+private:
+	JobGraph jobGraph;
 public:
 	void updateActiveChunks(Span<const ChunkInt2> newChunkPositions, Span<const ChunkInt2> freedChunkPositions,
 		const VoxelChunkManager &voxelChunkManager);
+
+	// Updates chunks in parallel. A job only writes its own face combine chunk and only reads the voxel chunk and
+	// face enable chunk at the same position, so face enable chunks must be updated first.
 	void update(Span<const ChunkInt2> activeChunkPositions, Span<const ChunkInt2> newChunkPositions,
-		const VoxelChunkManager &voxelChunkManager, const VoxelFaceEnableChunkManager &voxelFaceEnableChunkManager);
+		const VoxelChunkManager &voxelChunkManager, const VoxelFaceEnableChunkManager &voxelFaceEnableChunkManager,
+		JobSystem &jobSystem);
 
 	void endFrame();
 };
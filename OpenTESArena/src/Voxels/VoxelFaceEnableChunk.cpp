@@ -46,7 +46,7 @@ void VoxelFaceEnableChunk::init(const ChunkInt2 &position, int height)
 {
 	Chunk::init(position, height);
 
-	this->entries.init(Chunk::WIDTH, height, Chunk::DEPTH);
+	this->entries.initOrReuse(Chunk::WIDTH, height, Chunk::DEPTH);
 	this->entries.fill(VoxelFaceEnableEntry());
 }
 
@@ -159,5 +159,4 @@ void VoxelFaceEnableChunk::update(Span<const VoxelInt3> dirtyVoxels, const Voxel
 void VoxelFaceEnableChunk::clear()
 {
 	Chunk::clear();
-	this->entries.clear();
 }
@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "VoxelChunk.h"
 #include "VoxelChunkManager.h"
 #include "VoxelFaceEnableChunkManager.h"
@@ -15,32 +17,54 @@ void VoxelFaceEnableChunkManager::updateActiveChunks(Span<const ChunkInt2> newCh
 	{
 		const VoxelChunk &voxelChunk = voxelChunkManager.getChunkAtPosition(chunkPos);
 
-		const int spawnIndex = this->spawnChunk();
+		const int spawnIndex = this->spawnChunk(chunkPos);
 		VoxelFaceEnableChunk &faceEnableChunk = this->getChunkAtIndex(spawnIndex);
 		faceEnableChunk.init(chunkPos, voxelChunk.height);
 	}
 
-	this->chunkPool.clear();
+	this->trimChunkPool();
 }
 
 void VoxelFaceEnableChunkManager::update(Span<const ChunkInt2> activeChunkPositions, Span<const ChunkInt2> newChunkPositions,
-	const VoxelChunkManager &voxelChunkManager)
+	const VoxelChunkManager &voxelChunkManager, JobSystem &jobSystem)
 {
+	// New chunks get job IDs matching their index in newChunkPositions.
+	this->jobGraph.clear();
 	for (const ChunkInt2 chunkPos : newChunkPositions)
 	{
 		VoxelFaceEnableChunk &faceEnableChunk = this->getChunkAtPosition(chunkPos);
 		const VoxelChunk &voxelChunk = voxelChunkManager.getChunkAtPosition(chunkPos);
-		Span<const VoxelInt3> dirtyVoxels = voxelChunk.dirtyShapeDefPositions;
-		faceEnableChunk.update(dirtyVoxels, voxelChunk);
+		this->jobGraph.addJob([&faceEnableChunk, &voxelChunk]()
+		{
+			Span<const VoxelInt3> dirtyVoxels = voxelChunk.dirtyShapeDefPositions;
+			faceEnableChunk.update(dirtyVoxels, voxelChunk);
+		});
 	}
 
 	for (const ChunkInt2 chunkPos : activeChunkPositions)
 	{
 		VoxelFaceEnableChunk &faceEnableChunk = this->getChunkAtPosition(chunkPos);
 		const VoxelChunk &voxelChunk = voxelChunkManager.getChunkAtPosition(chunkPos);
-		Span<const VoxelInt3> dirtyShapeDefVoxels = voxelChunk.dirtyShapeDefPositions;
-		Span<const VoxelInt3> dirtyFaceActivationVoxels = voxelChunk.dirtyFaceActivationPositions;
-		faceEnableChunk.update(dirtyShapeDefVoxels, voxelChunk);
-		faceEnableChunk.update(dirtyFaceActivationVoxels, voxelChunk);
+		if (voxelChunk.dirtyShapeDefPositions.empty() && voxelChunk.dirtyFaceActivationPositions.empty())
+		{
+			continue;
+		}
+
+		const int jobID = this->jobGraph.addJob([&faceEnableChunk, &voxelChunk]()
+		{
+			Span<const VoxelInt3> dirtyShapeDefVoxels = voxelChunk.dirtyShapeDefPositions;
+			Span<const VoxelInt3> dirtyFaceActivationVoxels = voxelChunk.dirtyFaceActivationPositions;
+			faceEnableChunk.update(dirtyShapeDefVoxels, voxelChunk);
+			faceEnableChunk.update(dirtyFaceActivationVoxels, voxelChunk);
+		});
+
+		const auto newChunkIter = std::find(newChunkPositions.begin(), newChunkPositions.end(), chunkPos);
+		if (newChunkIter != newChunkPositions.end())
+		{
+			this->jobGraph.addDependency(jobID, static_cast<int>(std::distance(newChunkPositions.begin(), newChunkIter)));
+		}
 	}
+
+	jobSystem.run(this->jobGraph);
+	this->jobGraph.clear();
 }
@@ -4,6 +4,7 @@
 #include "VoxelFaceEnableChunk.h"
 #include "../World/SpecializedChunkManager.h"
 
+#include "components/utilities/JobSystem.h"
 #include "components/utilities/Span.h"
 
 class VoxelChunkManager;
@@ -11,11 +12,16 @@ class VoxelChunkManager;
 // Tracks which voxel faces within each chunk are internal faces blocked by opaque neighbor blocks.
 class VoxelFaceEnableChunkManager final : public SpecializedChunkManager<VoxelFaceEnableChunk>
 {
+private:
+	JobGraph jobGraph;
 public:
 	void updateActiveChunks(Span<const ChunkInt2> newChunkPositions, Span<const ChunkInt2> freedChunkPositions,
 		const VoxelChunkManager &voxelChunkManager);
+
+	// Updates chunks in parallel. A job only writes its own face enable chunk and only reads the voxel chunk at
+	// the same position.
 	void update(Span<const ChunkInt2> activeChunkPositions, Span<const ChunkInt2> newChunkPositions,
-		const VoxelChunkManager &voxelChunkManager);
+		const VoxelChunkManager &voxelChunkManager, JobSystem &jobSystem);
 };
 
 #endif
@@ -14,12 +14,12 @@ void VoxelFrustumCullingChunkManager::update(Span<const ChunkInt2> newChunkPosit
 	{
 		const VoxelChunk &voxelChunk = voxelChunkManager.getChunkAtPosition(chunkPos);
 
-		const int spawnIndex = this->spawnChunk();
+		const int spawnIndex = this->spawnChunk(chunkPos);
 		VoxelFrustumCullingChunk &visChunk = this->getChunkAtIndex(spawnIndex);
 		visChunk.init(chunkPos, voxelChunk.height, ceilingScale);
 	}
 
-	this->chunkPool.clear();
+	this->trimChunkPool();
 
 	for (ChunkPtr &chunkPtr : this->activeChunks)
 	{
@@ -159,19 +159,13 @@ void ArenaCityUtils::generateCity(uint32_t citySeed, int cityDim, WEInt gridDept
 			const std::string blockMifName = MIFUtils::makeCityBlockMifName(block, random);
 
 			// Load the block's .MIF data into the level.
-			const auto &cityBlockMifs = ArenaLevelLibrary::getInstance().getCityBlockMifs();
-			const auto iter = std::find_if(cityBlockMifs.begin(), cityBlockMifs.end(),
-				[&blockMifName](const MIFFile &mif)
-			{
-				return mif.getFilename() == blockMifName;
-			});
-
-			if (iter == cityBlockMifs.end())
+			const MIFFile *blockMifPtr = ArenaLevelLibrary::getInstance().tryGetCityBlockMif(blockMifName);
+			if (blockMifPtr == nullptr)
 			{
 				DebugCrash("Could not find .MIF file \"" + blockMifName + "\".");
 			}
 
-			const MIFFile &blockMif = *iter;
+			const MIFFile &blockMif = *blockMifPtr;
 			const WEInt blockWidth = blockMif.getWidth();
 			const SNInt blockDepth = blockMif.getDepth();
 			const auto &blockLevel = blockMif.getLevel(0);
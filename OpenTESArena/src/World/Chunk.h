@@ -23,11 +23,12 @@ protected:
 	void init(const ChunkInt2 &position, int height);
 	void clear();
 
-	template<typename VoxelIdType>
-	void getAdjacentIDsInternal(const VoxelInt3 &voxel, Span3D<const VoxelIdType> voxelIDs, VoxelIdType defaultID,
+	// The voxel IDs can be any 3D container with get(x, y, z).
+	template<typename VoxelIdType, typename VoxelIdBufferType>
+	void getAdjacentIDsInternal(const VoxelInt3 &voxel, const VoxelIdBufferType &voxelIDs, VoxelIdType defaultID,
 		VoxelIdType *outNorthID, VoxelIdType *outEastID, VoxelIdType *outSouthID, VoxelIdType *outWestID) const
 	{
-		auto getIdOrDefault = [this, voxelIDs, defaultID](const VoxelInt3 &voxel)
+		auto getIdOrDefault = [this, &voxelIDs, defaultID](const VoxelInt3 &voxel) -> VoxelIdType
 		{
 			if (!this->isValidVoxel(voxel.x, voxel.y, voxel.z))
 			{
@@ -0,0 +1,320 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#include "ChunkDeltaCache.h"
+
+#include "components/debug/Debug.h"
+
+namespace
+{
+	// Spill file record: chunk X and Y (int32), faded voxel count and entity delta count (uint16), then
+	// three bytes per faded voxel and five bytes per entity delta.
+	constexpr int RECORD_HEADER_SIZE = (sizeof(int32_t) * 2) + (sizeof(uint16_t) * 2);
+	constexpr int RECORD_VOXEL_SIZE = sizeof(uint8_t) * 3;
+	constexpr int RECORD_ENTITY_DELTA_SIZE = (sizeof(uint16_t) * 2) + sizeof(uint8_t);
+
+	template<typename T>
+	void WriteValue(std::vector<uint8_t> &bytes, T value)
+	{
+		const size_t index = bytes.size();
+		bytes.resize(index + sizeof(T));
+		std::memcpy(bytes.data() + index, &value, sizeof(T));
+	}
+
+	template<typename T>
+	T ReadValue(const uint8_t *&ptr)
+	{
+		T value;
+		std::memcpy(&value, ptr, sizeof(T));
+		ptr += sizeof(T);
+		return value;
+	}
+}
+
+ChunkEntityDelta::ChunkEntityDelta()
+{
+	this->placementDefIndex = -1;
+	this->positionIndex = -1;
+	this->type = static_cast<ChunkEntityDeltaType>(-1);
+}
+
+bool ChunkDelta::isEmpty() const
+{
+	return this->fadedVoxels.empty() && this->entityDeltas.empty();
+}
+
+bool ChunkDelta::hasEntityDelta(int placementDefIndex, int positionIndex, ChunkEntityDeltaType type) const
+{
+	const auto iter = std::find_if(this->entityDeltas.begin(), this->entityDeltas.end(),
+		[placementDefIndex, positionIndex, type](const ChunkEntityDelta &entityDelta)
+	{
+		return (entityDelta.placementDefIndex == placementDefIndex) && (entityDelta.positionIndex == positionIndex) &&
+			(entityDelta.type == type);
+	});
+
+	return iter != this->entityDeltas.end();
+}
+
+void ChunkDelta::addFadedVoxel(const VoxelInt3 &voxel)
+{
+	DebugAssert(voxel.x >= 0 && voxel.x <= UINT8_MAX);
+	DebugAssert(voxel.y >= 0 && voxel.y <= UINT8_MAX);
+	DebugAssert(voxel.z >= 0 && voxel.z <= UINT8_MAX);
+
+	const auto iter = std::find(this->fadedVoxels.begin(), this->fadedVoxels.end(), voxel);
+	if (iter == this->fadedVoxels.end())
+	{
+		this->fadedVoxels.emplace_back(voxel);
+	}
+}
+
+void ChunkDelta::addEntityDelta(const ChunkEntityDelta &entityDelta)
+{
+	DebugAssert(entityDelta.placementDefIndex >= 0 && entityDelta.placementDefIndex <= UINT16_MAX);
+	DebugAssert(entityDelta.positionIndex >= 0 && entityDelta.positionIndex <= UINT16_MAX);
+
+	if (this->hasEntityDelta(entityDelta.placementDefIndex, entityDelta.positionIndex, ChunkEntityDeltaType::Removed))
+	{
+		// Nothing else matters once the entity is gone.
+		return;
+	}
+
+	if (entityDelta.type == ChunkEntityDeltaType::Removed)
+	{
+		this->entityDeltas.erase(std::remove_if(this->entityDeltas.begin(), this->entityDeltas.end(),
+			[&entityDelta](const ChunkEntityDelta &existingDelta)
+		{
+			return (existingDelta.placementDefIndex == entityDelta.placementDefIndex) &&
+				(existingDelta.positionIndex == entityDelta.positionIndex);
+		}), this->entityDeltas.end());
+	}
+	else if (this->hasEntityDelta(entityDelta.placementDefIndex, entityDelta.positionIndex, entityDelta.type))
+	{
+		return;
+	}
+
+	this->entityDeltas.emplace_back(entityDelta);
+}
+
+ChunkDeltaCache::ChunkDeltaCache()
+{
+	this->spillFileSize = 0;
+}
+
+ChunkDeltaCache::~ChunkDeltaCache()
+{
+	if (!this->spillFilename.empty() && (this->spillFileSize > 0))
+	{
+		std::remove(this->spillFilename.c_str());
+	}
+}
+
+void ChunkDeltaCache::init(const std::string &spillFilename)
+{
+	this->clear();
+	this->spillFilename = spillFilename;
+}
+
+int ChunkDeltaCache::getResidentDeltaCount() const
+{
+	return static_cast<int>(this->residentDeltas.size());
+}
+
+int ChunkDeltaCache::getSpilledDeltaCount() const
+{
+	return static_cast<int>(this->spilledDeltaOffsets.size());
+}
+
+bool ChunkDeltaCache::trySpillDelta(const ChunkInt2 &chunkPos, const ChunkDelta &delta)
+{
+	const int voxelCount = static_cast<int>(delta.fadedVoxels.size());
+	const int entityDeltaCount = static_cast<int>(delta.entityDeltas.size());
+	if ((voxelCount > UINT16_MAX) || (entityDeltaCount > UINT16_MAX))
+	{
+		return false;
+	}
+
+	std::vector<uint8_t> bytes;
+	bytes.reserve(RECORD_HEADER_SIZE + (voxelCount * RECORD_VOXEL_SIZE) + (entityDeltaCount * RECORD_ENTITY_DELTA_SIZE));
+	WriteValue<int32_t>(bytes, chunkPos.x);
+	WriteValue<int32_t>(bytes, chunkPos.y);
+	WriteValue<uint16_t>(bytes, static_cast<uint16_t>(voxelCount));
+	WriteValue<uint16_t>(bytes, static_cast<uint16_t>(entityDeltaCount));
+
+	for (const VoxelInt3 &voxel : delta.fadedVoxels)
+	{
+		WriteValue<uint8_t>(bytes, static_cast<uint8_t>(voxel.x));
+		WriteValue<uint8_t>(bytes, static_cast<uint8_t>(voxel.y));
+		WriteValue<uint8_t>(bytes, static_cast<uint8_t>(voxel.z));
+	}
+
+	for (const ChunkEntityDelta &entityDelta : delta.entityDeltas)
+	{
+		WriteValue<uint16_t>(bytes, static_cast<uint16_t>(entityDelta.placementDefIndex));
+		WriteValue<uint16_t>(bytes, static_cast<uint16_t>(entityDelta.positionIndex));
+		WriteValue<uint8_t>(bytes, static_cast<uint8_t>(entityDelta.type));
+	}
+
+	const std::ios::openmode openMode = std::ios::binary | ((this->spillFileSize > 0) ? std::ios::app : std::ios::trunc);
+	std::ofstream ofs(this->spillFilename, openMode);
+	if (!ofs.is_open())
+	{
+		DebugLogWarningFormat("Couldn't open chunk delta spill file \"%s\", keeping deltas in memory.", this->spillFilename.c_str());
+		this->spillFilename.clear();
+		return false;
+	}
+
+	ofs.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+	if (!ofs.good())
+	{
+		DebugLogWarningFormat("Couldn't write chunk (%s) delta to \"%s\".", chunkPos.toString().c_str(), this->spillFilename.c_str());
+		return false;
+	}
+
+	this->spilledDeltaOffsets[chunkPos] = this->spillFileSize;
+	this->spillFileSize += static_cast<int64_t>(bytes.size());
+	return true;
+}
+
+bool ChunkDeltaCache::tryReadSpilledDelta(int64_t offset, ChunkDelta *outDelta) const
+{
+	std::ifstream ifs(this->spillFilename, std::ios::binary);
+	if (!ifs.is_open())
+	{
+		DebugLogErrorFormat("Couldn't open chunk delta spill file \"%s\".", this->spillFilename.c_str());
+		return false;
+	}
+
+	ifs.seekg(offset);
+
+	uint8_t headerBytes[RECORD_HEADER_SIZE];
+	if (!ifs.read(reinterpret_cast<char*>(headerBytes), RECORD_HEADER_SIZE))
+	{
+		DebugLogErrorFormat("Couldn't read chunk delta header at offset %lld.", static_cast<long long>(offset));
+		return false;
+	}
+
+	const uint8_t *headerPtr = headerBytes;
+	ReadValue<int32_t>(headerPtr);
+	ReadValue<int32_t>(headerPtr);
+	const int voxelCount = ReadValue<uint16_t>(headerPtr);
+	const int entityDeltaCount = ReadValue<uint16_t>(headerPtr);
+
+	std::vector<uint8_t> bytes((voxelCount * RECORD_VOXEL_SIZE) + (entityDeltaCount * RECORD_ENTITY_DELTA_SIZE));
+	if (!ifs.read(reinterpret_cast<char*>(bytes.data()), bytes.size()))
+	{
+		DebugLogErrorFormat("Couldn't read chunk delta at offset %lld.", static_cast<long long>(offset));
+		return false;
+	}
+
+	const uint8_t *ptr = bytes.data();
+	outDelta->fadedVoxels.resize(voxelCount);
+	for (VoxelInt3 &voxel : outDelta->fadedVoxels)
+	{
+		voxel.x = ReadValue<uint8_t>(ptr);
+		voxel.y = ReadValue<uint8_t>(ptr);
+		voxel.z = ReadValue<uint8_t>(ptr);
+	}
+
+	outDelta->entityDeltas.resize(entityDeltaCount);
+	for (ChunkEntityDelta &entityDelta : outDelta->entityDeltas)
+	{
+		entityDelta.placementDefIndex = ReadValue<uint16_t>(ptr);
+		entityDelta.positionIndex = ReadValue<uint16_t>(ptr);
+		entityDelta.type = static_cast<ChunkEntityDeltaType>(ReadValue<uint8_t>(ptr));
+	}
+
+	return true;
+}
+
+ChunkDelta *ChunkDeltaCache::findDelta(const ChunkInt2 &chunkPos)
+{
+	const auto residentIter = this->residentDeltas.find(chunkPos);
+	if (residentIter != this->residentDeltas.end())
+	{
+		return &residentIter->second;
+	}
+
+	const auto spilledIter = this->spilledDeltaOffsets.find(chunkPos);
+	if (spilledIter == this->spilledDeltaOffsets.end())
+	{
+		return nullptr;
+	}
+
+	// The record stays in the file but is stale from now on, the delta is written again if it gets spilled.
+	ChunkDelta delta;
+	const bool success = this->tryReadSpilledDelta(spilledIter->second, &delta);
+	this->spilledDeltaOffsets.erase(spilledIter);
+	if (!success)
+	{
+		return nullptr;
+	}
+
+	auto insertResult = this->residentDeltas.emplace(chunkPos, std::move(delta));
+	return &insertResult.first->second;
+}
+
+ChunkDelta &ChunkDeltaCache::getOrAddDelta(const ChunkInt2 &chunkPos)
+{
+	ChunkDelta *delta = this->findDelta(chunkPos);
+	if (delta != nullptr)
+	{
+		return *delta;
+	}
+
+	auto insertResult = this->residentDeltas.emplace(chunkPos, ChunkDelta());
+	return insertResult.first->second;
+}
+
+void ChunkDeltaCache::spillInactiveDeltas(Span<const ChunkInt2> activeChunkPositions)
+{
+	if (this->spillFilename.empty() || (static_cast<int>(this->residentDeltas.size()) <= MAX_RESIDENT_INACTIVE_DELTAS))
+	{
+		return;
+	}
+
+	std::vector<ChunkInt2> inactiveChunkPositions;
+	for (const auto &pair : this->residentDeltas)
+	{
+		const ChunkInt2 chunkPos = pair.first;
+		const auto activeIter = std::find(activeChunkPositions.begin(), activeChunkPositions.end(), chunkPos);
+		if (activeIter == activeChunkPositions.end())
+		{
+			inactiveChunkPositions.emplace_back(chunkPos);
+		}
+	}
+
+	if (static_cast<int>(inactiveChunkPositions.size()) <= MAX_RESIDENT_INACTIVE_DELTAS)
+	{
+		return;
+	}
+
+	for (const ChunkInt2 chunkPos : inactiveChunkPositions)
+	{
+		const auto iter = this->residentDeltas.find(chunkPos);
+		DebugAssert(iter != this->residentDeltas.end());
+
+		const ChunkDelta &delta = iter->second;
+		if (!delta.isEmpty() && !this->trySpillDelta(chunkPos, delta))
+		{
+			continue;
+		}
+
+		this->residentDeltas.erase(iter);
+	}
+}
+
+void ChunkDeltaCache::clear()
+{
+	this->residentDeltas.clear();
+	this->spilledDeltaOffsets.clear();
+
+	if (!this->spillFilename.empty() && (this->spillFileSize > 0))
+	{
+		std::remove(this->spillFilename.c_str());
+	}
+
+	this->spillFileSize = 0;
+}
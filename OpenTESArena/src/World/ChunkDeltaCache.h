@@ -0,0 +1,78 @@
+#ifndef CHUNK_DELTA_CACHE_H
+#define CHUNK_DELTA_CACHE_H
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Coord.h"
+
+#include "components/utilities/Span.h"
+
+enum class ChunkEntityDeltaType : uint8_t
+{
+	Removed, // Killed, picked up, or emptied.
+	Unlocked
+};
+
+// Change to an entity placed by a level definition. Identified by its placement rather than its instance ID
+// so it still matches after the chunk is regenerated.
+struct ChunkEntityDelta
+{
+	int placementDefIndex;
+	int positionIndex;
+	ChunkEntityDeltaType type;
+
+	ChunkEntityDelta();
+};
+
+// Gameplay changes to a chunk that aren't in its level definition.
+struct ChunkDelta
+{
+	std::vector<VoxelInt3> fadedVoxels;
+	std::vector<ChunkEntityDelta> entityDeltas;
+
+	bool isEmpty() const;
+	bool hasEntityDelta(int placementDefIndex, int positionIndex, ChunkEntityDeltaType type) const;
+
+	void addFadedVoxel(const VoxelInt3 &voxel);
+	void addEntityDelta(const ChunkEntityDelta &entityDelta);
+};
+
+// Per-map store of chunk deltas, so a revisited chunk is regenerated from its level definition and then has its
+// changes re-applied. Deltas of inactive chunks are spilled to a compact binary file once too many of them are
+// in memory, and read back when their chunk is spawned again.
+class ChunkDeltaCache
+{
+private:
+	static constexpr int MAX_RESIDENT_INACTIVE_DELTAS = 32;
+
+	std::unordered_map<ChunkInt2, ChunkDelta> residentDeltas;
+	std::unordered_map<ChunkInt2, int64_t> spilledDeltaOffsets; // Byte offset of each chunk's record in the spill file.
+	std::string spillFilename; // Empty if deltas can't be spilled.
+	int64_t spillFileSize; // Includes records that were read back and are now stale.
+
+	bool trySpillDelta(const ChunkInt2 &chunkPos, const ChunkDelta &delta);
+	bool tryReadSpilledDelta(int64_t offset, ChunkDelta *outDelta) const;
+public:
+	ChunkDeltaCache();
+	~ChunkDeltaCache();
+
+	void init(const std::string &spillFilename);
+
+	int getResidentDeltaCount() const;
+	int getSpilledDeltaCount() const;
+
+	// Returns null if the chunk has no changes. Reads the delta back into memory if it was spilled.
+	ChunkDelta *findDelta(const ChunkInt2 &chunkPos);
+	ChunkDelta &getOrAddDelta(const ChunkInt2 &chunkPos);
+
+	// Writes deltas of chunks that aren't active to the spill file if there are too many in memory.
+	void spillInactiveDeltas(Span<const ChunkInt2> activeChunkPositions);
+
+	// Forgets all deltas, i.e. when the active map changes.
+	void clear();
+};
+
+#endif
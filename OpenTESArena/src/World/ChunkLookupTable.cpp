@@ -0,0 +1,139 @@
+#include <utility>
+
+#include "ChunkLookupTable.h"
+#include "../Math/MathUtils.h"
+
+#include "components/debug/Debug.h"
+
+namespace
+{
+	// Fits chunk distance 7 (15x15 chunks) without growing.
+	constexpr int DEFAULT_DIMENSION = 16;
+}
+
+ChunkLookupTable::Entry::Entry()
+{
+	this->index = -1;
+}
+
+ChunkLookupTable::ChunkLookupTable()
+{
+	this->count = 0;
+}
+
+int ChunkLookupTable::getSlotX(SNInt x) const
+{
+	// Works for negative positions too since the width is a power of two.
+	return x & (this->entries.getWidth() - 1);
+}
+
+int ChunkLookupTable::getSlotY(WEInt y) const
+{
+	return y & (this->entries.getHeight() - 1);
+}
+
+void ChunkLookupTable::resize(int dimension)
+{
+	DebugAssert(MathUtils::isPowerOf2(dimension));
+
+	Buffer2D<Entry> oldEntries(std::move(this->entries));
+	auto tryInsertOldEntries = [this, &oldEntries]()
+	{
+		for (const Entry &oldEntry : oldEntries)
+		{
+			if (oldEntry.index < 0)
+			{
+				continue;
+			}
+
+			Entry &entry = this->entries.get(this->getSlotX(oldEntry.position.x), this->getSlotY(oldEntry.position.y));
+			if (entry.index >= 0)
+			{
+				return false;
+			}
+
+			entry = oldEntry;
+		}
+
+		return true;
+	};
+
+	while (true)
+	{
+		this->entries.init(dimension, dimension);
+		this->entries.fill(Entry());
+		if (tryInsertOldEntries())
+		{
+			break;
+		}
+
+		// Still colliding, try again with a bigger grid.
+		dimension *= 2;
+	}
+}
+
+int ChunkLookupTable::find(const ChunkInt2 &position) const
+{
+	if (this->count == 0)
+	{
+		return -1;
+	}
+
+	const Entry &entry = this->entries.get(this->getSlotX(position.x), this->getSlotY(position.y));
+	if ((entry.index < 0) || (entry.position != position))
+	{
+		return -1;
+	}
+
+	return entry.index;
+}
+
+void ChunkLookupTable::add(const ChunkInt2 &position, int index)
+{
+	DebugAssert(index >= 0);
+	DebugAssert(this->find(position) < 0);
+
+	if (this->entries.getWidth() == 0)
+	{
+		this->resize(DEFAULT_DIMENSION);
+	}
+
+	while (true)
+	{
+		Entry &entry = this->entries.get(this->getSlotX(position.x), this->getSlotY(position.y));
+		if (entry.index < 0)
+		{
+			entry.position = position;
+			entry.index = index;
+			this->count++;
+			break;
+		}
+
+		this->resize(this->entries.getWidth() * 2);
+	}
+}
+
+void ChunkLookupTable::setIndex(const ChunkInt2 &position, int index)
+{
+	DebugAssert(index >= 0);
+
+	Entry &entry = this->entries.get(this->getSlotX(position.x), this->getSlotY(position.y));
+	DebugAssert(entry.index >= 0);
+	DebugAssert(entry.position == position);
+	entry.index = index;
+}
+
+void ChunkLookupTable::remove(const ChunkInt2 &position)
+{
+	Entry &entry = this->entries.get(this->getSlotX(position.x), this->getSlotY(position.y));
+	DebugAssert(entry.index >= 0);
+	DebugAssert(entry.position == position);
+	entry = Entry();
+	this->count--;
+}
+
+void ChunkLookupTable::clear()
+{
+	this->entries.fill(Entry());
+	this->count = 0;
+}
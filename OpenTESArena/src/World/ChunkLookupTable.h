@@ -0,0 +1,42 @@
+#ifndef CHUNK_LOOKUP_TABLE_H
+#define CHUNK_LOOKUP_TABLE_H
+
+#include "Coord.h"
+
+#include "components/utilities/Buffer2D.h"
+
+// Constant-time chunk position -> chunk index lookup for chunk managers. Positions wrap around a power-of-two
+// grid, so any square of active chunks smaller than the grid lands on unique slots. The grid grows if two
+// positions ever collide, i.e. when the chunk distance is increased.
+class ChunkLookupTable
+{
+private:
+	struct Entry
+	{
+		ChunkInt2 position;
+		int index; // -1 if empty.
+
+		Entry();
+	};
+
+	Buffer2D<Entry> entries;
+	int count;
+
+	int getSlotX(SNInt x) const;
+	int getSlotY(WEInt y) const;
+
+	// Grows the grid until every existing entry has its own slot.
+	void resize(int dimension);
+public:
+	ChunkLookupTable();
+
+	// Returns -1 if the position isn't in the table.
+	int find(const ChunkInt2 &position) const;
+
+	void add(const ChunkInt2 &position, int index);
+	void setIndex(const ChunkInt2 &position, int index);
+	void remove(const ChunkInt2 &position);
+	void clear();
+};
+
+#endif
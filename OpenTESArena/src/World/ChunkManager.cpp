@@ -1,5 +1,3 @@
-#include <algorithm>
-
 #include "ChunkUtils.h"
 #include "ChunkManager.h"
 
@@ -8,6 +6,7 @@
 ChunkManager::ChunkManager()
 {
 	this->centerChunkPosIndex = -1;
+	this->activeChunkCountPerSide = 0;
 }
 
 Span<const ChunkInt2> ChunkManager::getActiveChunkPositions() const
@@ -25,6 +24,11 @@ Span<const ChunkInt2> ChunkManager::getFreedChunkPositions() const
 	return Span<const ChunkInt2>(this->freedChunkPositions);
 }
 
+Span<const ChunkInt2> ChunkManager::getStreamingChunkPositions() const
+{
+	return Span<const ChunkInt2>(this->streamingChunkPositions);
+}
+
 int ChunkManager::getCenterChunkIndex() const
 {
 	return this->centerChunkPosIndex;
@@ -32,15 +36,19 @@ int ChunkManager::getCenterChunkIndex() const
 
 std::optional<int> ChunkManager::findChunkIndex(const ChunkInt2 &position) const
 {
-	const auto iter = std::find(this->activeChunkPositions.begin(), this->activeChunkPositions.end(), position);
-	if (iter != this->activeChunkPositions.end())
-	{
-		return static_cast<int>(std::distance(this->activeChunkPositions.begin(), iter));
-	}
-	else
+	const SNInt offsetX = position.x - this->minActiveChunkPos.x;
+	const WEInt offsetY = position.y - this->minActiveChunkPos.y;
+	const bool isInActiveRange = (offsetX >= 0) && (offsetX < this->activeChunkCountPerSide) &&
+		(offsetY >= 0) && (offsetY < this->activeChunkCountPerSide);
+	if (!isInActiveRange)
 	{
 		return std::nullopt;
 	}
+
+	const int index = offsetX + (offsetY * this->activeChunkCountPerSide);
+	DebugAssertIndex(this->activeChunkPositions, index);
+	DebugAssert(this->activeChunkPositions[index] == position);
+	return index;
 }
 
 void ChunkManager::update(const ChunkInt2 &centerChunkPos, int chunkDistance)
@@ -117,6 +125,27 @@ void ChunkManager::update(const ChunkInt2 &centerChunkPos, int chunkDistance)
 			this->activeChunkPositions.emplace_back(chunkPos);
 		}
 	}
+
+	this->minActiveChunkPos = minChunkPos;
+	this->activeChunkCountPerSide = ChunkUtils::getChunkCountPerSide(chunkDistance);
+
+	// Chunks the player can reach by crossing one more chunk border.
+	const int streamingChunkDistance = chunkDistance + 1;
+	ChunkInt2 minStreamingChunkPos, maxStreamingChunkPos;
+	ChunkUtils::getSurroundingChunks(centerChunkPos, streamingChunkDistance, &minStreamingChunkPos, &maxStreamingChunkPos);
+
+	this->streamingChunkPositions.clear();
+	for (WEInt y = minStreamingChunkPos.y; y <= maxStreamingChunkPos.y; y++)
+	{
+		for (SNInt x = minStreamingChunkPos.x; x <= maxStreamingChunkPos.x; x++)
+		{
+			const ChunkInt2 chunkPos(x, y);
+			if (!ChunkUtils::isWithinActiveRange(centerChunkPos, chunkPos, chunkDistance))
+			{
+				this->streamingChunkPositions.emplace_back(chunkPos);
+			}
+		}
+	}
 }
 
 void ChunkManager::endFrame()
@@ -130,5 +159,8 @@ void ChunkManager::clear()
 	this->activeChunkPositions.clear();
 	this->newChunkPositions.clear();
 	this->freedChunkPositions.clear();
+	this->streamingChunkPositions.clear();
 	this->centerChunkPosIndex = -1;
+	this->minActiveChunkPos = ChunkInt2();
+	this->activeChunkCountPerSide = 0;
 }
@@ -14,13 +14,17 @@ private:
 	std::vector<ChunkInt2> activeChunkPositions; // Active this frame.
 	std::vector<ChunkInt2> newChunkPositions; // Spawned this frame (a subset of the active ones).
 	std::vector<ChunkInt2> freedChunkPositions; // Freed this frame (no longer in the active ones).
+	std::vector<ChunkInt2> streamingChunkPositions; // Ring just outside the active ones, can be populated ahead of time.
 	int centerChunkPosIndex; // Current center of the world.
+	ChunkInt2 minActiveChunkPos; // Active chunks are stored row by row starting here.
+	int activeChunkCountPerSide;
 public:
 	ChunkManager();
 
 	Span<const ChunkInt2> getActiveChunkPositions() const;
 	Span<const ChunkInt2> getNewChunkPositions() const;
 	Span<const ChunkInt2> getFreedChunkPositions() const;
+	Span<const ChunkInt2> getStreamingChunkPositions() const;
 	int getCenterChunkIndex() const;
 	std::optional<int> findChunkIndex(const ChunkInt2 &position) const;
 
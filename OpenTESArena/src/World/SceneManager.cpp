@@ -8,6 +8,7 @@
 #include "../Rendering/RendererUtils.h"
 #include "../Time/ArenaClockUtils.h"
 #include "../Time/ClockLibrary.h"
+#include "../Utilities/Platform.h"
 
 #include "components/debug/Debug.h"
 
@@ -62,6 +63,9 @@ void SceneManager::init(TextureManager &textureManager, Renderer &renderer)
 	this->noneDitherTextureRef.init(noneDitherTextureID, renderer);
 	this->classicDitherTextureRef.init(classicDitherTextureID, renderer);
 	this->modernDitherTextureRef.init(modernDitherTextureID, renderer);
+
+	const std::string chunkDeltaSpillFilename = Platform::getCachePath() + "chunk_deltas.bin";
+	this->chunkDeltaCache.init(chunkDeltaSpillFilename);
 }
 
 void SceneManager::updateGameWorldPalette(bool isInterior, WeatherType weatherType, bool isFoggy, double dayPercent, TextureManager &textureManager)
@@ -192,11 +196,66 @@ void SceneManager::updateGameWorldPalette(bool isInterior, WeatherType weatherTy
 	this->gameWorldPaletteTextureRef.unlockTexels();
 }
 
+void SceneManager::setChunkPoolCapacity(int capacity)
+{
+	this->voxelChunkManager.setChunkPoolCapacity(capacity);
+	this->entityChunkManager.setChunkPoolCapacity(capacity);
+	this->voxelBoxCombineChunkManager.setChunkPoolCapacity(capacity);
+	this->voxelFaceEnableChunkManager.setChunkPoolCapacity(capacity);
+	this->voxelFaceCombineChunkManager.setChunkPoolCapacity(capacity);
+	this->collisionChunkManager.setChunkPoolCapacity(capacity);
+	this->voxelFrustumCullingChunkManager.setChunkPoolCapacity(capacity);
+	this->entityVisChunkManager.setChunkPoolCapacity(capacity);
+	this->renderVoxelChunkManager.setChunkPoolCapacity(capacity);
+}
+
+void SceneManager::freeChunkPools()
+{
+	this->voxelChunkManager.freeChunkPool();
+	this->entityChunkManager.freeChunkPool();
+	this->voxelBoxCombineChunkManager.freeChunkPool();
+	this->voxelFaceEnableChunkManager.freeChunkPool();
+	this->voxelFaceCombineChunkManager.freeChunkPool();
+	this->collisionChunkManager.freeChunkPool();
+	this->voxelFrustumCullingChunkManager.freeChunkPool();
+	this->entityVisChunkManager.freeChunkPool();
+	this->renderVoxelChunkManager.freeChunkPool();
+}
+
+int SceneManager::getPooledChunkCount() const
+{
+	return this->voxelChunkManager.getPooledChunkCount() +
+		this->entityChunkManager.getPooledChunkCount() +
+		this->voxelBoxCombineChunkManager.getPooledChunkCount() +
+		this->voxelFaceEnableChunkManager.getPooledChunkCount() +
+		this->voxelFaceCombineChunkManager.getPooledChunkCount() +
+		this->collisionChunkManager.getPooledChunkCount() +
+		this->voxelFrustumCullingChunkManager.getPooledChunkCount() +
+		this->entityVisChunkManager.getPooledChunkCount() +
+		this->renderVoxelChunkManager.getPooledChunkCount();
+}
+
+int SceneManager::getChunkAllocationCount() const
+{
+	return this->voxelChunkManager.getChunkAllocationCount() +
+		this->entityChunkManager.getChunkAllocationCount() +
+		this->voxelBoxCombineChunkManager.getChunkAllocationCount() +
+		this->voxelFaceEnableChunkManager.getChunkAllocationCount() +
+		this->voxelFaceCombineChunkManager.getChunkAllocationCount() +
+		this->collisionChunkManager.getChunkAllocationCount() +
+		this->voxelFrustumCullingChunkManager.getChunkAllocationCount() +
+		this->entityVisChunkManager.getChunkAllocationCount() +
+		this->renderVoxelChunkManager.getChunkAllocationCount();
+}
+
 void SceneManager::endFrame(JPH::PhysicsSystem &physicsSystem, Renderer &renderer)
 {
 	this->chunkManager.endFrame();
 	this->voxelChunkManager.endFrame();
+	this->entityChunkManager.writeChunkDeltas(this->chunkDeltaCache);
 	this->entityChunkManager.endFrame(physicsSystem, renderer);
+	this->rayCastEntityIndex.clear();
+	this->chunkDeltaCache.spillInactiveDeltas(this->chunkManager.getActiveChunkPositions());
 	this->voxelFaceCombineChunkManager.endFrame();
 	this->renderVoxelChunkManager.endFrame();
 	this->renderEntityManager.endFrame();
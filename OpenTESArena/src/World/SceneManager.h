@@ -4,9 +4,11 @@
 #include "Jolt/Jolt.h"
 #include "Jolt/Physics/PhysicsSystem.h"
 
+#include "ChunkDeltaCache.h"
 #include "ChunkManager.h"
 #include "../Assets/TextureUtils.h"
 #include "../Collision/CollisionChunkManager.h"
+#include "../Collision/RayCastEntityIndex.h"
 #include "../Entities/EntityChunkManager.h"
 #include "../Entities/EntityVisibilityChunkManager.h"
 #include "../Rendering/RenderEntityManager.h"
@@ -43,6 +45,12 @@ struct SceneManager
 	RenderVoxelChunkManager renderVoxelChunkManager;
 	RenderEntityManager renderEntityManager;
 
+	// Changes to the active map's chunks, re-applied when a chunk is spawned again.
+	ChunkDeltaCache chunkDeltaCache;
+
+	// Voxels touched by entities, shared by ray casts until entities next change.
+	RayCastEntityIndex rayCastEntityIndex;
+
 	// Game world systems not tied to chunks.
 	SkyInstance skyInstance;
 	SkyVisibilityManager skyVisManager;
@@ -67,6 +75,13 @@ struct SceneManager
 
 	void init(TextureManager &textureManager, Renderer &renderer);
 	void updateGameWorldPalette(bool isInterior, WeatherType weatherType, bool isFoggy, double dayPercent, TextureManager &textureManager);
+
+	// Zero sizes each chunk manager's pool automatically from its active chunk count.
+	void setChunkPoolCapacity(int capacity);
+	void freeChunkPools();
+	int getPooledChunkCount() const;
+	int getChunkAllocationCount() const;
+
 	void endFrame(JPH::PhysicsSystem &physicsSystem, Renderer &renderer);
 };
 
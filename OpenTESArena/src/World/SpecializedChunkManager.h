@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "Chunk.h"
+#include "ChunkLookupTable.h"
 
 #include "components/debug/Debug.h"
 
@@ -21,22 +22,21 @@ protected:
 	template<typename VoxelIdType>
 	using VoxelIdFunc = VoxelIdType(*)(const ChunkType &chunk, const VoxelInt3 &voxel);
 
-	std::vector<ChunkPtr> chunkPool;
+	std::vector<ChunkPtr> chunkPool; // Recycled chunks that keep their allocations for the next spawn.
 	std::vector<ChunkPtr> activeChunks;
+	ChunkLookupTable activeChunkIndices;
+	int chunkPoolCapacity; // Zero sizes the pool automatically from the active chunk count.
+	int chunkAllocationCount; // Total chunks ever allocated, stays flat once the pool is warm.
 
-	int findChunkIndex(const ChunkInt2 &position) const
+	SpecializedChunkManager()
 	{
-		const int chunkCount = static_cast<int>(this->activeChunks.size());
-		for (int i = 0; i < chunkCount; i++)
-		{
-			const ChunkPtr &chunkPtr = this->activeChunks[i];
-			if (chunkPtr->position == position)
-			{
-				return i;
-			}
-		}
+		this->chunkPoolCapacity = 0;
+		this->chunkAllocationCount = 0;
+	}
 
-		return -1;
+	int findChunkIndex(const ChunkInt2 &position) const
+	{
+		return this->activeChunkIndices.find(position);
 	}
 
 	int getChunkIndex(const ChunkInt2 &position) const
@@ -84,7 +84,7 @@ protected:
 		int cachedChunkIndices[4];
 		int cachedChunkPositionCount = 0;
 
-		// Reuse chunk index lookups as they get expensive with large view distance.
+		// Reuse chunk index lookups for adjacent voxels in the same chunk.
 		for (int i = 0; i < static_cast<int>(std::size(adjacentCoords)); i++)
 		{
 			const CoordInt3 adjacentCoord = adjacentCoords[i];
@@ -127,21 +127,37 @@ protected:
 		}
 	}
 
-	// Takes a chunk from the chunk pool, moves it to the active chunks, and returns its index.
-	int spawnChunk()
+	// Moves an already-initialized chunk to the active chunks and returns its index.
+	int addActiveChunk(ChunkPtr &&chunkPtr)
+	{
+		const int index = static_cast<int>(this->activeChunks.size());
+		this->activeChunkIndices.add(chunkPtr->position, index);
+		this->activeChunks.emplace_back(std::move(chunkPtr));
+		return index;
+	}
+
+	// Takes a chunk from the chunk pool or allocates one if the pool is empty.
+	ChunkPtr takePooledChunk()
 	{
 		if (!this->chunkPool.empty())
 		{
-			this->activeChunks.emplace_back(std::move(this->chunkPool.back()));
+			ChunkPtr chunkPtr = std::move(this->chunkPool.back());
 			this->chunkPool.pop_back();
+			return chunkPtr;
 		}
-		else
-		{
-			// Always allow expanding in the event that chunk distance is increased.
-			this->activeChunks.emplace_back(std::make_unique<ChunkType>());
-		}
 
-		return static_cast<int>(this->activeChunks.size()) - 1;
+		// Always allow expanding in the event that chunk distance is increased.
+		this->chunkAllocationCount++;
+		return std::make_unique<ChunkType>();
+	}
+
+	// Takes a chunk from the chunk pool, moves it to the active chunks, and returns its index. The caller
+	// must initialize the chunk with the same position.
+	int spawnChunk(const ChunkInt2 &position)
+	{
+		ChunkPtr chunkPtr = this->takePooledChunk();
+		chunkPtr->position = position;
+		return this->addActiveChunk(std::move(chunkPtr));
 	}
 
 	// Clears the chunk and removes it from the active chunks.
@@ -151,13 +167,35 @@ protected:
 		ChunkPtr &chunkPtr = this->activeChunks[index];
 		const ChunkInt2 chunkPos = chunkPtr->position;
 
-		// @todo: save chunk changes
+		// Gameplay changes to voxels and entities are already in the chunk delta cache, they get saved as they happen.
 
 		// Move chunk to chunk pool. It's okay to shift chunk pointers around because this is during the 
-		// time when references get invalidated.
+		// time when references get invalidated. The last chunk takes this one's place so only it needs
+		// a new index.
+		this->activeChunkIndices.remove(chunkPos);
 		chunkPtr->clear();
 		this->chunkPool.emplace_back(std::move(chunkPtr));
-		this->activeChunks.erase(this->activeChunks.begin() + index);
+
+		const int lastIndex = static_cast<int>(this->activeChunks.size()) - 1;
+		if (index != lastIndex)
+		{
+			chunkPtr = std::move(this->activeChunks[lastIndex]);
+			this->activeChunkIndices.setIndex(chunkPtr->position, index);
+		}
+
+		this->activeChunks.pop_back();
+	}
+
+	// Frees pooled chunks beyond the pool capacity. With an automatic capacity this only frees memory once
+	// the chunk distance decreases, otherwise the same chunks are reused every time the player crosses a
+	// chunk border.
+	void trimChunkPool()
+	{
+		const int capacity = this->getChunkPoolCapacity();
+		if (static_cast<int>(this->chunkPool.size()) > capacity)
+		{
+			this->chunkPool.resize(capacity);
+		}
 	}
 public:
 	int getChunkCount() const
@@ -211,6 +249,48 @@ public:
 		return this->getChunkAtIndex(index);
 	}
 
+	// Max number of chunks kept in the pool between updates.
+	int getChunkPoolCapacity() const
+	{
+		if (this->chunkPoolCapacity > 0)
+		{
+			return this->chunkPoolCapacity;
+		}
+
+		// Enough for a diagonal chunk border crossing, which frees two edges of the active chunk square.
+		const int activeChunkCount = static_cast<int>(this->activeChunks.size());
+		int activeChunkCountPerSide = 0;
+		while ((activeChunkCountPerSide * activeChunkCountPerSide) < activeChunkCount)
+		{
+			activeChunkCountPerSide++;
+		}
+
+		return std::max((activeChunkCountPerSide * 2) - 1, 0);
+	}
+
+	// Zero for automatic. Takes effect at the next update.
+	void setChunkPoolCapacity(int capacity)
+	{
+		DebugAssert(capacity >= 0);
+		this->chunkPoolCapacity = capacity;
+	}
+
+	int getPooledChunkCount() const
+	{
+		return static_cast<int>(this->chunkPool.size());
+	}
+
+	int getChunkAllocationCount() const
+	{
+		return this->chunkAllocationCount;
+	}
+
+	// Frees every pooled chunk, i.e. when the operating system is low on memory.
+	void freeChunkPool()
+	{
+		this->chunkPool.clear();
+	}
+
 	void recycleAllChunks()
 	{
 		for (int i = static_cast<int>(this->activeChunks.size()) - 1; i >= 0; i--)
@@ -61,6 +61,26 @@ public:
     }
 };
 
+// Reads from bytes that are already in memory, i.e. a memory-mapped archive. Doesn't own the bytes.
+class MemoryStreamBuf : public std::streambuf {
+public:
+    MemoryStreamBuf(const char *begin, const char *end);
+
+    virtual pos_type seekoff(off_type offset, std::ios_base::seekdir whence, std::ios_base::openmode mode);
+    virtual pos_type seekpos(pos_type pos, std::ios_base::openmode mode);
+};
+
+class MemoryStream : public std::istream {
+    MemoryStreamBuf mBuf;
+
+public:
+    MemoryStream(const char *begin, const char *end)
+        : std::istream(nullptr), mBuf(begin, end)
+    {
+        rdbuf(&mBuf);
+    }
+};
+
 
 class Archive {
 public:
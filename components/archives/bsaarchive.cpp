@@ -3,6 +3,7 @@
 #include <fstream>
 
 #include "bsaarchive.hpp"
+#include "../debug/Debug.h"
 #include "../dos/DOSUtils.h"
 
 namespace Archives
@@ -65,10 +66,19 @@ void BsaArchive::load(const std::string &fname)
 
     mEntries.reserve(count);
     loadNamed(count, stream);
+
+    if(!mMapping.init(mFilename.c_str()))
+        DebugLogWarning("Couldn't memory-map "+mFilename+", reading entries from disk instead.");
 }
 
 IStreamPtr BsaArchive::open(const Entry &entry)
 {
+    if(mMapping.isValid())
+    {
+        const char *data = reinterpret_cast<const char*>(mMapping.getBytes().begin());
+        return IStreamPtr(new MemoryStream(data + entry.mStart, data + entry.mEnd));
+    }
+
     std::unique_ptr<std::istream> stream(new std::ifstream(mFilename, std::ios::binary));
     if(!stream->seekg(entry.mStart))
         return IStreamPtr(nullptr);
@@ -88,4 +98,22 @@ bool BsaArchive::exists(const char *name) const
     return std::binary_search(mLookupName.begin(), mLookupName.end(), name);
 }
 
+bool BsaArchive::tryGetBytes(const char *name, Span<const std::byte> *outBytes) const
+{
+    if(!mMapping.isValid())
+        return false;
+
+    auto iter = std::lower_bound(mLookupName.begin(), mLookupName.end(), name);
+    if(iter == mLookupName.end() || *iter != name)
+        return false;
+
+    const Entry &entry = mEntries[std::distance(mLookupName.begin(), iter)];
+    const Span<const std::byte> bytes = mMapping.getBytes();
+    if(entry.mEnd > bytes.getCount())
+        return false;
+
+    *outBytes = Span<const std::byte>(bytes.begin() + entry.mStart, static_cast<int>(entry.mEnd - entry.mStart));
+    return true;
+}
+
 } // namespace Archives
@@ -7,6 +7,8 @@
 #include <set>
 
 #include "archive.hpp"
+#include "../utilities/MappedFile.h"
+#include "../utilities/Span.h"
 
 
 namespace Archives
@@ -22,6 +24,7 @@ class BsaArchive : public Archive {
     std::vector<Entry> mEntries;
 
     std::string mFilename;
+    MappedFile mMapping; // Entries are opened from disk if mapping failed.
 
     void loadNamed(size_t count, std::istream &stream);
 
@@ -32,6 +35,10 @@ public:
 
     virtual IStreamPtr open(const char *name) override;
     virtual bool exists(const char *name) const override;
+
+    // Points at the entry's bytes in the memory-mapped archive. Fails if the entry doesn't exist or the
+    // archive couldn't be mapped.
+    bool tryGetBytes(const char *name, Span<const std::byte> *outBytes) const;
     virtual const std::vector<std::string> &list() const override final { return mLookupName; }
 };
 
@@ -4,6 +4,7 @@
 #include <ctime>
 #include <fstream>
 #include <iostream>
+#include <mutex>
 
 #include "SDL_messagebox.h"
 
@@ -40,6 +41,7 @@ namespace Log
 
 	char pathBuffer[1024];
 	std::ofstream stream;
+	std::mutex mutex; // Messages can come from job threads.
 }
 
 bool Debug::init(const char *logDirectory)
@@ -125,6 +127,7 @@ std::string Debug::makeOutputString(const char *__file__, int lineNumber, const
 
 void Debug::write(const char *message)
 {
+	std::lock_guard<std::mutex> lock(Log::mutex);
 	std::cerr << message;
 	Log::stream << message;
 }
@@ -104,6 +104,18 @@ public:
 		this->depth = depth;
 	}
 
+	// Same as init() but keeps the current allocation if the dimensions match, in which case elements keep
+	// their old values. For pooled objects that fill the buffer right after.
+	void initOrReuse(int width, int height, int depth)
+	{
+		if (this->isValid() && (this->width == width) && (this->height == height) && (this->depth == depth))
+		{
+			return;
+		}
+
+		this->init(width, height, depth);
+	}
+
 	bool isValid() const
 	{
 		return this->data != nullptr;
@@ -0,0 +1,333 @@
+#include <chrono>
+
+#include "JobSystem.h"
+#include "../debug/Debug.h"
+
+JobGraph::JobGraph()
+	: readyPushIndex(0), readyPopIndex(0), completedJobCount(0), activeThreadCount(0)
+{
+	this->jobCount = 0;
+}
+
+int JobGraph::getJobCount() const
+{
+	return this->jobCount;
+}
+
+int JobGraph::addJob(JobFunc &&func)
+{
+	const int jobID = this->jobCount;
+	if (jobID == static_cast<int>(this->jobs.size()))
+	{
+		this->jobs.emplace_back();
+	}
+
+	Job &job = this->jobs[jobID];
+	job.func = std::move(func);
+	job.dependencyCount = 0;
+	job.dependentJobIDs.clear();
+
+	this->jobCount++;
+	return jobID;
+}
+
+int JobGraph::addBarrier()
+{
+	return this->addJob(JobFunc());
+}
+
+void JobGraph::addDependency(int jobID, int dependencyJobID)
+{
+	DebugAssert(jobID >= 0);
+	DebugAssert(jobID < this->jobCount);
+	DebugAssert(dependencyJobID >= 0);
+	DebugAssert(dependencyJobID < jobID);
+
+	this->jobs[jobID].dependencyCount++;
+	this->jobs[dependencyJobID].dependentJobIDs.emplace_back(jobID);
+}
+
+void JobGraph::clear()
+{
+	for (int i = 0; i < this->jobCount; i++)
+	{
+		// Release anything captured by the job.
+		this->jobs[i].func = JobFunc();
+	}
+
+	this->jobCount = 0;
+}
+
+JobSystem::JobSystem()
+	: parkedThreadCount(0)
+{
+	this->activeGraph = nullptr;
+	this->graphGeneration = 0;
+	this->shouldExit = false;
+	this->threadBusySeconds.init(1);
+	this->threadBusySeconds.fill(0.0);
+}
+
+JobSystem::~JobSystem()
+{
+	this->shutdown();
+}
+
+void JobSystem::init(int threadCount)
+{
+	DebugAssert(threadCount >= 0);
+	this->shutdown();
+
+	this->threadBusySeconds.init(threadCount + 1);
+	this->threadBusySeconds.fill(0.0);
+
+	this->shouldExit = false;
+	this->threads.reserve(threadCount);
+	for (int i = 0; i < threadCount; i++)
+	{
+		this->threads.emplace_back(&JobSystem::threadLoop, this, i);
+	}
+}
+
+void JobSystem::shutdown()
+{
+	if (this->threads.empty())
+	{
+		return;
+	}
+
+	std::unique_lock<std::mutex> lock(this->mutex);
+	this->shouldExit = true;
+	this->condVar.notify_all();
+	lock.unlock();
+
+	for (std::thread &thread : this->threads)
+	{
+		thread.join();
+	}
+
+	this->threads.clear();
+	this->detachedJobs.clear();
+}
+
+int JobSystem::getThreadCount() const
+{
+	return static_cast<int>(this->threads.size());
+}
+
+double JobSystem::getThreadBusySeconds(int threadIndex) const
+{
+	return this->threadBusySeconds.get(threadIndex);
+}
+
+void JobSystem::wakeParkedThreads()
+{
+	// Taking the lock guarantees a thread between checking its wait condition and sleeping can't miss this.
+	std::unique_lock<std::mutex> lock(this->mutex);
+	lock.unlock();
+	this->condVar.notify_all();
+}
+
+void JobSystem::publishReadyJob(JobGraph &graph, int jobID)
+{
+	const int readyIndex = graph.readyPushIndex.fetch_add(1);
+	DebugAssert(readyIndex < graph.jobCount);
+	graph.readyJobIDs[readyIndex].store(jobID);
+
+	if (this->parkedThreadCount.load() > 0)
+	{
+		this->wakeParkedThreads();
+	}
+}
+
+void JobSystem::finishJob(JobGraph &graph, int jobID)
+{
+	for (const int dependentJobID : graph.jobs[jobID].dependentJobIDs)
+	{
+		if (graph.remainingDependencyCounts[dependentJobID].fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			this->publishReadyJob(graph, dependentJobID);
+		}
+	}
+
+	if ((graph.completedJobCount.fetch_add(1, std::memory_order_acq_rel) + 1) == graph.jobCount)
+	{
+		this->wakeParkedThreads();
+	}
+}
+
+void JobSystem::executeJobs(JobGraph &graph, int threadIndex)
+{
+	double busySeconds = 0.0;
+	int spinCount = 0;
+
+	while (true)
+	{
+		int readyIndex = graph.readyPopIndex.load(std::memory_order_acquire);
+		if (readyIndex >= graph.jobCount)
+		{
+			break;
+		}
+
+		const int jobID = graph.readyJobIDs[readyIndex].load(std::memory_order_acquire);
+		if (jobID >= 0)
+		{
+			if (!graph.readyPopIndex.compare_exchange_weak(readyIndex, readyIndex + 1, std::memory_order_acq_rel))
+			{
+				continue;
+			}
+
+			const JobFunc &func = graph.jobs[jobID].func;
+			if (func)
+			{
+				const auto startTime = std::chrono::high_resolution_clock::now();
+				func();
+				busySeconds += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+			}
+
+			this->finishJob(graph, jobID);
+			spinCount = 0;
+			continue;
+		}
+
+		// Nothing runnable yet, most likely another thread is about to finish a dependency.
+		if (spinCount < JobSystem::SPIN_COUNT)
+		{
+			spinCount++;
+			std::this_thread::yield();
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(this->mutex);
+		this->parkedThreadCount.fetch_add(1);
+		this->condVar.wait(lock, [&graph]()
+		{
+			const int readyIndex = graph.readyPopIndex.load();
+			return (readyIndex >= graph.jobCount) || (graph.readyJobIDs[readyIndex].load() >= 0);
+		});
+
+		this->parkedThreadCount.fetch_sub(1);
+		spinCount = 0;
+	}
+
+	this->threadBusySeconds.set(threadIndex, busySeconds);
+}
+
+void JobSystem::threadLoop(int threadIndex)
+{
+	int seenGraphGeneration = 0;
+	std::unique_lock<std::mutex> lock(this->mutex);
+
+	while (true)
+	{
+		this->condVar.wait(lock, [this, &seenGraphGeneration]()
+		{
+			return this->shouldExit || !this->detachedJobs.empty() ||
+				((this->activeGraph != nullptr) && (this->graphGeneration != seenGraphGeneration));
+		});
+
+		if (this->shouldExit)
+		{
+			break;
+		}
+
+		if (!this->detachedJobs.empty())
+		{
+			JobFunc func = std::move(this->detachedJobs.front());
+			this->detachedJobs.pop_front();
+			lock.unlock();
+
+			func();
+
+			lock.lock();
+			continue;
+		}
+
+		JobGraph &graph = *this->activeGraph;
+		seenGraphGeneration = this->graphGeneration;
+		graph.activeThreadCount.fetch_add(1);
+		lock.unlock();
+
+		this->executeJobs(graph, threadIndex);
+
+		// The graph may be destroyed by run() as soon as this reaches zero.
+		const bool isLastThread = graph.activeThreadCount.fetch_sub(1) == 1;
+		lock.lock();
+
+		if (isLastThread)
+		{
+			this->condVar.notify_all();
+		}
+	}
+}
+
+void JobSystem::run(JobGraph &graph)
+{
+	const int jobCount = graph.jobCount;
+	if (jobCount == 0)
+	{
+		return;
+	}
+
+	if (graph.remainingDependencyCounts.getCount() < jobCount)
+	{
+		graph.remainingDependencyCounts.init(jobCount);
+		graph.readyJobIDs.init(jobCount);
+	}
+
+	for (int i = 0; i < jobCount; i++)
+	{
+		graph.remainingDependencyCounts[i].store(graph.jobs[i].dependencyCount, std::memory_order_relaxed);
+		graph.readyJobIDs[i].store(-1, std::memory_order_relaxed);
+	}
+
+	graph.readyPushIndex.store(0, std::memory_order_relaxed);
+	graph.readyPopIndex.store(0, std::memory_order_relaxed);
+	graph.completedJobCount.store(0, std::memory_order_relaxed);
+	graph.activeThreadCount.store(0, std::memory_order_relaxed);
+	this->threadBusySeconds.fill(0.0);
+
+	for (int i = 0; i < jobCount; i++)
+	{
+		if (graph.jobs[i].dependencyCount == 0)
+		{
+			this->publishReadyJob(graph, i);
+		}
+	}
+
+	std::unique_lock<std::mutex> lock(this->mutex);
+	DebugAssert(this->activeGraph == nullptr);
+	this->activeGraph = &graph;
+	this->graphGeneration++;
+	lock.unlock();
+	this->condVar.notify_all();
+
+	const int callingThreadIndex = this->getThreadCount();
+	this->executeJobs(graph, callingThreadIndex);
+
+	// Other threads might still be finishing their last jobs.
+	for (int i = 0; (i < JobSystem::SPIN_COUNT) && (graph.completedJobCount.load(std::memory_order_acquire) < jobCount); i++)
+	{
+		std::this_thread::yield();
+	}
+
+	lock.lock();
+	this->condVar.wait(lock, [&graph, jobCount]()
+	{
+		return (graph.completedJobCount.load() == jobCount) && (graph.activeThreadCount.load() == 0);
+	});
+
+	this->activeGraph = nullptr;
+}
+
+void JobSystem::queueDetachedJob(JobFunc &&func)
+{
+	DebugAssert(!this->threads.empty());
+
+	std::unique_lock<std::mutex> lock(this->mutex);
+	this->detachedJobs.emplace_back(std::move(func));
+	lock.unlock();
+
+	// Other waiters share the condition variable so notifying one might not reach an idle thread.
+	this->condVar.notify_all();
+}
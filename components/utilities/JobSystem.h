@@ -0,0 +1,105 @@
+#ifndef JOB_SYSTEM_H
+#define JOB_SYSTEM_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Buffer.h"
+
+using JobFunc = std::function<void()>;
+
+// Acyclic graph of jobs where a job becomes runnable once every job it depends on has finished.
+// Built on one thread then handed to a job system. Clearing keeps allocations so it can be rebuilt each frame.
+class JobGraph
+{
+private:
+	struct Job
+	{
+		JobFunc func; // Empty for barriers.
+		int dependencyCount;
+		std::vector<int> dependentJobIDs;
+	};
+
+	std::vector<Job> jobs; // Entries past jobCount are kept for reuse.
+	int jobCount;
+
+	// Execution state, only valid while a job system is running the graph.
+	Buffer<std::atomic<int>> remainingDependencyCounts;
+	Buffer<std::atomic<int>> readyJobIDs; // Append-only list of runnable jobs, -1 until published.
+	std::atomic<int> readyPushIndex;
+	std::atomic<int> readyPopIndex;
+	std::atomic<int> completedJobCount;
+	std::atomic<int> activeThreadCount; // Job system threads currently looking at this graph.
+
+	friend class JobSystem;
+public:
+	JobGraph();
+
+	int getJobCount() const;
+
+	// Returns the ID of the new job.
+	int addJob(JobFunc &&func);
+
+	// Adds a job that does nothing, useful for joining a group of jobs so the next group only needs one dependency each.
+	int addBarrier();
+
+	// The dependency must have been added before the job, which also guarantees there are no cycles.
+	void addDependency(int jobID, int dependencyJobID);
+
+	void clear();
+};
+
+// Fixed set of threads that run job graphs. The thread calling run() also executes jobs, so a job system with
+// zero threads runs everything inline. Threads spin briefly when no job is ready before parking, and only park
+// for real between graphs. Idle threads also run detached jobs, which other schedulers (i.e. physics) use to
+// share these threads instead of starting their own.
+class JobSystem
+{
+private:
+	static constexpr int SPIN_COUNT = 256;
+
+	std::vector<std::thread> threads;
+	std::mutex mutex;
+	std::condition_variable condVar; // Shared by idle threads, threads waiting for a runnable job, and run().
+	JobGraph *activeGraph;
+	int graphGeneration;
+	bool shouldExit;
+	std::atomic<int> parkedThreadCount;
+	std::deque<JobFunc> detachedJobs;
+	Buffer<double> threadBusySeconds; // Time spent in jobs during the last run, the calling thread is last.
+
+	void threadLoop(int threadIndex);
+
+	// Runs jobs until every job in the graph has been taken by some thread.
+	void executeJobs(JobGraph &graph, int threadIndex);
+	void publishReadyJob(JobGraph &graph, int jobID);
+	void finishJob(JobGraph &graph, int jobID);
+	void wakeParkedThreads();
+public:
+	JobSystem();
+	~JobSystem();
+
+	// Starts the given number of background threads.
+	void init(int threadCount);
+	void shutdown();
+
+	// Number of background threads, not including the thread calling run().
+	int getThreadCount() const;
+
+	// Runs the whole graph and returns once every job has finished.
+	void run(JobGraph &graph);
+
+	// Runs the job on the next idle thread without waiting for it. Must not be used with zero threads since
+	// nothing would run it. Jobs still queued at shutdown are dropped.
+	void queueDetachedJob(JobFunc &&func);
+
+	// Index getThreadCount() is the thread that called run().
+	double getThreadBusySeconds(int threadIndex) const;
+};
+
+#endif
@@ -0,0 +1,137 @@
+#ifdef _WIN32
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <limits>
+
+#include "MappedFile.h"
+#include "../debug/Debug.h"
+
+MappedFile::MappedFile()
+{
+	this->data = nullptr;
+	this->size = 0;
+#ifdef _WIN32
+	this->fileHandle = nullptr;
+	this->mappingHandle = nullptr;
+#endif
+}
+
+MappedFile::~MappedFile()
+{
+	this->clear();
+}
+
+bool MappedFile::init(const char *filename)
+{
+	DebugAssert(filename != nullptr);
+	this->clear();
+
+#ifdef _WIN32
+	HANDLE file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		DebugLogWarningFormat("Couldn't open \"%s\" for mapping.", filename);
+		return false;
+	}
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(file, &fileSize) || (fileSize.QuadPart == 0))
+	{
+		CloseHandle(file);
+		return false;
+	}
+
+	HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (mapping == nullptr)
+	{
+		DebugLogWarningFormat("Couldn't create file mapping for \"%s\".", filename);
+		CloseHandle(file);
+		return false;
+	}
+
+	const void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (view == nullptr)
+	{
+		DebugLogWarningFormat("Couldn't map view of \"%s\".", filename);
+		CloseHandle(mapping);
+		CloseHandle(file);
+		return false;
+	}
+
+	this->fileHandle = file;
+	this->mappingHandle = mapping;
+	this->data = static_cast<const std::byte*>(view);
+	this->size = static_cast<size_t>(fileSize.QuadPart);
+#else
+	const int fd = open(filename, O_RDONLY);
+	if (fd < 0)
+	{
+		DebugLogWarningFormat("Couldn't open \"%s\" for mapping.", filename);
+		return false;
+	}
+
+	struct stat fileStat;
+	if ((fstat(fd, &fileStat) != 0) || (fileStat.st_size == 0))
+	{
+		close(fd);
+		return false;
+	}
+
+	const size_t fileSize = static_cast<size_t>(fileStat.st_size);
+	void *view = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+
+	// The mapping keeps its own reference to the file.
+	close(fd);
+
+	if (view == MAP_FAILED)
+	{
+		DebugLogWarningFormat("Couldn't map \"%s\".", filename);
+		return false;
+	}
+
+	this->data = static_cast<const std::byte*>(view);
+	this->size = fileSize;
+#endif
+
+	return true;
+}
+
+bool MappedFile::isValid() const
+{
+	return this->data != nullptr;
+}
+
+Span<const std::byte> MappedFile::getBytes() const
+{
+	DebugAssert(this->size <= static_cast<size_t>(std::numeric_limits<int>::max()));
+	return Span<const std::byte>(this->data, static_cast<int>(this->size));
+}
+
+void MappedFile::clear()
+{
+	if (this->data == nullptr)
+	{
+		return;
+	}
+
+#ifdef _WIN32
+	UnmapViewOfFile(this->data);
+	CloseHandle(static_cast<HANDLE>(this->mappingHandle));
+	CloseHandle(static_cast<HANDLE>(this->fileHandle));
+	this->fileHandle = nullptr;
+	this->mappingHandle = nullptr;
+#else
+	munmap(const_cast<std::byte*>(this->data), this->size);
+#endif
+
+	this->data = nullptr;
+	this->size = 0;
+}
@@ -0,0 +1,34 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+
+#include "Span.h"
+
+// Read-only memory mapping of a whole file. Pages are loaded by the OS on first access, so only the parts
+// that get read cost any memory. Bytes stay valid until the mapping is cleared or destroyed.
+class MappedFile
+{
+private:
+	const std::byte *data;
+	size_t size;
+#ifdef _WIN32
+	void *fileHandle;
+	void *mappingHandle;
+#endif
+public:
+	MappedFile();
+	MappedFile(const MappedFile&) = delete;
+	~MappedFile();
+
+	MappedFile &operator=(const MappedFile&) = delete;
+
+	bool init(const char *filename);
+
+	bool isValid() const;
+	Span<const std::byte> getBytes() const;
+
+	void clear();
+};
+
+#endif
@@ -0,0 +1,150 @@
+#ifndef PACKED_ID_BUFFER3D_H
+#define PACKED_ID_BUFFER3D_H
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+#include "Buffer.h"
+#include "../debug/Debug.h"
+
+// 3D array of small non-negative IDs, i.e. indices into a per-owner list of definitions. Values are stored
+// in 8 bits until one doesn't fit, then the whole buffer is widened to 16 bits.
+class PackedIdBuffer3D
+{
+private:
+	Buffer<uint8_t> narrowValues;
+	Buffer<uint16_t> wideValues; // Only valid once widened, kept around for reuse.
+	int width, height, depth;
+	bool isWide;
+
+	int getIndex(int x, int y, int z) const
+	{
+		DebugAssert(x >= 0);
+		DebugAssert(y >= 0);
+		DebugAssert(z >= 0);
+		DebugAssert(x < this->width);
+		DebugAssert(y < this->height);
+		DebugAssert(z < this->depth);
+		return x + (y * this->width) + (z * this->width * this->height);
+	}
+
+	void widen()
+	{
+		const int count = this->narrowValues.getCount();
+		if (this->wideValues.getCount() != count)
+		{
+			this->wideValues.init(count);
+		}
+
+		std::copy(this->narrowValues.begin(), this->narrowValues.end(), this->wideValues.begin());
+		this->isWide = true;
+	}
+public:
+	static constexpr int MAX_NARROW_VALUE = std::numeric_limits<uint8_t>::max();
+	static constexpr int MAX_VALUE = std::numeric_limits<uint16_t>::max();
+
+	PackedIdBuffer3D()
+	{
+		this->width = 0;
+		this->height = 0;
+		this->depth = 0;
+		this->isWide = false;
+	}
+
+	// Keeps the current allocation if the dimensions match, in which case elements keep their old values.
+	void initOrReuse(int width, int height, int depth)
+	{
+		DebugAssert(width >= 0);
+		DebugAssert(height >= 0);
+		DebugAssert(depth >= 0);
+
+		const int count = width * height * depth;
+		if (this->narrowValues.getCount() != count)
+		{
+			this->narrowValues.init(count);
+			this->isWide = false;
+		}
+
+		this->width = width;
+		this->height = height;
+		this->depth = depth;
+	}
+
+	int getWidth() const
+	{
+		return this->width;
+	}
+
+	int getHeight() const
+	{
+		return this->height;
+	}
+
+	int getDepth() const
+	{
+		return this->depth;
+	}
+
+	// Bytes per element, 1 or 2.
+	int getElementSize() const
+	{
+		return this->isWide ? static_cast<int>(sizeof(uint16_t)) : static_cast<int>(sizeof(uint8_t));
+	}
+
+	int get(int x, int y, int z) const
+	{
+		const int index = this->getIndex(x, y, z);
+		return this->isWide ? static_cast<int>(this->wideValues[index]) : static_cast<int>(this->narrowValues[index]);
+	}
+
+	void set(int x, int y, int z, int value)
+	{
+		DebugAssert(value >= 0);
+		DebugAssert(value <= MAX_VALUE);
+		const int index = this->getIndex(x, y, z);
+
+		if (!this->isWide)
+		{
+			if (value <= MAX_NARROW_VALUE)
+			{
+				this->narrowValues[index] = static_cast<uint8_t>(value);
+				return;
+			}
+
+			this->widen();
+		}
+
+		this->wideValues[index] = static_cast<uint16_t>(value);
+	}
+
+	// Also narrows the buffer again if the value fits.
+	void fill(int value)
+	{
+		DebugAssert(value >= 0);
+		DebugAssert(value <= MAX_VALUE);
+
+		if (value <= MAX_NARROW_VALUE)
+		{
+			this->narrowValues.fill(static_cast<uint8_t>(value));
+			this->isWide = false;
+		}
+		else
+		{
+			this->widen();
+			this->wideValues.fill(static_cast<uint16_t>(value));
+		}
+	}
+
+	void clear()
+	{
+		this->narrowValues.clear();
+		this->wideValues.clear();
+		this->width = 0;
+		this->height = 0;
+		this->depth = 0;
+		this->isWide = false;
+	}
+};
+
+#endif
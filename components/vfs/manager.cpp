@@ -13,8 +13,10 @@
 #include <cassert> // @todo: replace with DebugAssert
 #include <cctype>
 #include <cstring>
+#include <filesystem>
 #include <fstream>
 #include <sstream>
+#include <unordered_map>
 #include <vector>
 
 #include "../archives/bsaarchive.hpp"
@@ -22,8 +24,103 @@
 
 namespace
 {
+	// Where a file can be found. Loose files take precedence over GLOBAL.BSA.
+	struct IndexEntry
+	{
+		std::string looseFilePath; // Empty if only in GLOBAL.BSA.
+		std::string bsaEntryName; // Empty if not in GLOBAL.BSA.
+	};
+
 	std::vector<std::string> gRootPaths;
 	Archives::BsaArchive gGlobalBsa;
+
+	// All loose files and GLOBAL.BSA entries by case-folded name, so a lookup never has to probe the disk.
+	// Files added to a data path after it was scanned aren't visible.
+	std::unordered_map<std::string, IndexEntry> gIndex;
+
+	// Arena's files are DOS names, so they're matched regardless of casing or path separator.
+	std::string MakeIndexKey(const char *name)
+	{
+		std::string key(name);
+		for (char &c : key)
+		{
+			c = (c == '\\') ? '/' : static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+		}
+
+		return key;
+	}
+
+	void AddBsaToIndex()
+	{
+		for (const std::string &entryName : gGlobalBsa.list())
+		{
+			IndexEntry &indexEntry = gIndex[MakeIndexKey(entryName.c_str())];
+			if (indexEntry.bsaEntryName.empty())
+			{
+				indexEntry.bsaEntryName = entryName;
+			}
+		}
+	}
+
+	// Newer root paths are added last so their files replace older ones.
+	void AddRootPathToIndex(const std::string &rootPath)
+	{
+		std::error_code code;
+		std::filesystem::recursive_directory_iterator iter(rootPath, code);
+		if (code)
+		{
+			DebugLogWarning("Couldn't scan data path \"" + rootPath + "\" (" + code.message() + ").");
+			return;
+		}
+
+		for (; iter != std::filesystem::recursive_directory_iterator(); iter.increment(code))
+		{
+			if (code)
+			{
+				DebugLogWarning("Couldn't finish scanning data path \"" + rootPath + "\" (" + code.message() + ").");
+				break;
+			}
+
+			if (!iter->is_regular_file(code))
+			{
+				continue;
+			}
+
+			const std::string relativePath = iter->path().lexically_relative(rootPath).generic_string();
+			gIndex[MakeIndexKey(relativePath.c_str())].looseFilePath = rootPath + relativePath;
+		}
+	}
+
+	const IndexEntry *FindIndexEntry(const char *name)
+	{
+		const auto iter = gIndex.find(MakeIndexKey(name));
+		return (iter != gIndex.end()) ? &iter->second : nullptr;
+	}
+
+	// Returns null if the file isn't loose or can't be opened anymore.
+	std::unique_ptr<std::ifstream> TryOpenLooseFile(const IndexEntry &indexEntry)
+	{
+		if (indexEntry.looseFilePath.empty())
+		{
+			return nullptr;
+		}
+
+		std::unique_ptr<std::ifstream> stream(new std::ifstream(indexEntry.looseFilePath, std::ios::binary));
+		if (!stream->good())
+		{
+			return nullptr;
+		}
+
+		return stream;
+	}
+
+	void ReadAllBytes(std::istream &stream, Buffer<std::byte> *dst)
+	{
+		stream.seekg(0, std::ios::end);
+		dst->init(static_cast<int>(stream.tellg()));
+		stream.seekg(0, std::ios::beg);
+		stream.read(reinterpret_cast<char*>(dst->begin()), dst->getCount());
+	}
 }
 
 namespace VFS
@@ -41,6 +138,8 @@ void Manager::initialize(std::string&& rootPath)
 		rootPath += '/';
 
 	gGlobalBsa.load(rootPath + "GLOBAL.BSA");
+	AddBsaToIndex();
+	AddRootPathToIndex(rootPath);
 	gRootPaths.push_back(std::move(rootPath));
 }
 
@@ -51,6 +150,7 @@ void Manager::addDataPath(std::string&& path)
 	else if ((path.back() != '/') && (path.back() != '\\'))
 		path += '/';
 
+	AddRootPathToIndex(path);
 	gRootPaths.push_back(std::move(path));
 }
 
@@ -59,25 +159,28 @@ IStreamPtr Manager::open(const char *name, bool *inGlobalBSA)
 	assert(name != nullptr);
 	assert(inGlobalBSA != nullptr);
 
-	std::unique_ptr<std::ifstream> stream(new std::ifstream());
-
-	// Search in reverse, so newer paths take precedence.
-	const auto iter = std::find_if(gRootPaths.rbegin(), gRootPaths.rend(),
-		[name, &stream](const std::string &rootPath)
+	const IndexEntry *indexEntry = FindIndexEntry(name);
+	if (indexEntry == nullptr)
 	{
-		stream->open(rootPath + name, std::ios::binary);
-		return stream->good();
-	});
+		*inGlobalBSA = false;
+		return IStreamPtr(nullptr);
+	}
 
-	if (iter != gRootPaths.rend())
+	std::unique_ptr<std::ifstream> stream = TryOpenLooseFile(*indexEntry);
+	if (stream != nullptr)
 	{
 		*inGlobalBSA = false;
 		return IStreamPtr(std::move(stream));
 	}
-	else
+	else if (!indexEntry->bsaEntryName.empty())
 	{
 		*inGlobalBSA = true;
-		return gGlobalBsa.open(name);
+		return gGlobalBsa.open(indexEntry->bsaEntryName.c_str());
+	}
+	else
+	{
+		*inGlobalBSA = false;
+		return IStreamPtr(nullptr);
 	}
 }
 
@@ -89,34 +192,8 @@ IStreamPtr Manager::open(const char *name)
 
 IStreamPtr Manager::openCaseInsensitive(const char *name, bool *inGlobalBSA)
 {
-	// Since the given filename is assumed to be unique in its directory, we only need to
-	// worry about filenames just like it but with different casing.
-	std::string newName = name;
-
-	// Case 1: upper first character, lower rest.
-	newName.front() = std::toupper(newName.front());
-	std::for_each(newName.begin() + 1, newName.end(),
-		[](char &c) { c = std::tolower(c); });
-
-	IStreamPtr stream = this->open(newName.c_str(), inGlobalBSA);
-
-	if (stream != nullptr)
-	{
-		return stream;
-	}
-	else
-	{
-		// Case 2: all uppercase.
-		for (char &c : newName)
-		{
-			c = std::toupper(c);
-		}
-
-		stream = this->open(newName.c_str(), inGlobalBSA);
-
-		// The caller does error checking to see if this is null.
-		return stream;
-	}
+	// The index is already case-insensitive.
+	return this->open(name, inGlobalBSA);
 }
 
 IStreamPtr Manager::openCaseInsensitive(const char *name)
@@ -137,10 +214,7 @@ bool Manager::read(const char *name, Buffer<std::byte> *dst, bool *inGlobalBSA)
 		return false;
 	}
 
-	stream->seekg(0, std::ios::end);
-	dst->init(static_cast<int>(stream->tellg()));
-	stream->seekg(0, std::ios::beg);
-	stream->read(reinterpret_cast<char*>(dst->begin()), dst->getCount());
+	ReadAllBytes(*stream, dst);
 	return true;
 }
 
@@ -162,10 +236,7 @@ bool Manager::readCaseInsensitive(const char *name, Buffer<std::byte> *dst, bool
 		return false;
 	}
 
-	stream->seekg(0, std::ios::end);
-	dst->init(static_cast<int>(stream->tellg()));
-	stream->seekg(0, std::ios::beg);
-	stream->read(reinterpret_cast<char*>(dst->begin()), dst->getCount());
+	ReadAllBytes(*stream, dst);
 	return true;
 }
 
@@ -175,18 +246,45 @@ bool Manager::readCaseInsensitive(const char *name, Buffer<std::byte> *dst)
 	return this->readCaseInsensitive(name, dst, &dummy);
 }
 
-bool Manager::exists(const char *name)
+bool Manager::readView(const char *name, Buffer<std::byte> *storage, Span<const std::byte> *view, bool *inGlobalBSA)
 {
-	std::ifstream file;
-	const auto iter = std::find_if(gRootPaths.begin(), gRootPaths.end(),
-		[name, &file](const std::string &rootPath)
+	assert(name != nullptr);
+	assert(storage != nullptr);
+	assert(view != nullptr);
+	assert(inGlobalBSA != nullptr);
+
+	const IndexEntry *indexEntry = FindIndexEntry(name);
+	if ((indexEntry != nullptr) && indexEntry->looseFilePath.empty())
 	{
-		file.open(rootPath + name, std::ios::binary);
-		return file.is_open();
-	});
+		*inGlobalBSA = true;
+		if (gGlobalBsa.tryGetBytes(indexEntry->bsaEntryName.c_str(), view))
+		{
+			return true;
+		}
+	}
+
+	// Loose file, or GLOBAL.BSA isn't mapped.
+	IStreamPtr stream = this->open(name, inGlobalBSA);
+	if (stream == nullptr)
+	{
+		DebugLogError("Could not open \"" + std::string(name) + "\".");
+		return false;
+	}
+
+	ReadAllBytes(*stream, storage);
+	*view = Span<const std::byte>(storage->begin(), storage->getCount());
+	return true;
+}
 
-	// If not in the root paths, then check inside GLOBAL.BSA.
-	return (iter != gRootPaths.end()) || gGlobalBsa.exists(name);
+bool Manager::readView(const char *name, Buffer<std::byte> *storage, Span<const std::byte> *view)
+{
+	bool dummy;
+	return this->readView(name, storage, view, &dummy);
+}
+
+bool Manager::exists(const char *name)
+{
+	return FindIndexEntry(name) != nullptr;
 }
 
 void Manager::addDir(const std::string &path, const std::string &pre, const char *pattern,
@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "../utilities/Buffer.h"
+#include "../utilities/Span.h"
 
 namespace VFS
 {
@@ -25,16 +26,15 @@ class Manager {
 	Manager();
 
 public:
+	// Each data path is scanned once here, files are looked up by case-insensitive name afterwards.
 	void initialize(std::string&& rootPath = std::string());
 	void addDataPath(std::string&& path);
 
 	IStreamPtr open(const char *name, bool *inGlobalBSA);
 	IStreamPtr open(const char *name);
 
-	// Special open method intended for Unix systems since the Arena floppy and CD versions don't
-	// have consistent casing for some files (like SPELLSG.65). This method is specific to Arena's
-	// files and is not a general solution for case-insensitive file loading.
-	// - To do: replace with something using std::filesystem::equivalent() (C++17)?
+	// Kept for callers written before lookups were case-insensitive, since the Arena floppy and CD
+	// versions don't have consistent casing for some files (like SPELLSG.65). Same as open().
 	IStreamPtr openCaseInsensitive(const char *name, bool *inGlobalBSA);
 	IStreamPtr openCaseInsensitive(const char *name);
 
@@ -44,6 +44,12 @@ public:
 	bool readCaseInsensitive(const char *name, Buffer<std::byte> *dst, bool *inGlobalBSA);
 	bool readCaseInsensitive(const char *name, Buffer<std::byte> *dst);
 
+	// Points the view at a file's bytes without copying them if the file is in GLOBAL.BSA, otherwise reads
+	// the file into the storage buffer and points the view at that. The view is only valid as long as the
+	// storage buffer.
+	bool readView(const char *name, Buffer<std::byte> *storage, Span<const std::byte> *view, bool *inGlobalBSA);
+	bool readView(const char *name, Buffer<std::byte> *storage, Span<const std::byte> *view);
+
 	bool exists(const char *name);
 	std::vector<std::string> list(const char *pattern = nullptr) const;
 